@@ -30,6 +30,14 @@ internal fun createStablePointer(any: Any): COpaquePointer = newGlobalRef(any).t
 
 internal fun disposeStablePointer(pointer: COpaquePointer) = deleteGlobalRef(pointer.toLong())
 
+internal fun createStablePointers(objects: Array<out Any>, pointers: CArrayPointer<COpaquePointerVar>) {
+    objects.forEachIndexed { index, any -> pointers[index] = createStablePointer(any) }
+}
+
+internal fun disposeStablePointers(pointers: CArrayPointer<COpaquePointerVar>, count: Int) {
+    for (index in 0 until count) disposeStablePointer(pointers[index]!!)
+}
+
 @PublishedApi
 internal fun derefStablePointer(pointer: COpaquePointer): Any = derefGlobalRef(pointer.toLong())
 
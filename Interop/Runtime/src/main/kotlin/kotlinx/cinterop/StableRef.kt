@@ -38,6 +38,19 @@ public inline class StableRef<out T : Any> @PublishedApi internal constructor(
          */
         fun <T : Any> create(any: T) = StableRef<T>(createStablePointer(any))
 
+        /**
+         * Creates handles for all the [objects] in one call and stores them into [pointers], which must have room
+         * for `objects.size` elements. Each of the handles can be converted with [asStableRef] and disposed alone.
+         */
+        fun createAll(objects: Array<out Any>, pointers: CArrayPointer<COpaquePointerVar>) =
+                createStablePointers(objects, pointers)
+
+        /**
+         * Disposes [count] handles stored in [pointers] in one call.
+         */
+        fun disposeAll(pointers: CArrayPointer<COpaquePointerVar>, count: Int) =
+                disposeStablePointers(pointers, count)
+
         /**
          * Creates [StableRef] from given raw value.
          *
@@ -23,6 +23,18 @@ internal external fun createStablePointer(any: Any): COpaquePointer
 @SymbolName("Kotlin_Interop_disposeStablePointer")
 internal external fun disposeStablePointer(pointer: COpaquePointer)
 
+@SymbolName("Kotlin_Interop_createStablePointers")
+private external fun createStablePointers(objects: Array<out Any>, pointers: NativePtr)
+
+internal fun createStablePointers(objects: Array<out Any>, pointers: CArrayPointer<COpaquePointerVar>) =
+        createStablePointers(objects, pointers.rawValue)
+
+@SymbolName("Kotlin_Interop_disposeStablePointers")
+private external fun disposeStablePointers(pointers: NativePtr, count: Int)
+
+internal fun disposeStablePointers(pointers: CArrayPointer<COpaquePointerVar>, count: Int) =
+        disposeStablePointers(pointers.rawValue, count)
+
 @PublishedApi
 @SymbolName("Kotlin_Interop_derefStablePointer")
 internal external fun derefStablePointer(pointer: COpaquePointer): Any
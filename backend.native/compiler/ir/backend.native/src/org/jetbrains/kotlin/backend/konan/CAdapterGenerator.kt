@@ -876,6 +876,7 @@ internal class CAdapterGenerator(val context: Context) : DeclarationDescriptorVi
         output("typedef struct {")
         output("/* Service functions. */", 1)
         output("void (*DisposeStablePointer)(${prefix}_KNativePtr ptr);", 1)
+        output("void (*DisposeStablePointers)(${prefix}_KNativePtr* ptrs, ${prefix}_KInt count);", 1)
         output("void (*DisposeString)(const char* string);", 1)
         output("${prefix}_KBoolean (*IsInstance)(${prefix}_KNativePtr ref, const ${prefix}_KType* type);", 1)
         predefinedTypes.forEach {
@@ -908,6 +909,8 @@ internal class CAdapterGenerator(val context: Context) : DeclarationDescriptorVi
         headerFile.forEachLine { it -> output(it) }
 
         output("""
+        |#include <stddef.h>
+        |
         |struct KObjHeader;
         |typedef struct KObjHeader KObjHeader;
         |struct KTypeInfo;
@@ -924,6 +927,7 @@ internal class CAdapterGenerator(val context: Context) : DeclarationDescriptorVi
         |KObjHeader* DerefStablePointer(void*, KObjHeader**) RUNTIME_NOTHROW;
         |void* CreateStablePointer(KObjHeader*) RUNTIME_NOTHROW;
         |void DisposeStablePointer(void*) RUNTIME_NOTHROW;
+        |void DisposeStablePointers(void* const*, size_t) RUNTIME_NOTHROW;
         |${prefix}_KBoolean IsInstance(const KObjHeader*, const KTypeInfo*) RUNTIME_NOTHROW;
         |void EnterFrame(KObjHeader** start, int parameters, int count) RUNTIME_NOTHROW;
         |void LeaveFrame(KObjHeader** start, int parameters, int count) RUNTIME_NOTHROW;
@@ -979,6 +983,10 @@ internal class CAdapterGenerator(val context: Context) : DeclarationDescriptorVi
         |static void DisposeStablePointerImpl(${prefix}_KNativePtr ptr) {
         |  DisposeStablePointer(ptr);
         |}
+        |static void DisposeStablePointersImpl(${prefix}_KNativePtr* ptrs, ${prefix}_KInt count) {
+        |  if (count <= 0) return;
+        |  DisposeStablePointers(ptrs, (size_t)count);
+        |}
         |static void DisposeStringImpl(const char* ptr) {
         |  DisposeCString((char*)ptr);
         |}
@@ -1005,6 +1013,7 @@ internal class CAdapterGenerator(val context: Context) : DeclarationDescriptorVi
         makeScopeDefinitions(top, DefinitionKind.C_SOURCE_DECLARATION, 0)
         output("static ${prefix}_ExportedSymbols __konan_symbols = {")
         output(".DisposeStablePointer = DisposeStablePointerImpl,", 1)
+        output(".DisposeStablePointers = DisposeStablePointersImpl,", 1)
         output(".DisposeString = DisposeStringImpl,", 1)
         output(".IsInstance = IsInstanceImpl,", 1)
         predefinedTypes.forEach {
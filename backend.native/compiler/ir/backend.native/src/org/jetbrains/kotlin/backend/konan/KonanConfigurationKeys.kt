@@ -148,6 +148,8 @@ class KonanConfigKeys {
                 = CompilerConfigurationKey.create("override konan.properties values")
         val DESTROY_RUNTIME_MODE: CompilerConfigurationKey<DestroyRuntimeMode>
                 = CompilerConfigurationKey.create("when to destroy runtime")
+        val COMPACT_STRINGS: CompilerConfigurationKey<Boolean>
+                = CompilerConfigurationKey.create("store Latin-1 strings one byte per char")
     }
 }
 
@@ -183,6 +183,13 @@ internal val flattenStringConcatenationPhase = makeKonanFileLoweringPhase(
         description = "Flatten nested string concatenation expressions into a single IrStringConcatenation"
 )
 
+internal val stringConcatenationInLoopsPhase = makeKonanFileLoweringPhase(
+        ::StringConcatenationInLoopsLowering,
+        name = "StringConcatenationInLoops",
+        description = "Replace string accumulation in loops with StringBuilder appends",
+        prerequisite = setOf(flattenStringConcatenationPhase)
+)
+
 internal val stringConcatenationPhase = makeKonanFileLoweringPhase(
         ::StringConcatenationLowering,
         name = "StringConcatenation",
@@ -222,6 +222,7 @@ internal val allLoweringsPhase = NamedCompilerPhase(
                             flattenStringConcatenationPhase,
                             foldConstantLoweringPhase,
                             computeStringTrimPhase,
+                            stringConcatenationInLoopsPhase,
                             stringConcatenationPhase,
                             enumConstructorsPhase,
                             initializersPhase,
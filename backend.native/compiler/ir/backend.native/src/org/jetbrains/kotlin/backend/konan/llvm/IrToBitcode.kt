@@ -424,9 +424,9 @@ internal class CodeGeneratorVisitor(val context: Context, val lifetimes: Map<IrE
                                     } else {
                                         null
                                     }
+                                    // The legacy MM only registers globals as heap snapshot roots.
                                     val needRegistration =
-                                            context.memoryModel == MemoryModel.EXPERIMENTAL && // only for the new MM
-                                                    irField.type.binaryTypeIsReference() && // only for references
+                                            irField.type.binaryTypeIsReference() && // only for references
                                                     (initialValue != null || // which are initialized from heap object
                                                             !irField.isFinal) // or are not final
                                     if (needRegistration) {
@@ -2427,6 +2427,7 @@ internal class CodeGeneratorVisitor(val context: Context, val lifetimes: Map<IrE
             return
 
         overrideRuntimeGlobal("Kotlin_destroyRuntimeMode", Int32(context.config.destroyRuntimeMode.value))
+        overrideRuntimeGlobal("Kotlin_compactStrings", Int32(if (context.config.compactStrings) 1 else 0))
     }
 
     //-------------------------------------------------------------------------//
@@ -32,7 +32,7 @@ internal fun addLlvmAttributes(context: Context, irFunction: IrFunction, llvmFun
 private fun mustNotInline(context: Context, irFunction: IrFunction): Boolean {
     if (context.shouldContainLocationDebugInfo()) {
         if (irFunction is IrConstructor && irFunction.isPrimary && irFunction.returnType.isThrowable()) {
-            // To simplify skipping this constructor when scanning call stack in Kotlin_getCurrentStackTrace.
+            // To simplify skipping this constructor when scanning call stack in Kotlin_Throwable_captureStackTrace.
             return true
         }
     }
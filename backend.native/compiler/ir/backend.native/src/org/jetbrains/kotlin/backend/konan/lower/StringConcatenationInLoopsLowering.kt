@@ -0,0 +1,238 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.kotlin.backend.konan.lower
+
+import org.jetbrains.kotlin.backend.common.FileLoweringPass
+import org.jetbrains.kotlin.backend.common.IrElementTransformerVoidWithContext
+import org.jetbrains.kotlin.backend.common.atMostOne
+import org.jetbrains.kotlin.backend.common.lower.at
+import org.jetbrains.kotlin.backend.common.lower.createIrBuilder
+import org.jetbrains.kotlin.backend.konan.Context
+import org.jetbrains.kotlin.ir.IrElement
+import org.jetbrains.kotlin.ir.builders.*
+import org.jetbrains.kotlin.ir.declarations.*
+import org.jetbrains.kotlin.ir.declarations.impl.IrVariableImpl
+import org.jetbrains.kotlin.ir.expressions.*
+import org.jetbrains.kotlin.ir.expressions.impl.IrTryImpl
+import org.jetbrains.kotlin.ir.symbols.impl.IrVariableSymbolImpl
+import org.jetbrains.kotlin.ir.types.*
+import org.jetbrains.kotlin.ir.util.constructors
+import org.jetbrains.kotlin.ir.util.defaultType
+import org.jetbrains.kotlin.ir.util.functions
+import org.jetbrains.kotlin.ir.visitors.*
+import org.jetbrains.kotlin.name.Name
+
+/**
+ * Makes strings built with `s += x` in a loop take linear time instead of quadratic: if a local `String` variable
+ * is only used in a loop as `s = s + ...`, the loop appends to a [StringBuilder] instead and stores the result
+ * into the variable once on exit:
+ *
+ *     var s = ""                         var s = ""
+ *     while (...) {                      var sb: StringBuilder? = null
+ *         s += x                         try {
+ *     }                          =>          while (...) {
+ *                                                if (sb == null) sb = StringBuilder(s)
+ *                                                sb.append(x)
+ *                                            }
+ *                                        } finally {
+ *                                            if (sb != null) s = sb.toString()
+ *                                        }
+ *
+ * The builder is created lazily, so a loop that never appends doesn't copy the string.
+ * Must run after [FlattenStringConcatenationLowering] and before [StringConcatenationLowering].
+ */
+internal class StringConcatenationInLoopsLowering(val context: Context) : FileLoweringPass, IrElementTransformerVoidWithContext() {
+    override fun lower(irFile: IrFile) {
+        irFile.transformChildrenVoid(this)
+    }
+
+    private val irBuiltIns = context.irBuiltIns
+    private val symbols = context.ir.symbols
+
+    private val typesWithSpecialAppendFunction = irBuiltIns.primitiveIrTypes + irBuiltIns.stringType
+
+    private val nameToString = Name.identifier("toString")
+    private val nameAppend = Name.identifier("append")
+
+    private val stringBuilder = symbols.stringBuilder.owner
+    private val stringBuilderType = stringBuilder.defaultType
+
+    private val constructor = stringBuilder.constructors.single {
+        it.valueParameters.singleOrNull()?.type?.isString() == true
+    }
+
+    private val toStringFunction = stringBuilder.functions.single {
+        it.valueParameters.isEmpty() && it.name == nameToString
+    }
+
+    private val defaultAppendFunction = stringBuilder.functions.single {
+        it.name == nameAppend &&
+                it.valueParameters.size == 1 &&
+                it.valueParameters.single().type.isNullableAny()
+    }
+
+    private val appendFunctions: Map<IrType, IrSimpleFunction?> =
+            typesWithSpecialAppendFunction.map { type ->
+                type to stringBuilder.functions.toList().atMostOne {
+                    it.name == nameAppend && it.valueParameters.singleOrNull()?.type == type
+                }
+            }.toMap()
+
+    private fun typeToAppendFunction(type: IrType): IrSimpleFunction {
+        return appendFunctions[type] ?: defaultAppendFunction
+    }
+
+    override fun visitLoop(loop: IrLoop): IrExpression {
+        val irBuilder = context.createIrBuilder(currentScope!!.scope.scopeOwnerSymbol, loop.startOffset, loop.endOffset)
+        val accumulators = findAccumulators(loop, irBuilder.parent)
+        if (accumulators.isEmpty())
+            return super.visitLoop(loop)
+
+        val builders = accumulators.associateWith { accumulator ->
+            IrVariableImpl(
+                    loop.startOffset, loop.endOffset,
+                    IrDeclarationOrigin.IR_TEMPORARY_VARIABLE,
+                    IrVariableSymbolImpl(),
+                    Name.identifier("${accumulator.name.asString()}\$builder"),
+                    stringBuilderType.makeNullable(),
+                    isVar = true,
+                    isConst = false,
+                    isLateinit = false
+            ).apply {
+                parent = irBuilder.parent
+                initializer = irBuilder.irNull()
+            }
+        }
+
+        loop.transformChildrenVoid(object : IrElementTransformerVoid() {
+            override fun visitSetValue(expression: IrSetValue): IrExpression {
+                expression.transformChildrenVoid(this)
+                val builder = builders[expression.symbol.owner]
+                        ?: return expression
+                val arguments = (expression.value as IrStringConcatenation).arguments
+                return irBuilder.at(expression).appendAll(expression, builder, arguments.drop(1))
+            }
+        })
+        // Accumulators of nested loops, if any.
+        val transformedLoop = super.visitLoop(loop)
+
+        return irBuilder.at(loop).irBlock(resultType = loop.type) {
+            builders.values.forEach { +it }
+            +IrTryImpl(
+                    startOffset = loop.startOffset,
+                    endOffset = loop.endOffset,
+                    type = loop.type,
+                    tryResult = transformedLoop,
+                    catches = emptyList(),
+                    finallyExpression = irBlock {
+                        builders.forEach { (accumulator, builder) ->
+                            +irIfThen(
+                                    irNot(irEqeqeq(irGet(builder), irNull())),
+                                    irSet(accumulator.symbol, irCall(toStringFunction).apply {
+                                        dispatchReceiver = irImplicitCast(irGet(builder), stringBuilderType)
+                                    })
+                            )
+                        }
+                    }
+            )
+        }
+    }
+
+    private fun IrBuilderWithScope.appendAll(expression: IrSetValue, builder: IrVariable,
+                                             arguments: List<IrExpression>) =
+            irBlock(resultType = expression.type) {
+                val accumulator = expression.symbol.owner
+                +irIfThen(
+                        irEqeqeq(irGet(builder), irNull()),
+                        irSet(builder.symbol, irCall(constructor).apply {
+                            putValueArgument(0, stringOf(irGet(accumulator)))
+                        })
+                )
+                // All arguments are evaluated before the first append, so that an exception
+                // leaves the accumulated string as it was.
+                val values = if (arguments.size == 1) {
+                    arguments
+                } else {
+                    arguments.map { argument ->
+                        val value = if (argument.type in appendFunctions) argument else stringOf(argument)
+                        irGet(irTemporary(value))
+                    }
+                }
+                val receiver = irTemporary(irImplicitCast(irGet(builder), stringBuilderType))
+                values.forEach { value ->
+                    +irCall(typeToAppendFunction(value.type)).apply {
+                        dispatchReceiver = irGet(receiver)
+                        putValueArgument(0, value)
+                    }
+                }
+                +irGetObject(irBuiltIns.unitClass)
+            }
+
+    private fun IrBuilderWithScope.stringOf(argument: IrExpression): IrExpression = when {
+        argument.type.isString() -> argument
+
+        argument.type.isNullable() -> irCall(symbols.extensionToString).apply {
+            extensionReceiver = argument
+        }
+
+        else -> irCall(irBuiltIns.anyClass.functions.single { it.owner.name == nameToString }).apply {
+            dispatchReceiver = argument
+        }
+    }
+
+    /**
+     * Returns local `String` variables of [parent] that are only used in [loop] as `s = s + ...`,
+     * with the rest of the concatenation not referring to the variable.
+     */
+    private fun findAccumulators(loop: IrLoop, parent: IrDeclarationParent): List<IrVariable> {
+        val candidates = mutableSetOf<IrVariable>()
+        val rejected = mutableSetOf<IrVariable>()
+
+        loop.acceptChildrenVoid(object : IrElementVisitorVoid {
+            private var functionDepth = 0
+            private val currentPatterns = mutableSetOf<IrVariable>()
+
+            override fun visitElement(element: IrElement) {
+                element.acceptChildrenVoid(this)
+            }
+
+            override fun visitFunction(declaration: IrFunction) {
+                ++functionDepth
+                super.visitFunction(declaration)
+                --functionDepth
+            }
+
+            override fun visitVariable(declaration: IrVariable) {
+                rejected += declaration
+                super.visitVariable(declaration)
+            }
+
+            override fun visitGetValue(expression: IrGetValue) {
+                (expression.symbol.owner as? IrVariable)?.let { rejected += it }
+            }
+
+            override fun visitSetValue(expression: IrSetValue) {
+                val variable = expression.symbol.owner as? IrVariable
+                        ?: return super.visitSetValue(expression)
+                val arguments = (expression.value as? IrStringConcatenation)?.arguments
+                val receiver = arguments?.firstOrNull() as? IrGetValue
+                if (arguments == null || arguments.size < 2 || receiver?.symbol != expression.symbol
+                        || functionDepth > 0 || variable in currentPatterns) {
+                    rejected += variable
+                    return super.visitSetValue(expression)
+                }
+                candidates += variable
+                currentPatterns += variable
+                arguments.drop(1).forEach { it.acceptVoid(this) }
+                currentPatterns -= variable
+            }
+        })
+
+        return candidates.filter {
+            it !in rejected && it.isVar && it.parent == parent && it.type.isStringClassType()
+        }
+    }
+}
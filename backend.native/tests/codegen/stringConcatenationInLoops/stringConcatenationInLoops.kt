@@ -0,0 +1,92 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package codegen.stringConcatenationInLoops.stringConcatenationInLoops
+
+import kotlin.test.*
+
+fun accumulate(count: Int): String {
+    var s = ">"
+    for (i in 0 until count) {
+        s += i
+        s = s + ',' + (i * 2L) + ';'
+    }
+    return s
+}
+
+fun accumulateNullable(count: Int): String? {
+    var s: String? = null
+    for (i in 0 until count) {
+        s += "a"
+    }
+    return s
+}
+
+fun accumulateUntilThrow(): String {
+    var s = ""
+    try {
+        for (i in 0 until 10) {
+            s = s + i + (if (i == 3) throw IllegalStateException() else "-")
+        }
+    } catch (e: IllegalStateException) {
+        s += "!"
+    }
+    return s
+}
+
+fun accumulateWithBreak(): String {
+    var s = ""
+    outer@ while (true) {
+        for (i in 0 until 10) {
+            s += i
+            if (i == 4) break@outer
+        }
+    }
+    return s
+}
+
+fun accumulateAndReturn(): String {
+    var s = "x"
+    var result = ""
+    for (i in 0 until 5) {
+        s += i
+        if (i == 2) {
+            result = "returned"
+            break
+        }
+    }
+    return result + s
+}
+
+fun selfReference(): String {
+    var s = "a"
+    for (i in 0 until 3) {
+        s = s + s
+    }
+    return s
+}
+
+fun readInLoop(): String {
+    var s = ""
+    var lengths = ""
+    for (i in 0 until 3) {
+        s += "ab"
+        lengths += s.length
+    }
+    return s + lengths
+}
+
+@Test
+fun runTest() {
+    assertEquals(">", accumulate(0))
+    assertEquals(">00,0;11,2;22,4;", accumulate(3))
+    assertEquals(null, accumulateNullable(0))
+    assertEquals("nullaa", accumulateNullable(2))
+    assertEquals("0-1-2-!", accumulateUntilThrow())
+    assertEquals("01234", accumulateWithBreak())
+    assertEquals("returnedx012", accumulateAndReturn())
+    assertEquals("aaaaaaaa", selfReference())
+    assertEquals("ababab246", readInLoop())
+}
@@ -92,10 +92,8 @@ int main(void) {
     __ DisposeString(string3);
     __ DisposeString(string4);
     __ DisposeString(string5);
-    __ DisposeStablePointer(base.pinned);
-    __ DisposeStablePointer(child.pinned);
-    __ DisposeStablePointer(impl1.pinned);
-    __ DisposeStablePointer(impl2.pinned);
+    testlib_KNativePtr pointers[] = { base.pinned, child.pinned, impl1.pinned, impl2.pinned };
+    __ DisposeStablePointers(pointers, sizeof(pointers) / sizeof(pointers[0]));
     __ DisposeStablePointer(enum1.pinned);
     __ DisposeStablePointer(object1.pinned);
     __ DisposeStablePointer(nullableInt.pinned);
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.collections.array_copy_refs
+
+import kotlin.test.*
+
+data class Box(val value: Int)
+
+fun boxes(count: Int) = Array<Box?>(count) { Box(it) }
+
+fun values(array: Array<Box?>) = array.map { it?.value }
+
+@Test fun copyIntoOtherArray() {
+    val source = boxes(10)
+    val destination = Array<Box?>(10) { Box(-1) }
+    source.copyInto(destination, 2, 3, 8)
+    assertEquals(listOf(-1, -1, 3, 4, 5, 6, 7, -1, -1, -1), values(destination))
+    assertSame(source[3], destination[2])
+}
+
+@Test fun copyIntoSelfForward() {
+    val array = boxes(10)
+    array.copyInto(array, 3, 1, 7)
+    assertEquals(listOf(0, 1, 2, 1, 2, 3, 4, 5, 6, 9), values(array))
+    assertSame(array[1], array[3])
+}
+
+@Test fun copyIntoSelfBackward() {
+    val array = boxes(10)
+    array.copyInto(array, 1, 3, 9)
+    assertEquals(listOf(0, 3, 4, 5, 6, 7, 8, 7, 8, 9), values(array))
+    assertSame(array[7], array[5])
+}
+
+@Test fun copyIntoSelfSameRange() {
+    val array = boxes(5)
+    array.copyInto(array, 0, 0, 5)
+    assertEquals(listOf(0, 1, 2, 3, 4), values(array))
+}
+
+@Test fun copyOfKeepsElementsAlive() {
+    var copy = boxes(1000).copyOf(2000)
+    for (i in 0 until 1000) {
+        copy.copyInto(copy, 1, 0, 1999)
+        copy[0] = null
+    }
+    assertEquals(List(1000) { null } + (0 until 1000).toList(), values(copy))
+    copy = copy.copyOfRange(1000, 1010)
+    assertEquals((0 until 10).toList(), values(copy))
+}
+
+@Test fun fill() {
+    val array = boxes(10)
+    val box = Box(42)
+    array.fill(box, 2, 6)
+    assertEquals(listOf(0, 1, 42, 42, 42, 42, 6, 7, 8, 9), values(array))
+    array.fill(box)
+    assertTrue(array.all { it === box })
+    array.fill(null, 5)
+    assertEquals(List(5) { 42 } + List(5) { null }, values(array))
+}
+
+@Test fun arrayListInsertAndRemove() {
+    val list = ArrayList<Box>()
+    for (i in 0 until 100) list.add(0, Box(i))
+    for (i in 0 until 50) list.removeAt(0)
+    assertEquals((49 downTo 0).toList(), list.map { it.value })
+}
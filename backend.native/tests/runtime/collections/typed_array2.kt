@@ -0,0 +1,113 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.collections.typed_array2
+
+import kotlin.test.*
+
+@Test fun bulkGetters() {
+    val bytes = ByteArray(37) { (it * 7 + 3).toByte() }
+    for (index in 0..5) {
+        val ints = IntArray(8)
+        bytes.getIntsAt(index, ints)
+        assertEquals(List(8) { bytes.getIntAt(index + it * 4) }, ints.toList())
+
+        val longs = LongArray(5)
+        bytes.getLongsAt(index, longs, 1, 3)
+        assertEquals(listOf(0L) + List(3) { bytes.getLongAt(index + it * 8) } + 0L, longs.toList())
+
+        val chars = CharArray(10)
+        bytes.getCharsAt(index, chars)
+        assertEquals(List(10) { bytes.getCharAt(index + it * 2) }, chars.toList())
+
+        val shorts = ShortArray(10)
+        bytes.getShortsAt(index, shorts)
+        assertEquals(List(10) { bytes.getShortAt(index + it * 2) }, shorts.toList())
+
+        val doubles = DoubleArray(3)
+        bytes.getDoublesAt(index, doubles)
+        assertTrue(List(3) { bytes.getDoubleAt(index + it * 8) }.toDoubleArray() contentEquals doubles)
+
+        val floats = FloatArray(6)
+        bytes.getFloatsAt(index, floats)
+        assertTrue(List(6) { bytes.getFloatAt(index + it * 4) }.toFloatArray() contentEquals floats)
+    }
+
+    assertFailsWith<ArrayIndexOutOfBoundsException> { bytes.getIntsAt(2, IntArray(9)) }
+    assertFailsWith<ArrayIndexOutOfBoundsException> { bytes.getLongsAt(-1, LongArray(1)) }
+    assertFailsWith<ArrayIndexOutOfBoundsException> { bytes.getShortsAt(0, ShortArray(2), 1, 2) }
+    assertFailsWith<ArrayIndexOutOfBoundsException> { bytes.getCharsAt(0, CharArray(2), 0, -1) }
+    bytes.getIntsAt(37, IntArray(0))
+}
+
+@Test fun contentEquals() {
+    for (size in 0..20) {
+        val ints = IntArray(size) { it * 31 }
+        val other = ints.copyOf()
+        assertTrue(ints contentEquals other)
+        for (i in 0 until size) {
+            other[i]++
+            assertFalse(ints contentEquals other)
+            other[i]--
+        }
+        assertFalse(ints contentEquals ints.copyOf(size + 1))
+    }
+
+    val doubles = doubleArrayOf(1.0, Double.NaN, 0.0, 4.0, 5.0)
+    assertTrue(doubles contentEquals doubleArrayOf(1.0, -Double.NaN, 0.0, 4.0, 5.0))
+    assertFalse(doubles contentEquals doubleArrayOf(1.0, Double.NaN, -0.0, 4.0, 5.0))
+
+    val floats = FloatArray(9) { Float.NaN }
+    assertTrue(floats contentEquals FloatArray(9) { Float.fromBits(0x7fc00001) })
+    assertFalse(floats contentEquals FloatArray(9) { if (it == 8) 0.0f else Float.NaN })
+
+    assertTrue(booleanArrayOf(true, false) contentEquals booleanArrayOf(true, false))
+    assertFalse(charArrayOf('a', 'b') contentEquals charArrayOf('a', 'c'))
+    assertFalse((null as ByteArray?) contentEquals byteArrayOf())
+}
+
+@Test fun contentHashCode() {
+    for (size in 0..20) {
+        val bytes = ByteArray(size) { (it * 37).toByte() }
+        assertEquals(bytes.toList().hashCode(), bytes.contentHashCode())
+        val shorts = ShortArray(size) { (it * -1001).toShort() }
+        assertEquals(shorts.toList().hashCode(), shorts.contentHashCode())
+        val chars = CharArray(size) { (0xfff0 + it).toChar() }
+        assertEquals(chars.toList().hashCode(), chars.contentHashCode())
+        val ints = IntArray(size) { it * -1640531535 }
+        assertEquals(ints.toList().hashCode(), ints.contentHashCode())
+        val longs = LongArray(size) { it * -0x123456789L }
+        assertEquals(longs.toList().hashCode(), longs.contentHashCode())
+        val floats = FloatArray(size) { it * 1.5f - 10 }
+        assertEquals(floats.toList().hashCode(), floats.contentHashCode())
+        val doubles = DoubleArray(size) { it * 1.5 - 10 }
+        assertEquals(doubles.toList().hashCode(), doubles.contentHashCode())
+        val booleans = BooleanArray(size) { it % 3 == 0 }
+        assertEquals(booleans.toList().hashCode(), booleans.contentHashCode())
+    }
+    assertEquals(0, (null as IntArray?).contentHashCode())
+}
+
+@Test fun asListIndexOf() {
+    for (size in 0..40) {
+        val ints = IntArray(size) { it % 7 }.asList()
+        for (element in -1..7) {
+            assertEquals(ints.toList().indexOf(element), ints.indexOf(element))
+            assertEquals(ints.toList().lastIndexOf(element), ints.lastIndexOf(element))
+            assertEquals(element in 0..minOf(6, size - 1), element in ints)
+        }
+    }
+    assertEquals(2, byteArrayOf(1, 2, 3, 3).asList().indexOf(3))
+    assertEquals(3, longArrayOf(1L, 2L, 3L, 3L).asList().lastIndexOf(3L))
+    assertEquals(-1, charArrayOf('a', 'b').asList().indexOf('c'))
+    assertEquals(1, booleanArrayOf(true, false, false).asList().indexOf(false))
+
+    val doubles = doubleArrayOf(0.0, -0.0, Double.NaN, 1.0, -Double.NaN).asList()
+    assertEquals(1, doubles.indexOf(-0.0))
+    assertEquals(0, doubles.lastIndexOf(0.0))
+    assertEquals(2, doubles.indexOf(Double.NaN))
+    assertEquals(4, doubles.lastIndexOf(Double.NaN))
+    assertTrue(Float.fromBits(0x7fc00001) in FloatArray(9) { if (it == 8) Float.NaN else 0.0f }.asList())
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.exceptions.stack_trace_depth_limit
+
+import kotlin.test.*
+import kotlin.native.internal.Debugging
+
+var unwound = 0
+
+// Not a tail call, so that each level keeps its frame.
+fun recurse(depth: Int): Throwable = if (depth == 0) Exception() else recurse(depth - 1).also { unwound++ }
+
+@Test fun runTest() {
+    val defaultLimit = Debugging.stackTraceDepthLimit
+    assertEquals(Int.MAX_VALUE, defaultLimit)
+    assertTrue(recurse(100).getStackTrace().size > 100)
+    // Deeper than the initially captured frames.
+    assertTrue(recurse(2000).getStackTrace().size > 2000)
+
+    Debugging.stackTraceDepthLimit = 10
+    assertEquals(10, recurse(100).getStackTrace().size)
+
+    Debugging.stackTraceDepthLimit = 0
+    assertEquals(0, recurse(100).getStackTrace().size)
+
+    assertFailsWith<IllegalArgumentException> { Debugging.stackTraceDepthLimit = -1 }
+
+    Debugging.stackTraceDepthLimit = defaultLimit
+    assertTrue(recurse(100).getStackTrace().size > 100)
+    println("OK")
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.memory.allocation_profiler
+
+import kotlin.test.*
+
+import kotlin.native.internal.AllocationProfiler
+import kotlinx.cinterop.*
+import platform.posix.*
+
+class Payload(val value: Int)
+
+@Test fun profile() {
+    AllocationProfiler.clear()
+    AllocationProfiler.start(samplingIntervalBytes = 1)
+    assertTrue(AllocationProfiler.isEnabled)
+    val payloads = Array(1000) { Payload(it) }
+    AllocationProfiler.stop()
+    assertFalse(AllocationProfiler.isEnabled)
+    assertEquals(999, payloads.last().value)
+
+    val path = "allocation_profiler.pb.tmp"
+    assertTrue(AllocationProfiler.writeProfile(path))
+    memScoped {
+        val stat = alloc<stat>()
+        assertEquals(0, stat(path, stat.ptr))
+        assertTrue(stat.st_size > 0)
+    }
+    remove(path)
+    AllocationProfiler.clear()
+}
+
+@Test fun invalidInterval() {
+    assertFailsWith<IllegalArgumentException> {
+        AllocationProfiler.start(samplingIntervalBytes = 0)
+    }
+    assertFalse(AllocationProfiler.isEnabled)
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.memory.heap_snapshot
+
+import kotlin.test.*
+
+import kotlin.native.internal.HeapSnapshot
+import kotlinx.cinterop.*
+import platform.posix.*
+
+class Node(val next: Node?, val payload: IntArray)
+class GlobalMarker
+class StableMarker
+
+val globalMarker = GlobalMarker()
+
+private const val NODE = "runtime.memory.heap_snapshot.Node"
+private const val GLOBAL_MARKER = "runtime.memory.heap_snapshot.GlobalMarker"
+private const val STABLE_MARKER = "runtime.memory.heap_snapshot.StableMarker"
+
+// Must match `HeapSnapshotWriter::RootKind`.
+private const val ROOT_GLOBAL = 2
+private const val ROOT_STABLE_REF = 3
+
+private class SnapshotObject(val typeId: Long, val size: Int, val references: List<Long>)
+
+private class Snapshot(val types: Map<Long, String>, val objects: Map<Long, SnapshotObject>, val roots: List<Pair<Int, Long>>) {
+    fun typeName(id: Long): String? = objects[id]?.let { types[it.typeId] }
+
+    fun reachableFromRoots(): Set<Long> {
+        val visited = mutableSetOf<Long>()
+        val toVisit = roots.map { it.second }.toMutableList()
+        while (toVisit.isNotEmpty()) {
+            val id = toVisit.removeAt(toVisit.size - 1)
+            if (!visited.add(id)) continue
+            objects[id]?.let { toVisit.addAll(it.references) }
+        }
+        return visited
+    }
+}
+
+private class Reader(val bytes: ByteArray) {
+    var position = 0
+
+    fun u8(): Int = bytes[position++].toInt() and 0xff
+    fun u32(): Int = (0 until 4).fold(0) { value, i -> value or (u8() shl (8 * i)) }
+    fun u64(): Long = (0 until 8).fold(0L) { value, i -> value or (u8().toLong() shl (8 * i)) }
+
+    fun string(): String {
+        val size = u32()
+        val result = bytes.decodeToString(position, position + size)
+        position += size
+        return result
+    }
+}
+
+private fun readFile(path: String): ByteArray {
+    val file = fopen(path, "rb") ?: error("Cannot open $path")
+    try {
+        fseek(file, 0, SEEK_END)
+        val size = ftell(file).toInt()
+        fseek(file, 0, SEEK_SET)
+        val bytes = ByteArray(size)
+        if (size > 0) {
+            assertEquals(size.toULong(), bytes.usePinned { fread(it.addressOf(0), 1, size.convert(), file) }.toULong())
+        }
+        return bytes
+    } finally {
+        fclose(file)
+    }
+}
+
+private fun parse(path: String): Snapshot {
+    val reader = Reader(readFile(path))
+    assertEquals("KNHS", String(CharArray(4) { reader.u8().toChar() }))
+    assertEquals(1, reader.u32())
+    val types = mutableMapOf<Long, String>()
+    val objects = mutableMapOf<Long, SnapshotObject>()
+    val roots = mutableListOf<Pair<Int, Long>>()
+    while (true) {
+        when (val record = reader.u8()) {
+            0 -> break
+            1 -> {
+                val id = reader.u64()
+                types[id] = reader.string()
+                reader.u32() // instanceSize
+                repeat(reader.u32()) { reader.string() }
+            }
+            2 -> {
+                val id = reader.u64()
+                val typeId = reader.u64()
+                assertTrue(typeId in types, "Type of an object must be written before it")
+                val size = reader.u32()
+                val references = List(reader.u32()) {
+                    reader.u32() // index
+                    reader.u64()
+                }
+                objects[id] = SnapshotObject(typeId, size, references)
+            }
+            3 -> {
+                val kind = reader.u8()
+                roots += kind to reader.u64()
+            }
+            else -> fail("Unknown record $record at ${reader.position - 1}")
+        }
+    }
+    assertEquals(reader.bytes.size, reader.position)
+    return Snapshot(types, objects, roots)
+}
+
+@Test fun dump() {
+    val path = "heap_snapshot.knhs.tmp"
+    var list: Node? = null
+    repeat(100) {
+        list = Node(list, IntArray(1000))
+    }
+    val stableRef = StableRef.create(StableMarker())
+
+    assertTrue(HeapSnapshot.dump(path))
+    val snapshot = parse(path)
+    remove(path)
+    stableRef.dispose()
+
+    assertTrue(snapshot.roots.any { it.first == ROOT_GLOBAL && snapshot.typeName(it.second) == GLOBAL_MARKER })
+    assertTrue(snapshot.roots.any { it.first == ROOT_STABLE_REF && snapshot.typeName(it.second) == STABLE_MARKER })
+
+    // The list is a chain of 100 nodes reachable from the roots, each with its own payload array.
+    val nodes = snapshot.objects.filterValues { snapshot.types[it.typeId] == NODE }
+    val nextNodes = nodes.values.flatMap { node -> node.references.filter { it in nodes } }.toSet()
+    val heads = nodes.keys - nextNodes
+    assertEquals(1, heads.size)
+    assertTrue(heads.single() in snapshot.reachableFromRoots())
+    var length = 0
+    var current: Long? = heads.single()
+    while (current != null) {
+        val node = nodes.getValue(current)
+        val payloads = node.references.filter { snapshot.typeName(it) == "kotlin.IntArray" }
+        assertEquals(1, payloads.size)
+        assertTrue(snapshot.objects.getValue(payloads.single()).size >= 1000 * 4)
+        current = node.references.singleOrNull { it in nodes }
+        ++length
+    }
+    assertEquals(100, length)
+    assertEquals(1000, list!!.payload.size)
+    assertNotNull(globalMarker)
+}
+
+@Test fun cannotWrite() {
+    assertFalse(HeapSnapshot.dump("/nonexistent/directory/heap_snapshot.knhs"))
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.memory.identity_hash
+
+import kotlin.test.*
+
+import kotlin.native.concurrent.*
+import kotlin.native.identityHashCode
+import kotlin.native.ref.WeakReference
+
+class Data(val value: Int)
+
+@Test fun stable() {
+    val data = Data(1)
+    val hash = data.hashCode()
+    assertEquals(hash, data.identityHashCode())
+    // Uses the same meta object as the hash.
+    val weak = WeakReference(data)
+    assertEquals(hash, weak.get()!!.hashCode())
+    assertEquals(0, null.identityHashCode())
+}
+
+@Test fun distinct() {
+    val objects = List(1000) { Data(it) }
+    assertTrue(objects.map { it.hashCode() }.toSet().size > 990)
+}
+
+@Test fun otherWorker() {
+    val data = Data(2).freeze()
+    val hash = data.hashCode()
+    val worker = Worker.start()
+    assertEquals(hash, worker.execute(TransferMode.SAFE, { data }) { it.hashCode() }.result)
+    worker.requestTermination().result
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.memory.memory_statistics
+
+import kotlin.test.*
+
+import kotlin.native.concurrent.*
+import kotlin.native.internal.GC
+import kotlin.native.internal.MemoryStatistics
+import kotlinx.cinterop.*
+
+class Node(var next: Node?)
+
+private fun totalAllocationCount() =
+        (0 until MemoryStatistics.sizeClassCount).fold(0L) { sum, sizeClass -> sum + MemoryStatistics.allocationCount(sizeClass) }
+
+private fun totalGcPauseCount() =
+        (0 until MemoryStatistics.gcPauseBucketCount).fold(0L) { sum, bucket -> sum + MemoryStatistics.gcPauseCount(bucket) }
+
+@Test fun allocations() {
+    val before = MemoryStatistics.allocationCount(MemoryStatistics.sizeClassCount - 1)
+    val totalBefore = totalAllocationCount()
+    val array = ByteArray(2 * 1024 * 1024)
+    assertEquals(before + 1, MemoryStatistics.allocationCount(MemoryStatistics.sizeClassCount - 1))
+    assertTrue(totalAllocationCount() > totalBefore)
+    assertEquals(2 * 1024 * 1024, array.size)
+}
+
+@Test fun gc() {
+    val before = MemoryStatistics.gcCount
+    GC.collect()
+    assertEquals(before + 1, MemoryStatistics.gcCount)
+    assertEquals(MemoryStatistics.gcCount, totalGcPauseCount())
+    assertTrue(MemoryStatistics.gcMaxPauseMicroseconds <= MemoryStatistics.gcPauseMicroseconds)
+}
+
+@Test fun cycles() {
+    val before = MemoryStatistics.collectedCycles
+    run {
+        val first = Node(null)
+        first.next = Node(first)
+    }
+    GC.collect()
+    assertTrue(MemoryStatistics.collectedCycles > before)
+}
+
+@Test fun stableRefs() {
+    val before = MemoryStatistics.stableRefs
+    val ref = StableRef.create(Any())
+    assertEquals(before + 1, MemoryStatistics.stableRefs)
+    ref.dispose()
+    assertEquals(before, MemoryStatistics.stableRefs)
+}
+
+// `StableRef` is backed by a foreign reference: each creation must be paired with its disposal.
+@Test fun foreignRefsPaired() {
+    val before = MemoryStatistics.stableRefs
+    val refs = List(10) { StableRef.create(Any()) }
+    assertEquals(before + 10, MemoryStatistics.stableRefs)
+    refs.forEach { it.dispose() }
+    assertEquals(before, MemoryStatistics.stableRefs)
+}
+
+@Test fun frozenBytes() {
+    val before = MemoryStatistics.frozenBytes
+    IntArray(1000).freeze()
+    assertTrue(MemoryStatistics.frozenBytes >= before + 4000)
+}
+
+@Test fun minorGc() {
+    // Only the experimental memory manager has the generational mode.
+    assertFalse(GC.generational)
+    assertFailsWith<IllegalArgumentException> {
+        GC.generational = true
+    }
+    assertEquals(-1L, GC.nurserySize)
+    assertEquals(0L, MemoryStatistics.minorGcCount)
+    assertEquals(0L, MemoryStatistics.minorGcPromotedBytes)
+}
+
+@Test fun json() {
+    val json = MemoryStatistics.toJson()
+    assertTrue(json.startsWith("{\"allocations\":["))
+    assertTrue(json.contains("\"gc\":{\"count\":"))
+    assertTrue(json.contains("\"minorGc\":{\"count\":0,"))
+    assertTrue(json.contains("\"stableRefs\":"))
+    assertTrue(json.endsWith("}"))
+}
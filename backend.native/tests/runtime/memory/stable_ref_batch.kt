@@ -0,0 +1,50 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.memory.stable_ref_batch
+
+import kotlin.test.*
+
+import kotlin.native.internal.MemoryStatistics
+import kotlinx.cinterop.*
+
+class Data(val value: Int)
+
+@Test fun createAndDisposeAll() {
+    val objects = Array(100) { Data(it) }
+    memScoped {
+        val pointers = allocArray<COpaquePointerVar>(objects.size)
+        StableRef.createAll(objects, pointers)
+        for (index in objects.indices) {
+            assertSame(objects[index], pointers[index]!!.asStableRef<Data>().get())
+        }
+        StableRef.disposeAll(pointers, objects.size)
+    }
+}
+
+@Test fun disposeOneByOne() {
+    val objects = arrayOf(Data(1), Data(2))
+    memScoped {
+        val pointers = allocArray<COpaquePointerVar>(objects.size)
+        StableRef.createAll(objects, pointers)
+        pointers[0]!!.asStableRef<Data>().dispose()
+        assertEquals(2, pointers[1]!!.asStableRef<Data>().get().value)
+        pointers[1]!!.asStableRef<Data>().dispose()
+    }
+}
+
+// More than one chunk of the runtime batch.
+@Test fun countedOnce() {
+    val objects = Array(150) { Data(it) }
+    val before = MemoryStatistics.stableRefs
+    memScoped {
+        val pointers = allocArray<COpaquePointerVar>(objects.size)
+        StableRef.createAll(objects, pointers)
+        assertEquals(before + objects.size, MemoryStatistics.stableRefs)
+        assertEquals(149, pointers[149]!!.asStableRef<Data>().get().value)
+        StableRef.disposeAll(pointers, objects.size)
+    }
+    assertEquals(before, MemoryStatistics.stableRefs)
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.memory.tracing
+
+import kotlin.test.*
+
+import kotlin.native.concurrent.*
+import kotlin.native.internal.GC
+import kotlin.native.internal.Tracing
+import kotlinx.cinterop.*
+import platform.posix.*
+
+class Node(val next: Node?)
+
+private fun readFile(path: String): String {
+    val file = fopen(path, "r") ?: error("Cannot open $path")
+    try {
+        val result = StringBuilder()
+        memScoped {
+            val buffer = allocArray<ByteVar>(1024)
+            while (true) {
+                val line = fgets(buffer, 1024, file)?.toKString() ?: break
+                result.append(line)
+            }
+        }
+        return result.toString()
+    } finally {
+        fclose(file)
+    }
+}
+
+@Test fun trace() {
+    Tracing.clear()
+    Tracing.start()
+    assertTrue(Tracing.isEnabled)
+    GC.collect()
+    Node(null).freeze()
+    val worker = Worker.start()
+    assertEquals(42, worker.execute(TransferMode.SAFE, { 41 }) { it + 1 }.result)
+    worker.requestTermination().result
+    Tracing.stop()
+    assertFalse(Tracing.isEnabled)
+
+    val path = "tracing.json.tmp"
+    assertTrue(Tracing.writeTrace(path))
+    val trace = readFile(path)
+    remove(path)
+    assertTrue(trace.startsWith("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["))
+    assertTrue(trace.contains("\"name\":\"garbageCollect\""))
+    assertTrue(trace.contains("\"name\":\"processDecrements\""))
+    assertTrue(trace.contains("\"name\":\"freezeSubgraph\""))
+    assertTrue(trace.contains("\"cat\":\"worker\",\"name\":\"job\""))
+    Tracing.clear()
+}
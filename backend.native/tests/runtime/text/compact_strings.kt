@@ -0,0 +1,72 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.text.compact_strings
+
+import kotlin.test.*
+
+// Compiled with `-Xcompact-strings`: literals are UTF-16, while strings built at runtime from Latin-1 chars are
+// stored one byte per char, so each check below mixes the two coders.
+
+private fun latin1(string: String): String = string.toCharArray().concatToString()
+
+@Test fun equalsAndHashCode() {
+    val literal = "Hello, Kotlin/Native éÿ"
+    val compact = latin1(literal)
+    assertEquals(literal, compact)
+    assertEquals(compact, literal)
+    assertEquals(literal.hashCode(), compact.hashCode())
+    assertNotEquals(latin1("Hello"), "Hellp")
+    assertNotEquals("HelloĀ", latin1("Helloÿ"))
+    assertEquals(setOf(literal), setOf(compact))
+}
+
+@Test fun compareTo() {
+    assertEquals(0, latin1("abc").compareTo("abc"))
+    assertTrue(latin1("abc") < "abd")
+    assertTrue("abd" > latin1("abc"))
+    assertTrue(latin1("ab") < "abc")
+    // Order by char value, not by the bytes of the storage.
+    assertTrue(latin1("aÿ") < "aĀ")
+    assertTrue("aĀ" > latin1("aÿ"))
+    assertTrue(latin1("é") > "z")
+}
+
+@Test fun subSequence() {
+    val literal = "0123456789ÿ"
+    val compact = latin1(literal)
+    assertEquals("345", compact.substring(3, 6))
+    assertEquals(literal.substring(3, 6), compact.substring(3, 6))
+    assertEquals("9ÿ", compact.subSequence(9, 11).toString())
+    assertEquals("", compact.substring(5, 5))
+    assertEquals(compact, literal.substring(0))
+    assertEquals("Āÿ", ("Ā" + compact).substring(0, 1) + compact.substring(10))
+}
+
+@Test fun indexOf() {
+    val literal = "abcabcÿabc"
+    val compact = latin1(literal)
+    assertEquals(3, compact.indexOf("abc", 1))
+    assertEquals(3, literal.indexOf(latin1("abc"), 1))
+    assertEquals(6, compact.indexOf("ÿa"))
+    assertEquals(7, compact.lastIndexOf(latin1("abc")))
+    assertEquals(6, compact.indexOf('ÿ'))
+    assertEquals(-1, compact.indexOf('Ā'))
+    assertEquals(-1, compact.indexOf("cĀ"))
+    assertEquals(-1, "cĀ".indexOf(compact))
+    assertTrue(compact.contains(latin1("cÿa")))
+    assertTrue(compact.startsWith("abc"))
+    assertTrue(compact.endsWith(latin1("ÿabc")))
+}
+
+@Test fun caseConversion() {
+    // The upper case of U+00FF is U+0178, which doesn't fit into Latin-1.
+    val compact = latin1("yÿ")
+    assertEquals("YŸ", compact.toUpperCase())
+    assertEquals("Ÿ", latin1("ÿ").toUpperCase())
+    assertEquals("yÿ", latin1("Yÿ").toLowerCase())
+    assertEquals("ABCÉ", latin1("abcé").toUpperCase())
+    assertEquals(latin1("abc"), "ABC".toLowerCase())
+}
@@ -58,6 +58,12 @@ data class Data(var int: Int)
     a8.freeze()
     assertFailsWith<InvalidMutabilityException> { a8[1] = 2.0 }
 
+    val a9 = IntArray(2)
+    a9.fill(1)
+    a9.freeze()
+    assertFailsWith<InvalidMutabilityException> { a9.fill(2) }
+    assertFailsWith<InvalidMutabilityException> { intArrayOf(3).copyInto(a9) }
+
     // Ensure that String and integral boxes are frozen by default, by passing local to the worker.
     val worker = Worker.start()
     var data: Any = "Hello" + " " + "world"
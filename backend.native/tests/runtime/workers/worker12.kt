@@ -0,0 +1,58 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.workers.worker12
+
+import kotlin.test.*
+
+import kotlin.native.concurrent.*
+import kotlin.system.getTimeMillis
+
+@SharedImmutable
+val release = AtomicInt(0)
+
+@SharedImmutable
+val waiting = AtomicInt(0)
+
+@Test fun runTest() {
+    val blocked = Worker.start()
+    val other = Worker.start()
+
+    val blockedFuture = blocked.execute(TransferMode.SAFE, { Unit }) {
+        while (release.value == 0) {}
+        1
+    }
+    val otherFuture = other.execute(TransferMode.SAFE, { Unit }) { 2 }
+
+    // Completion of a future outside of the waited set must not end the wait.
+    assertEquals(3, other.execute(TransferMode.SAFE, { Unit }) { 3 }.result)
+    assertEquals(emptySet(), waitForMultipleFutures(listOf(blockedFuture), 100))
+
+    assertEquals(setOf(otherFuture), waitForMultipleFutures(listOf(otherFuture), 10000))
+    assertEquals(setOf(otherFuture), waitForMultipleFutures(listOf(blockedFuture, otherFuture), 10000))
+    assertEquals(2, otherFuture.result)
+
+    // Nor must completions of other futures wake up a waiter that is already blocked.
+    val waiter = Worker.start()
+    val waitedMillis = waiter.execute(TransferMode.SAFE, { blockedFuture }) { future ->
+        waiting.value = 1
+        val start = getTimeMillis()
+        if (waitForMultipleFutures(listOf(future), 1000).isEmpty()) getTimeMillis() - start else -1L
+    }
+    while (waiting.value == 0) {}
+    repeat(10) { index ->
+        assertEquals(index, other.execute(TransferMode.SAFE, { index }) { it }.result)
+    }
+    assertTrue(waitedMillis.result >= 900)
+
+    release.value = 1
+    assertEquals(setOf(blockedFuture), waitForMultipleFutures(listOf(blockedFuture), -1))
+    assertEquals(1, blockedFuture.result)
+
+    blocked.requestTermination().result
+    other.requestTermination().result
+    waiter.requestTermination().result
+    println("OK")
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package runtime.workers.worker13
+
+import kotlin.test.*
+
+import kotlin.native.concurrent.*
+import kotlin.native.internal.GC
+import kotlin.native.ref.WeakReference
+
+class Data(val x: Int)
+
+// Weak references are read concurrently while the referent dies.
+@Test fun runTest() {
+    val workers = Array(4) { Worker.start() }
+    repeat(10) {
+        var data: Data? = Data(42).freeze()
+        val reference = WeakReference(data!!).freeze()
+        val started = AtomicInt(0).freeze()
+        val futures = workers.map {
+            it.execute(TransferMode.SAFE, { Pair(reference, started) }) { (reference, started) ->
+                started.increment()
+                var cleared = false
+                repeat(100_000) {
+                    val value = reference.get()
+                    if (value == null) {
+                        cleared = true
+                    } else {
+                        // Once cleared, a weak reference never yields the object again.
+                        assertFalse(cleared)
+                        assertEquals(42, value.x)
+                    }
+                }
+            }
+        }
+        while (started.value < workers.size) {}
+        data = null
+        GC.collect()
+        futures.forEach { it.result }
+    }
+    workers.forEach { it.requestTermination().result }
+    println("OK")
+}
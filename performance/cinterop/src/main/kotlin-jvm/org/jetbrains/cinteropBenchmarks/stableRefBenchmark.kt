@@ -0,0 +1,16 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.stableRefBenchmarks
+
+actual class StableRefBenchmark actual constructor() {
+    actual fun stableRefBenchmark() {
+        error("Benchmark stableRefBenchmark is unsupported on JVM!")
+    }
+
+    actual fun stableRefsBenchmark() {
+        error("Benchmark stableRefsBenchmark is unsupported on JVM!")
+    }
+}
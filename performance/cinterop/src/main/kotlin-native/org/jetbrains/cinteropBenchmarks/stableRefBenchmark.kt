@@ -0,0 +1,36 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.stableRefBenchmarks
+
+import kotlinx.cinterop.*
+
+// Divide the time by this to get the cost per reference.
+const val stableRefCount = 10000
+
+// Passes the objects to native code as stable references and releases them, as a host holding Kotlin callbacks does.
+actual class StableRefBenchmark actual constructor() {
+    val objects = Array<Any>(stableRefCount) { index -> { index } }
+
+    actual fun stableRefBenchmark() {
+        memScoped {
+            val pointers = allocArray<COpaquePointerVar>(stableRefCount)
+            for (index in 0 until stableRefCount) {
+                pointers[index] = StableRef.create(objects[index]).asCPointer()
+            }
+            for (index in 0 until stableRefCount) {
+                pointers[index]!!.asStableRef<Any>().dispose()
+            }
+        }
+    }
+
+    actual fun stableRefsBenchmark() {
+        memScoped {
+            val pointers = allocArray<COpaquePointerVar>(stableRefCount)
+            StableRef.createAll(objects, pointers)
+            StableRef.disposeAll(pointers, stableRefCount)
+        }
+    }
+}
@@ -18,6 +18,7 @@
 import org.jetbrains.structsProducedByMacrosBenchmarks.*
 import org.jetbrains.benchmarksLauncher.*
 import org.jetbrains.structsBenchmarks.*
+import org.jetbrains.stableRefBenchmarks.*
 import org.jetbrains.typesBenchmarks.*
 import kotlinx.cli.*
 
@@ -32,7 +33,9 @@ class CinteropLauncher : Launcher() {
                     "stringToKotlin" to BenchmarkEntryWithInit.create(::StringBenchmark, { stringToKotlinBenchmark() }),
                     "intMatrix" to BenchmarkEntryWithInit.create(::IntMatrixBenchmark, { intMatrixBenchmark() }),
                     "int" to BenchmarkEntryWithInit.create(::IntBenchmark, { intBenchmark() }),
-                    "boxedInt" to BenchmarkEntryWithInit.create(::BoxedIntBenchmark, { boxedIntBenchmark() })
+                    "boxedInt" to BenchmarkEntryWithInit.create(::BoxedIntBenchmark, { boxedIntBenchmark() }),
+                    "stableRef" to BenchmarkEntryWithInit.create(::StableRefBenchmark, { stableRefBenchmark() }),
+                    "stableRefs" to BenchmarkEntryWithInit.create(::StableRefBenchmark, { stableRefsBenchmark() })
             )
     )
 }
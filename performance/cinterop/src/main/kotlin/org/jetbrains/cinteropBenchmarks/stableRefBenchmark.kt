@@ -0,0 +1,11 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.stableRefBenchmarks
+
+expect class StableRefBenchmark() {
+    fun stableRefBenchmark()
+    fun stableRefsBenchmark()
+}
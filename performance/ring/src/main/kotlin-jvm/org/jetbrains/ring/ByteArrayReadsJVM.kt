@@ -0,0 +1,19 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+actual fun ByteArray.readIntAt(index: Int): Int =
+        (this[index].toInt() and 0xff) or
+                ((this[index + 1].toInt() and 0xff) shl 8) or
+                ((this[index + 2].toInt() and 0xff) shl 16) or
+                ((this[index + 3].toInt() and 0xff) shl 24)
+
+actual fun ByteArray.readIntsAt(index: Int, destination: IntArray) {
+    ByteBuffer.wrap(this, index, destination.size * 4).order(ByteOrder.LITTLE_ENDIAN).asIntBuffer().get(destination)
+}
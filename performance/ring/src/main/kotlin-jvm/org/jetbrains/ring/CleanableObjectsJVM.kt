@@ -0,0 +1,31 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import java.util.concurrent.atomic.AtomicInteger
+
+private class Resource(val id: Int, val cleaned: AtomicInteger) {
+    fun clean() {
+        cleaned.incrementAndGet()
+    }
+}
+
+// JVM has no deterministic cleaners, so run the cleanup actions directly to measure the rest of the work.
+actual class CleanableObjects actual constructor() {
+    private val cleaned = AtomicInteger(0)
+
+    actual fun createAndClean(count: Int) {
+        cleaned.set(0)
+        val resources = arrayOfNulls<Resource>(count)
+        for (i in 0 until count) {
+            resources[i] = Resource(i, cleaned)
+        }
+        for (resource in resources) {
+            resource!!.clean()
+        }
+        while (cleaned.get() < count) {}
+    }
+}
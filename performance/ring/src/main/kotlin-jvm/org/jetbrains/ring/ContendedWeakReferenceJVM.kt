@@ -0,0 +1,34 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import java.lang.ref.WeakReference
+import java.util.concurrent.Callable
+import java.util.concurrent.Executors
+
+private class WeakTarget(val value: Int)
+
+actual class ContendedWeakReference actual constructor(private val threadCount: Int) {
+    // Keeps the target alive for the whole benchmark.
+    private val target = WeakTarget(42)
+    private val reference = WeakReference(target)
+    private val executor = Executors.newFixedThreadPool(threadCount) { runnable ->
+        Thread(runnable, "WeakReferenceReader").apply { isDaemon = true }
+    }
+
+    actual fun readConcurrently(count: Int): Int {
+        val futures = (0 until threadCount).map {
+            executor.submit(Callable {
+                var live = 0
+                for (i in 0 until count) {
+                    if (reference.get() != null) live++
+                }
+                live
+            })
+        }
+        return futures.sumBy { it.get() }
+    }
+}
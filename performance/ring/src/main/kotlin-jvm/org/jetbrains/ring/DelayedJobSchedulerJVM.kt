@@ -0,0 +1,32 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.ScheduledThreadPoolExecutor
+import java.util.concurrent.TimeUnit
+
+actual class DelayedJobScheduler actual constructor() {
+    private val executor = ScheduledThreadPoolExecutor(1) { runnable ->
+        Thread(runnable, "DelayedJobScheduler").apply { isDaemon = true }
+    }
+
+    actual fun scheduleAndAwait(delaysMicroseconds: LongArray) {
+        val latch = CountDownLatch(delaysMicroseconds.size)
+        val job = Runnable { latch.countDown() }
+        for (delay in delaysMicroseconds) {
+            executor.schedule(job, delay, TimeUnit.MICROSECONDS)
+        }
+        latch.await()
+    }
+
+    actual fun schedule(delaysMicroseconds: LongArray) {
+        val job = Runnable {}
+        for (delay in delaysMicroseconds) {
+            executor.schedule(job, delay, TimeUnit.MICROSECONDS)
+        }
+    }
+}
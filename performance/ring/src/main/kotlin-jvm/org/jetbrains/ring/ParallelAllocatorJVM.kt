@@ -0,0 +1,21 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import java.util.concurrent.Callable
+import java.util.concurrent.Executors
+
+actual class ParallelAllocator actual constructor(workerCount: Int) {
+    private val executor = Executors.newFixedThreadPool(workerCount) { runnable ->
+        Thread(runnable, "ParallelAllocator").apply { isDaemon = true }
+    }
+    private val workerCount = workerCount
+
+    actual fun allocateOnEachWorker(objectsPerWorker: Int): Long {
+        val futures = List(workerCount) { executor.submit(Callable { allocateNodes(objectsPerWorker) }) }
+        return futures.fold(0L) { sum, future -> sum + future.get() }
+    }
+}
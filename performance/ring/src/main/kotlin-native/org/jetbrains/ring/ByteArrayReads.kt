@@ -0,0 +1,12 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+actual fun ByteArray.readIntAt(index: Int): Int = getIntAt(index)
+
+actual fun ByteArray.readIntsAt(index: Int, destination: IntArray) {
+    getIntsAt(index, destination)
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.*
+import kotlin.native.internal.*
+
+@SharedImmutable
+private val cleaned = AtomicInt(0)
+
+private class Resource(val id: Int)
+
+actual class CleanableObjects actual constructor() {
+    @OptIn(ExperimentalStdlibApi::class)
+    actual fun createAndClean(count: Int) {
+        cleaned.value = 0
+        val cleaners = arrayOfNulls<Cleaner>(count)
+        for (i in 0 until count) {
+            cleaners[i] = createCleaner(Resource(i)) { cleaned.increment() }
+        }
+        cleaners.fill(null)
+        GC.collect()
+        while (cleaned.value < count) {}
+    }
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.*
+import kotlin.native.ref.WeakReference
+
+private class WeakTarget(val value: Int)
+
+actual class ContendedWeakReference actual constructor(threadCount: Int) {
+    // Keeps the target alive for the whole benchmark.
+    private val target = WeakTarget(42).freeze()
+    private val reference = WeakReference(target).freeze()
+    private val workers = Array(threadCount) { Worker.start(name = "WeakReferenceReader$it") }
+
+    actual fun readConcurrently(count: Int): Int {
+        val futures = workers.map { worker ->
+            worker.execute(TransferMode.SAFE, { Pair(reference, count) }) { (reference, count) ->
+                var live = 0
+                for (i in 0 until count) {
+                    if (reference.get() != null) live++
+                }
+                live
+            }
+        }
+        return futures.sumBy { it.result }
+    }
+}
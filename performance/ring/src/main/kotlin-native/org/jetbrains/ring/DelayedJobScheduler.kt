@@ -0,0 +1,29 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.*
+
+actual class DelayedJobScheduler actual constructor() {
+    private val worker = Worker.start(name = "DelayedJobScheduler")
+
+    actual fun scheduleAndAwait(delaysMicroseconds: LongArray) {
+        // Termination of a worker awaits the jobs it has pending with `executeAfter`.
+        val awaitedWorker = Worker.start(name = "DelayedJobScheduler")
+        val job = {}.freeze()
+        for (delay in delaysMicroseconds) {
+            awaitedWorker.executeAfter(delay, job)
+        }
+        awaitedWorker.requestTermination().result
+    }
+
+    actual fun schedule(delaysMicroseconds: LongArray) {
+        val job = {}.freeze()
+        for (delay in delaysMicroseconds) {
+            worker.executeAfter(delay, job)
+        }
+    }
+}
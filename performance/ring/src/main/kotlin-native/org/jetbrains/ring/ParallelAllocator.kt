@@ -0,0 +1,19 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import kotlin.native.concurrent.*
+
+actual class ParallelAllocator actual constructor(workerCount: Int) {
+    private val workers = Array(workerCount) { Worker.start(name = "ParallelAllocator#$it") }
+
+    actual fun allocateOnEachWorker(objectsPerWorker: Int): Long {
+        val futures = workers.map { worker ->
+            worker.execute(TransferMode.SAFE, { objectsPerWorker }) { count -> allocateNodes(count) }
+        }
+        return futures.fold(0L) { sum, future -> sum + future.result }
+    }
+}
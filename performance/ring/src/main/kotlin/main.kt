@@ -179,6 +179,7 @@ class RingLauncher : Launcher() {
                     "Singleton.access" to BenchmarkEntryWithInit.create(::SingletonBenchmark, { access() }),
                     "String.stringConcat" to BenchmarkEntryWithInit.create(::StringBenchmark, { stringConcat() }),
                     "String.stringConcatNullable" to BenchmarkEntryWithInit.create(::StringBenchmark, { stringConcatNullable() }),
+                    "String.repeatedConcatenation" to BenchmarkEntryWithInit.create(::StringBenchmark, { repeatedConcatenation() }),
                     "String.stringBuilderConcat" to BenchmarkEntryWithInit.create(::StringBenchmark, { stringBuilderConcat() }),
                     "String.stringBuilderConcatNullable" to BenchmarkEntryWithInit.create(::StringBenchmark, { stringBuilderConcatNullable() }),
                     "String.summarizeSplittedCsv" to BenchmarkEntryWithInit.create(::StringBenchmark, { summarizeSplittedCsv() }),
@@ -210,7 +211,57 @@ class RingLauncher : Launcher() {
                     "Casts.interfaceCast" to BenchmarkEntryWithInit.create(::CastsBenchmark, { interfaceCast() }),
                     "LocalObjects.localArray" to BenchmarkEntryWithInit.create(::LocalObjectsBenchmark, { localArray() }),
                     "LinkedListWithAtomicsBenchmark" to BenchmarkEntryWithInit.create(::LinkedListWithAtomicsBenchmark, { ensureNext() }),
-                    "Inheritance.baseCalls" to BenchmarkEntryWithInit.create(::InheritanceBenchmark, { baseCalls() })
+                    "DelayedJobs.shortTimeouts" to BenchmarkEntryWithInit.create(::DelayedJobsBenchmark, { shortTimeouts() }),
+                    "DelayedJobs.timeoutChurn" to BenchmarkEntryWithInit.create(::DelayedJobsBenchmark, { timeoutChurn() }),
+                    "Cleaner.disposeCleaners" to BenchmarkEntryWithInit.create(::CleanerBenchmark, { disposeCleaners() }),
+                    "WeakReference.uncontendedGet" to BenchmarkEntryWithInit.create(::WeakReferenceBenchmark, { uncontendedGet() }),
+                    "WeakReference.contendedGet" to BenchmarkEntryWithInit.create(::WeakReferenceBenchmark, { contendedGet() }),
+                    "NumberConversion.doubleToString" to BenchmarkEntryWithInit.create(::NumberConversionBenchmark, { doubleToString() }),
+                    "NumberConversion.floatToString" to BenchmarkEntryWithInit.create(::NumberConversionBenchmark, { floatToString() }),
+                    "NumberConversion.parseDouble" to BenchmarkEntryWithInit.create(::NumberConversionBenchmark, { parseDouble() }),
+                    "NumberConversion.parseFloat" to BenchmarkEntryWithInit.create(::NumberConversionBenchmark, { parseFloat() }),
+                    "NumberConversion.intToString" to BenchmarkEntryWithInit.create(::NumberConversionBenchmark, { intToString() }),
+                    "NumberConversion.longToString" to BenchmarkEntryWithInit.create(::NumberConversionBenchmark, { longToString() }),
+                    "NumberConversion.logMessages" to BenchmarkEntryWithInit.create(::NumberConversionBenchmark, { logMessages() }),
+                    "Unicode.cyrillicCaseConversion" to BenchmarkEntryWithInit.create(::UnicodeBenchmark, { cyrillicCaseConversion() }),
+                    "Unicode.greekCaseConversion" to BenchmarkEntryWithInit.create(::UnicodeBenchmark, { greekCaseConversion() }),
+                    "Unicode.cjkCaseConversion" to BenchmarkEntryWithInit.create(::UnicodeBenchmark, { cjkCaseConversion() }),
+                    "Unicode.charCategories" to BenchmarkEntryWithInit.create(::UnicodeBenchmark, { charCategories() }),
+                    "Unicode.canonicalEquivalenceMatch" to BenchmarkEntryWithInit.create(::UnicodeBenchmark, { canonicalEquivalenceMatch() }),
+                    "CompactString.concatenation" to BenchmarkEntryWithInit.create(::CompactStringBenchmark, { concatenation() }),
+                    "CompactString.wordFrequencies" to BenchmarkEntryWithInit.create(::CompactStringBenchmark, { wordFrequencies() }),
+                    "CompactString.search" to BenchmarkEntryWithInit.create(::CompactStringBenchmark, { search() }),
+                    "CompactString.utf8RoundTrip" to BenchmarkEntryWithInit.create(::CompactStringBenchmark, { utf8RoundTrip() }),
+                    "CompactString.retainSubstrings" to BenchmarkEntryWithInit.create(::CompactStringBenchmark, { retainSubstrings() }),
+                    "ObjectArrayCopy.copyOf" to BenchmarkEntryWithInit.create(::ObjectArrayCopyBenchmark, { copyOf() }),
+                    "ObjectArrayCopy.copyInto" to BenchmarkEntryWithInit.create(::ObjectArrayCopyBenchmark, { copyInto() }),
+                    "ObjectArrayCopy.copyIntoOverlapping" to BenchmarkEntryWithInit.create(::ObjectArrayCopyBenchmark, { copyIntoOverlapping() }),
+                    "ObjectArrayCopy.fill" to BenchmarkEntryWithInit.create(::ObjectArrayCopyBenchmark, { fill() }),
+                    "ObjectArrayCopy.arrayListGrowth" to BenchmarkEntryWithInit.create(::ObjectArrayCopyBenchmark, { arrayListGrowth() }),
+                    "PrimitiveArrayWrite.intArrayWriteLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayWriteBenchmark, { intArrayWriteLoop() }),
+                    "PrimitiveArrayWrite.byteArrayWriteLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayWriteBenchmark, { byteArrayWriteLoop() }),
+                    "PrimitiveArrayWrite.intArrayIncrementLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayWriteBenchmark, { intArrayIncrementLoop() }),
+                    "PrimitiveArrayWrite.alternatingArraysWriteLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayWriteBenchmark, { alternatingArraysWriteLoop() }),
+                    "PrimitiveArrayKernels.intArrayContentEquals" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { intArrayContentEquals() }),
+                    "PrimitiveArrayKernels.intArrayContentEqualsLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { intArrayContentEqualsLoop() }),
+                    "PrimitiveArrayKernels.doubleArrayContentEquals" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { doubleArrayContentEquals() }),
+                    "PrimitiveArrayKernels.doubleArrayContentEqualsLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { doubleArrayContentEqualsLoop() }),
+                    "PrimitiveArrayKernels.intArrayContentHashCode" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { intArrayContentHashCode() }),
+                    "PrimitiveArrayKernels.intArrayContentHashCodeLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { intArrayContentHashCodeLoop() }),
+                    "PrimitiveArrayKernels.intArrayIndexOf" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { intArrayIndexOf() }),
+                    "PrimitiveArrayKernels.intArrayIndexOfLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { intArrayIndexOfLoop() }),
+                    "PrimitiveArrayKernels.intArrayFill" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { intArrayFill() }),
+                    "PrimitiveArrayKernels.intArrayFillLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { intArrayFillLoop() }),
+                    "PrimitiveArrayKernels.byteArrayGetInts" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { byteArrayGetInts() }),
+                    "PrimitiveArrayKernels.byteArrayGetIntsLoop" to BenchmarkEntryWithInit.create(::PrimitiveArrayKernelsBenchmark, { byteArrayGetIntsLoop() }),
+                    "MultiWorkerAllocation.allocateOnOneWorker" to BenchmarkEntryWithInit.create(::MultiWorkerAllocationBenchmark, { allocateOnOneWorker() }),
+                    "MultiWorkerAllocation.allocateOnFourWorkers" to BenchmarkEntryWithInit.create(::MultiWorkerAllocationBenchmark, { allocateOnFourWorkers() }),
+                    "MultiWorkerAllocation.allocateOnFourWorkersEach" to BenchmarkEntryWithInit.create(::MultiWorkerAllocationBenchmark, { allocateOnFourWorkersEach() }),
+                    "Inheritance.baseCalls" to BenchmarkEntryWithInit.create(::InheritanceBenchmark, { baseCalls() }),
+                    "IdentityHashMap.put" to BenchmarkEntryWithInit.create(::IdentityHashMapBenchmark, { put() }),
+                    "IdentityHashMap.get" to BenchmarkEntryWithInit.create(::IdentityHashMapBenchmark, { get() }),
+                    "IdentityHashMap.getMissing" to BenchmarkEntryWithInit.create(::IdentityHashMapBenchmark, { getMissing() }),
+                    "IdentityHashMap.putNewKeys" to BenchmarkEntryWithInit.create(::IdentityHashMapBenchmark, { putNewKeys() })
             )
     )
 }
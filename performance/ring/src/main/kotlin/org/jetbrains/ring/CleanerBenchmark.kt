@@ -0,0 +1,25 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+/**
+ * Creates objects with cleanup actions attached.
+ */
+expect class CleanableObjects() {
+    /**
+     * Creates [count] objects with cleanup actions, drops them and waits until all the actions have run.
+     */
+    fun createAndClean(count: Int)
+}
+
+open class CleanerBenchmark {
+    private val objects = CleanableObjects()
+
+    //Benchmark
+    fun disposeCleaners() {
+        objects.createAndClean(BENCHMARK_SIZE)
+    }
+}
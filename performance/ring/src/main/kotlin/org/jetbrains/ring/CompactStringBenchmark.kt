@@ -0,0 +1,66 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Blackhole
+import org.jetbrains.benchmarksLauncher.Random
+
+// Operations on Latin-1 text. Compare runs with and without `-PcompilerArgs=-Xcompact-strings`.
+open class CompactStringBenchmark {
+    private val words = Array(BENCHMARK_SIZE) {
+        val builder = StringBuilder()
+        repeat(Random.nextInt(10) + 2) {
+            builder.append(if (Random.nextInt(10) == 0) 'à' + Random.nextInt(26) else 'a' + Random.nextInt(26))
+        }
+        builder.toString()
+    }
+    private val text = words.joinToString(" ")
+    private val utf8 = text.encodeToByteArray()
+
+    //Benchmark
+    fun concatenation() {
+        var length = 0
+        for (index in 1 until words.size) {
+            length += (words[index - 1] + " " + words[index]).length
+        }
+        Blackhole.consume(length)
+    }
+
+    //Benchmark
+    fun wordFrequencies() {
+        val frequencies = HashMap<String, Int>()
+        for (word in text.split(' ')) {
+            frequencies[word] = (frequencies[word] ?: 0) + 1
+        }
+        Blackhole.consume(frequencies)
+    }
+
+    //Benchmark
+    fun search() {
+        var found = 0
+        for (index in 0 until words.size step 10) {
+            if (text.indexOf(words[index]) >= 0) found++
+        }
+        Blackhole.consume(found)
+    }
+
+    //Benchmark
+    fun utf8RoundTrip() {
+        Blackhole.consume(utf8.decodeToString().encodeToByteArray())
+    }
+
+    //Benchmark
+    fun retainSubstrings(): List<String> {
+        // Keeps all substrings alive at once, so the heap size depends on the string representation.
+        val result = ArrayList<String>(words.size)
+        var start = 0
+        for (word in words) {
+            result.add(text.substring(start, start + word.length).toUpperCase())
+            start += word.length + 1
+        }
+        return result
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Random
+
+/**
+ * Schedules jobs for delayed execution on a single background thread.
+ */
+expect class DelayedJobScheduler() {
+    /**
+     * Schedules a job after each of [delaysMicroseconds] and waits until all of them have run.
+     */
+    fun scheduleAndAwait(delaysMicroseconds: LongArray)
+
+    /**
+     * Schedules a job after each of [delaysMicroseconds] without waiting for them.
+     */
+    fun schedule(delaysMicroseconds: LongArray)
+}
+
+open class DelayedJobsBenchmark {
+    private val scheduler = DelayedJobScheduler()
+    private val shortDelays = LongArray(BENCHMARK_SIZE) { Random.nextInt(2000).toLong() }
+    // Timeouts that are far enough to be mostly pending while new ones keep arriving.
+    private val longDelays = LongArray(BENCHMARK_SIZE) { 10_000L + Random.nextInt(100_000) }
+
+    //Benchmark
+    fun shortTimeouts() {
+        scheduler.scheduleAndAwait(shortDelays)
+    }
+
+    //Benchmark
+    fun timeoutChurn() {
+        scheduler.schedule(longDelays)
+    }
+}
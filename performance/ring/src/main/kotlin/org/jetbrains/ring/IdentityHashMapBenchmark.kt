@@ -0,0 +1,57 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Blackhole
+
+/**
+ * Hash maps and sets keyed by objects using the identity [hashCode].
+ */
+open class IdentityHashMapBenchmark {
+    class Key
+
+    private val keys = Array(BENCHMARK_SIZE) { Key() }
+    private val map = HashMap<Key, Int>().apply {
+        keys.forEachIndexed { index, key -> put(key, index) }
+    }
+    private val missingKeys = Array(BENCHMARK_SIZE) { Key() }
+
+    //Benchmark
+    fun put() {
+        val map = HashMap<Key, Int>()
+        for (index in keys.indices) {
+            map[keys[index]] = index
+        }
+        Blackhole.consume(map.size)
+    }
+
+    //Benchmark
+    fun get() {
+        var sum = 0
+        for (key in keys) {
+            sum += map[key]!!
+        }
+        Blackhole.consume(sum)
+    }
+
+    //Benchmark
+    fun getMissing() {
+        var count = 0
+        for (key in missingKeys) {
+            if (map.containsKey(key)) count++
+        }
+        Blackhole.consume(count)
+    }
+
+    //Benchmark
+    fun putNewKeys() {
+        val set = HashSet<Key>()
+        repeat(BENCHMARK_SIZE) {
+            set.add(Key())
+        }
+        Blackhole.consume(set.size)
+    }
+}
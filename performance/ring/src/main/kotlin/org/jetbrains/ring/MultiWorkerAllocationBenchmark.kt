@@ -0,0 +1,60 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+/**
+ * Runs the same allocation-heavy job on a fixed set of background threads.
+ */
+expect class ParallelAllocator(workerCount: Int) {
+    /**
+     * Makes each worker build and drop short-lived lists with [objectsPerWorker] nodes in total,
+     * and waits for all of them to finish.
+     */
+    fun allocateOnEachWorker(objectsPerWorker: Int): Long
+}
+
+class AllocationNode(val value: Int, val next: AllocationNode?)
+
+/**
+ * Builds lists of [AllocationNode]s in chunks, so that most objects die young.
+ */
+fun allocateNodes(count: Int): Long {
+    var sum = 0L
+    var remaining = count
+    while (remaining > 0) {
+        val chunk = minOf(remaining, 100)
+        var list: AllocationNode? = null
+        for (i in 0 until chunk) {
+            list = AllocationNode(i, list)
+        }
+        while (list != null) {
+            sum += list.value
+            list = list.next
+        }
+        remaining -= chunk
+    }
+    return sum
+}
+
+open class MultiWorkerAllocationBenchmark {
+    private val singleWorker = ParallelAllocator(1)
+    private val fourWorkers = ParallelAllocator(4)
+
+    //Benchmark
+    fun allocateOnOneWorker(): Long {
+        return singleWorker.allocateOnEachWorker(BENCHMARK_SIZE * 4)
+    }
+
+    //Benchmark
+    fun allocateOnFourWorkers(): Long {
+        return fourWorkers.allocateOnEachWorker(BENCHMARK_SIZE)
+    }
+
+    //Benchmark
+    fun allocateOnFourWorkersEach(): Long {
+        return fourWorkers.allocateOnEachWorker(BENCHMARK_SIZE * 4)
+    }
+}
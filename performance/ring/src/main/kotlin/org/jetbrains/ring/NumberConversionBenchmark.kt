@@ -0,0 +1,77 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Blackhole
+import org.jetbrains.benchmarksLauncher.Random
+
+open class NumberConversionBenchmark {
+    // Mixes short decimals, typical for serialized data, with values that need all 17 digits.
+    private val doubles = DoubleArray(BENCHMARK_SIZE) {
+        if (it % 2 == 0) Random.nextInt(1000000) / 100.0 else Random.nextDouble(1e6) / 7.0
+    }
+    private val floats = FloatArray(BENCHMARK_SIZE) { doubles[it].toFloat() }
+    private val ints = IntArray(BENCHMARK_SIZE) { Random.nextInt(Int.MAX_VALUE) shr (it % 31) }
+    private val longs = LongArray(BENCHMARK_SIZE) { ints[it].toLong() * Random.nextInt(Int.MAX_VALUE) }
+    // Prices, geographic coordinates and shortest representations of random doubles.
+    private val decimalStrings = Array(BENCHMARK_SIZE) {
+        when (it % 3) {
+            0 -> "${Random.nextInt(100000)}.${Random.nextInt(10)}${Random.nextInt(10)}"
+            1 -> ((Random.nextInt(360000000) - 180000000) / 1e6).toString()
+            else -> (Random.nextDouble(1.0) * 1e-5).toString()
+        }
+    }
+
+    //Benchmark
+    fun doubleToString() {
+        for (value in doubles) {
+            Blackhole.consume(value.toString())
+        }
+    }
+
+    //Benchmark
+    fun floatToString() {
+        for (value in floats) {
+            Blackhole.consume(value.toString())
+        }
+    }
+
+    //Benchmark
+    fun parseDouble() {
+        for (string in decimalStrings) {
+            Blackhole.consume(string.toDouble())
+        }
+    }
+
+    //Benchmark
+    fun parseFloat() {
+        for (string in decimalStrings) {
+            Blackhole.consume(string.toFloat())
+        }
+    }
+
+    //Benchmark
+    fun intToString() {
+        for (value in ints) {
+            Blackhole.consume(value.toString())
+        }
+    }
+
+    //Benchmark
+    fun longToString() {
+        for (value in longs) {
+            Blackhole.consume(value.toString())
+        }
+    }
+
+    // Typical log line with a few numbers in a string template.
+    //Benchmark
+    fun logMessages() {
+        for (i in ints.indices) {
+            Blackhole.consume("request #$i of user ${ints[i]} took ${longs[i]} ns, status ${ints[i] % 600}")
+        }
+    }
+}
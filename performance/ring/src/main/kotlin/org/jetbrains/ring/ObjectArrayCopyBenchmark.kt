@@ -0,0 +1,47 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+open class ObjectArrayCopyBenchmark {
+    private val size = BENCHMARK_SIZE * 100
+    private val data: Array<Value> = classValues(size).toList().toTypedArray()
+    private val target = arrayOfNulls<Value>(size)
+
+    //Benchmark
+    fun copyOf(): Array<Value> {
+        return data.copyOf()
+    }
+
+    //Benchmark
+    fun copyInto(): Array<Value?> {
+        return data.copyInto(target)
+    }
+
+    //Benchmark
+    fun copyIntoOverlapping(): Array<Value?> {
+        // Shifts by one element, as `ArrayList.add(0, ...)` does, and back.
+        data.copyInto(target)
+        target.copyInto(target, 1, 0, size - 1)
+        target.copyInto(target, 0, 1, size)
+        return target
+    }
+
+    //Benchmark
+    fun fill(): Array<Value?> {
+        target.fill(data[0])
+        target.fill(null)
+        return target
+    }
+
+    //Benchmark
+    fun arrayListGrowth(): ArrayList<Value> {
+        val list = ArrayList<Value>()
+        for (item in data) {
+            list.add(item)
+        }
+        return list
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+/**
+ * Reads a little-endian [Int] out of [this] at byte [index].
+ */
+expect fun ByteArray.readIntAt(index: Int): Int
+
+/**
+ * Reads `destination.size` little-endian [Int]s out of [this] starting from byte [index] at once.
+ */
+expect fun ByteArray.readIntsAt(index: Int, destination: IntArray)
+
+/**
+ * Compares bulk operations on primitive arrays with the same operations written as per-element loops.
+ */
+open class PrimitiveArrayKernelsBenchmark {
+    private val size = BENCHMARK_SIZE * 10
+    private val ints = IntArray(size) { it * 31 }
+    private val otherInts = ints.copyOf()
+    private val doubles = DoubleArray(size) { it * 0.5 }
+    private val otherDoubles = doubles.copyOf()
+    private val bytes = ByteArray(size * 4) { it.toByte() }
+    private val intsFromBytes = IntArray(size)
+
+    //Benchmark
+    fun intArrayContentEquals(): Boolean {
+        return ints contentEquals otherInts
+    }
+
+    //Benchmark
+    fun intArrayContentEqualsLoop(): Boolean {
+        for (i in 0 until size) {
+            if (ints[i] != otherInts[i]) return false
+        }
+        return true
+    }
+
+    //Benchmark
+    fun doubleArrayContentEquals(): Boolean {
+        return doubles contentEquals otherDoubles
+    }
+
+    //Benchmark
+    fun doubleArrayContentEqualsLoop(): Boolean {
+        for (i in 0 until size) {
+            if (!doubles[i].equals(otherDoubles[i])) return false
+        }
+        return true
+    }
+
+    //Benchmark
+    fun intArrayContentHashCode(): Int {
+        return ints.contentHashCode()
+    }
+
+    //Benchmark
+    fun intArrayContentHashCodeLoop(): Int {
+        var result = 1
+        for (element in ints) {
+            result = 31 * result + element.hashCode()
+        }
+        return result
+    }
+
+    //Benchmark
+    fun intArrayIndexOf(): Int {
+        return ints.asList().indexOf(ints[size - 1])
+    }
+
+    //Benchmark
+    fun intArrayIndexOfLoop(): Int {
+        val element = ints[size - 1]
+        for (i in 0 until size) {
+            if (ints[i] == element) return i
+        }
+        return -1
+    }
+
+    //Benchmark
+    fun intArrayFill(): IntArray {
+        intsFromBytes.fill(42)
+        return intsFromBytes
+    }
+
+    //Benchmark
+    fun intArrayFillLoop(): IntArray {
+        for (i in 0 until size) {
+            intsFromBytes[i] = 42
+        }
+        return intsFromBytes
+    }
+
+    //Benchmark
+    fun byteArrayGetInts(): IntArray {
+        bytes.readIntsAt(0, intsFromBytes)
+        return intsFromBytes
+    }
+
+    //Benchmark
+    fun byteArrayGetIntsLoop(): IntArray {
+        for (i in 0 until size) {
+            intsFromBytes[i] = bytes.readIntAt(i * 4)
+        }
+        return intsFromBytes
+    }
+}
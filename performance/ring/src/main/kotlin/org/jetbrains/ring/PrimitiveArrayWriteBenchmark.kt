@@ -0,0 +1,46 @@
+/*
+ * Copyright 2010-2021 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+open class PrimitiveArrayWriteBenchmark {
+    private val size = BENCHMARK_SIZE * 10
+    private val ints = IntArray(size)
+    private val bytes = ByteArray(size)
+    private val otherInts = IntArray(size)
+
+    //Benchmark
+    fun intArrayWriteLoop(): IntArray {
+        for (i in 0 until size) {
+            ints[i] = i
+        }
+        return ints
+    }
+
+    //Benchmark
+    fun byteArrayWriteLoop(): ByteArray {
+        for (i in 0 until size) {
+            bytes[i] = i.toByte()
+        }
+        return bytes
+    }
+
+    //Benchmark
+    fun intArrayIncrementLoop(): IntArray {
+        for (i in 0 until size) {
+            ints[i]++
+        }
+        return ints
+    }
+
+    //Benchmark
+    fun alternatingArraysWriteLoop(): IntArray {
+        for (i in 0 until size) {
+            ints[i] = i
+            otherInts[i] = -i
+        }
+        return otherInts
+    }
+}
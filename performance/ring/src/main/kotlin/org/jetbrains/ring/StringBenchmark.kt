@@ -52,6 +52,15 @@ open class StringBenchmark {
         return string
     }
     
+    //Benchmark
+    open fun repeatedConcatenation(): String {
+        var string = ""
+        for (i in 0 until BENCHMARK_SIZE * 4) {
+            string = string + i + ':' + data[i % BENCHMARK_SIZE].length + ';'
+        }
+        return string
+    }
+    
     //Benchmark
     open fun stringBuilderConcat(): String {
         var string : StringBuilder = StringBuilder("")
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Blackhole
+import org.jetbrains.benchmarksLauncher.Random
+
+// Words of random letters from the given ranges, separated by spaces.
+private fun corpus(vararg ranges: CharRange): String {
+    val builder = StringBuilder()
+    repeat(BENCHMARK_SIZE) {
+        val range = ranges[Random.nextInt(ranges.size)]
+        repeat(Random.nextInt(8) + 1) {
+            builder.append(range.first + Random.nextInt(range.last - range.first + 1))
+        }
+        builder.append(' ')
+    }
+    return builder.toString()
+}
+
+open class UnicodeBenchmark {
+    private val cyrillic = corpus('А'..'Я', 'а'..'я')
+    private val greek = corpus('Α'..'Ρ', 'α'..'ω')
+    private val cjk = corpus('一'..'龥')
+    // Latin letters with combining accents.
+    private val decomposed = corpus('a'..'z', '\u0300'..'\u0304')
+    private val canonicalEquivalence = Regex("\u00E9", RegexOption.CANON_EQ)
+
+    //Benchmark
+    fun cyrillicCaseConversion() {
+        Blackhole.consume(cyrillic.toUpperCase())
+        Blackhole.consume(cyrillic.toLowerCase())
+    }
+
+    //Benchmark
+    fun greekCaseConversion() {
+        Blackhole.consume(greek.toUpperCase())
+        Blackhole.consume(greek.toLowerCase())
+    }
+
+    //Benchmark
+    fun cjkCaseConversion() {
+        Blackhole.consume(cjk.toUpperCase())
+        Blackhole.consume(cjk.toLowerCase())
+    }
+
+    //Benchmark
+    fun charCategories() {
+        var letters = 0
+        var upperCase = 0
+        for (text in arrayOf(cyrillic, greek, cjk)) {
+            for (char in text) {
+                if (char.isLetter()) letters++
+                if (char.isUpperCase()) upperCase++
+            }
+        }
+        Blackhole.consume(letters + upperCase)
+    }
+
+    //Benchmark
+    fun canonicalEquivalenceMatch() {
+        Blackhole.consume(canonicalEquivalence.findAll(decomposed).count())
+    }
+}
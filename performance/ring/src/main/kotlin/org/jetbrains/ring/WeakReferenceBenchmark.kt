@@ -0,0 +1,35 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.ring
+
+import org.jetbrains.benchmarksLauncher.Blackhole
+
+const val WEAK_REFERENCE_READER_COUNT = 4
+
+/**
+ * Reads a weak reference to a single shared object from several threads at once.
+ */
+expect class ContendedWeakReference(threadCount: Int) {
+    /**
+     * Dereferences the weak reference [count] times on each thread and returns the number of live reads.
+     */
+    fun readConcurrently(count: Int): Int
+}
+
+open class WeakReferenceBenchmark {
+    private val singleReader = ContendedWeakReference(1)
+    private val contendedReaders = ContendedWeakReference(WEAK_REFERENCE_READER_COUNT)
+
+    //Benchmark
+    fun uncontendedGet() {
+        Blackhole.consume(singleReader.readConcurrently(BENCHMARK_SIZE))
+    }
+
+    //Benchmark
+    fun contendedGet() {
+        Blackhole.consume(contendedReaders.readConcurrently(BENCHMARK_SIZE))
+    }
+}
@@ -70,7 +70,9 @@ bitcode {
     }
 
     create("std_alloc")
-    create("opt_alloc")
+    create("opt_alloc") {
+        includeRuntime()
+    }
 
     create("exceptionsSupport", file("src/exceptions_support")) {
         includeRuntime()
@@ -33,6 +33,20 @@ namespace {
 
 char debugBuffer[4096];
 
+// Latin-1 strings keep a flag in `count_` and store their chars as bytes.
+bool isLatin1String(KRef obj) {
+  return obj->type_info() == theStringTypeInfo && IsLatin1String(obj->array());
+}
+
+uint32_t arrayLength(KRef obj) {
+  return obj->type_info() == theStringTypeInfo ? StringLength(obj->array()) : obj->array()->count_;
+}
+
+// Element type of an array with the given extended type info.
+int32_t arrayElementType(KRef obj, const ExtendedTypeInfo* extendedTypeInfo) {
+  return isLatin1String(obj) ? Konan_RuntimeType::RT_INT8 : -extendedTypeInfo->fieldsCount_;
+}
+
 constexpr int runtimeTypeSize[] = {
     -1,                  // INVALID
     sizeof(ObjHeader*),  // OBJECT
@@ -142,7 +156,7 @@ int32_t Konan_DebugGetFieldCountImpl(KRef obj) {
     return 0;
 
   if (IsArray(obj))
-    return obj->array()->count_;
+    return arrayLength(obj);
 
   return extendedTypeInfo->fieldsCount_;
 }
@@ -158,7 +172,7 @@ int32_t Konan_DebugGetFieldTypeImpl(KRef obj, int32_t index) {
     return Konan_RuntimeType::RT_INVALID;
 
   if (extendedTypeInfo->fieldsCount_ < 0)
-    return -extendedTypeInfo->fieldsCount_;
+    return arrayElementType(obj, extendedTypeInfo);
 
   if (index >= extendedTypeInfo->fieldsCount_)
     return Konan_RuntimeType::RT_INVALID;
@@ -177,10 +191,10 @@ void* Konan_DebugGetFieldAddressImpl(KRef obj, int32_t index) {
     return nullptr;
 
    if (extendedTypeInfo->fieldsCount_ < 0) {
-     if (static_cast<uint32_t>(index) > obj->array()->count_)
+     if (static_cast<uint32_t>(index) >= arrayLength(obj))
         return nullptr;
 
-      int32_t typeIndex = -extendedTypeInfo->fieldsCount_;
+      int32_t typeIndex = arrayElementType(obj, extendedTypeInfo);
       return reinterpret_cast<uint8_t*>(obj->array())
           + alignUp(sizeof(struct ArrayHeader), runtimeTypeAlignment[typeIndex])
           + index * runtimeTypeSize[typeIndex];
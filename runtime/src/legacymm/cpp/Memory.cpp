@@ -32,6 +32,7 @@
 #endif
 
 #include "Alloc.h"
+#include "AllocationProfiler.hpp"
 #include "KAssert.h"
 #include "Atomic.h"
 #include "Cleaner.h"
@@ -39,13 +40,16 @@
 #include "CyclicCollector.h"
 #endif  // USE_CYCLIC_GC
 #include "Exceptions.h"
+#include "HeapSnapshot.hpp"
 #include "KString.h"
 #include "Memory.h"
 #include "MemoryPrivate.hpp"
+#include "MemoryStatistics.hpp"
 #include "Mutex.hpp"
 #include "Natives.h"
 #include "Porting.h"
 #include "Runtime.h"
+#include "Tracing.hpp"
 #include "Utils.hpp"
 #include "WorkerBoundReference.h"
 #include "Weak.h"
@@ -247,6 +251,67 @@ class CycleDetector : private kotlin::Pinned, public KonanAllocatorAware {
 
 #endif  // USE_CYCLE_DETECTOR
 
+// Globals and stable references are roots reference counting doesn't need to know about.
+// They are only tracked for heap snapshots.
+class HeapRoots {
+ public:
+  using Root = std::pair<kotlin::HeapSnapshotWriter::RootKind, ObjHeader*>;
+
+  static void addGlobal(ObjHeader** location) {
+    auto& roots = instance();
+    std::lock_guard<kotlin::SpinLock> guard(roots.lock_);
+    roots.globals_.push_back(location);
+  }
+
+  static void addStableRefs(KRef const* objects, size_t count) {
+    auto& roots = instance();
+    std::lock_guard<kotlin::SpinLock> guard(roots.lock_);
+    for (size_t i = 0; i < count; ++i) {
+      if (objects[i] != nullptr)
+        ++roots.stableRefs_[objects[i]];
+    }
+  }
+
+  static void removeStableRefs(KRef const* objects, size_t count) {
+    auto& roots = instance();
+    std::lock_guard<kotlin::SpinLock> guard(roots.lock_);
+    for (size_t i = 0; i < count; ++i) {
+      auto it = roots.stableRefs_.find(objects[i]);
+      if (it != roots.stableRefs_.end() && --it->second == 0)
+        roots.stableRefs_.erase(it);
+    }
+  }
+
+  // Appends the current values of the globals and the objects with stable references to `roots`.
+  static void collect(KStdVector<Root>* roots) {
+    auto& instance = HeapRoots::instance();
+    std::lock_guard<kotlin::SpinLock> guard(instance.lock_);
+    for (ObjHeader** location : instance.globals_) {
+      // Skip singletons being initialized on the other threads.
+      ObjHeader* value = *location;
+      if (reinterpret_cast<uintptr_t>(value) > 1)
+        roots->emplace_back(kotlin::HeapSnapshotWriter::RootKind::kGlobal, value);
+    }
+    for (auto& entry : instance.stableRefs_) {
+      roots->emplace_back(kotlin::HeapSnapshotWriter::RootKind::kStableRef, entry.first);
+    }
+  }
+
+ private:
+  HeapRoots() = default;
+  ~HeapRoots() = default;
+
+  static HeapRoots& instance() {
+    // Only store a pointer to HeapRoots in .bss
+    static HeapRoots* result = new HeapRoots();
+    return *result;
+  }
+
+  kotlin::SpinLock lock_;
+  KStdVector<ObjHeader**> globals_;
+  KStdUnorderedMap<KRef, size_t> stableRefs_;
+};
+
 // TODO: can we pass this variable as an explicit argument?
 THREAD_LOCAL_VARIABLE MemoryState* memoryState = nullptr;
 THREAD_LOCAL_VARIABLE FrameOverlay* currentFrame = nullptr;
@@ -260,6 +325,8 @@ public:
   uint64_t containerAllocs[2];
   // Free per container type counters.
   uint64_t objectAllocs[6];
+  // Number of freed containers allocated by another worker.
+  uint64_t crossWorkerFrees;
   // Histogram of allocation size distribution.
   KStdUnorderedMap<int, int>* allocationHistogram;
   // Number of allocation cache hits.
@@ -285,6 +352,7 @@ public:
     memset(containerAllocs, 0, sizeof(containerAllocs));
     memset(objectAllocs, 0, sizeof(objectAllocs));
     memset(updateCounters, 0, sizeof(updateCounters));
+    crossWorkerFrees = 0;
     allocationHistogram = konanConstructInstance<KStdUnorderedMap<int, int>>();
     allocCacheHit = 0;
     allocCacheMiss = 0;
@@ -318,6 +386,7 @@ public:
 
   void incFree(const ContainerHeader* header) {
     containerAllocs[1]++;
+    if (!konan::is_local_object(const_cast<ContainerHeader*>(header))) crossWorkerFrees++;
   }
 
   void incAlloc(size_t size, const ObjHeader* header) {
@@ -350,8 +419,8 @@ public:
 
   void printStatistic() {
     konan::consolePrintf("\nMemory manager statistic:\n\n");
-    konan::consolePrintf("Container alloc: %lld, free: %lld\n",
-                           containerAllocs[0], containerAllocs[1]);
+    konan::consolePrintf("Container alloc: %lld, free: %lld (from other workers: %lld)\n",
+                           containerAllocs[0], containerAllocs[1], crossWorkerFrees);
     for (int i = 0; i < 6; i++) {
       // Only local, shared and frozen can be allocated.
       if (i == 0 || i == 3 || i == 4)
@@ -434,6 +503,15 @@ inline bool isShareable(ContainerHeader* container) {
     return container == nullptr || container->shareable();
 }
 
+// Stack-allocated objects die with their frames, the compiler must not let them escape.
+// They have no container, so otherwise they'd pass for permanent ones.
+void checkNotStackAllocated(const ObjHeader* obj, const char* operation) {
+  if (obj == nullptr || !obj->local()) return;
+  konan::consolePrintf("Attempt to %s a stack object %p\n", operation, obj);
+  konan::consolePrintf("This is a compiler bug, please report it to https://kotl.in/issue\n");
+  konan::abort();
+}
+
 void setContainerFor(ObjHeader* obj, ContainerHeader* container) {
   obj->meta_object()->container_ = container;
   obj->typeInfoOrMeta_ = setPointerBits(obj->typeInfoOrMeta_, OBJECT_TAG_NONTRIVIAL_CONTAINER);
@@ -450,6 +528,8 @@ ContainerHeader* containerFor(const ObjHeader* obj) {
   return (reinterpret_cast<MetaObjHeader*>(clearPointerBits(obj->typeInfoOrMeta_, OBJECT_TAG_MASK)))->container_;
 }
 
+int32_t freezeCount = 0;
+
 ALWAYS_INLINE bool isFrozen(const ObjHeader* obj) {
     return containerFor(obj)->frozen();
 }
@@ -464,9 +544,19 @@ ALWAYS_INLINE bool isShareable(const ObjHeader* obj) {
 }
 
 ObjHeader** ObjHeader::GetWeakCounterLocation() {
+    checkNotStackAllocated(this, "create a weak reference to");
     return &this->meta_object()->WeakReference.counter_;
 }
 
+int32_t* ObjHeader::GetIdentityHashLocation() {
+    return &this->meta_object()->identityHash_;
+}
+
+void** ObjHeader::GetStackTraceLocation() {
+    checkNotStackAllocated(this, "capture a stack trace of");
+    return &this->meta_object()->stackTrace_;
+}
+
 #if KONAN_OBJC_INTEROP
 
 void* ObjHeader::GetAssociatedObject() {
@@ -641,6 +731,14 @@ public:
         return storage_ + entry.offset + index;
     }
 
+    template <typename F>
+    void ForEachRef(F process) noexcept {
+        if (storage_ == nullptr) return;
+        for (int i = 0; i < size_; ++i) {
+            process(storage_[i]);
+        }
+    }
+
 private:
     struct Entry {
         int offset;
@@ -841,8 +939,9 @@ class ObjectContainer : public Container {
 
 class ArrayContainer : public Container {
  public:
-  ArrayContainer(MemoryState* state, const TypeInfo* type_info, uint32_t elements) {
-    Init(state, type_info, elements);
+  // Elements of an uninitialized container are left as they are in memory, only the headers are set.
+  ArrayContainer(MemoryState* state, const TypeInfo* type_info, uint32_t elements, bool initialized = true) {
+    Init(state, type_info, elements, initialized);
   }
 
   // Array container shalln't have any dtor, as it's being freed by ::Release().
@@ -852,7 +951,7 @@ class ArrayContainer : public Container {
   }
 
  private:
-  void Init(MemoryState* state, const TypeInfo* type_info, uint32_t elements);
+  void Init(MemoryState* state, const TypeInfo* type_info, uint32_t elements, bool initialized);
 };
 
 // Class representing arena-style placement container.
@@ -947,7 +1046,9 @@ inline uint32_t arrayObjectSize(const TypeInfo* typeInfo, uint32_t count) {
 }
 
 inline uint32_t arrayObjectSize(const ArrayHeader* obj) {
-  return arrayObjectSize(obj->type_info(), obj->count_);
+  // Compact strings store the number of chars along with a flag in `count_`.
+  uint32_t count = obj->type_info() == theStringTypeInfo ? StringStorageLength(obj) : obj->count_;
+  return arrayObjectSize(obj->type_info(), count);
 }
 
 // TODO: shall we do padding for alignment?
@@ -1043,8 +1144,10 @@ inline bool isFreezableAtomic(ContainerHeader* container) {
   return isFreezableAtomic(obj);
 }
 
-ContainerHeader* allocContainer(MemoryState* state, size_t size) {
+// Only the first `zeroedSize` bytes of the container are guaranteed to be zero.
+ContainerHeader* allocContainer(MemoryState* state, size_t size, size_t zeroedSize) {
  ContainerHeader* result = nullptr;
+ kotlin::MemoryStatistics::Instance().RecordAllocation(size);
 #if USE_GC
   // We recycle elements of finalizer queue for new allocations, to avoid trashing memory manager.
   ContainerHeader* container = state != nullptr ? state->finalizerQueue : nullptr;
@@ -1060,7 +1163,7 @@ ContainerHeader* allocContainer(MemoryState* state, size_t size) {
       else
         previous->setNextLink(container->nextLink());
       state->finalizerQueueSize--;
-      memset(container, 0, size);
+      memset(container, 0, zeroedSize);
       break;
     }
     previous = container;
@@ -1072,7 +1175,12 @@ ContainerHeader* allocContainer(MemoryState* state, size_t size) {
     if (state != nullptr)
         state->allocSinceLastGc += size;
 #endif
-    result = konanConstructSizedInstance<ContainerHeader>(alignUp(size, kObjectAlignment));
+    if (zeroedSize < size) {
+      result = reinterpret_cast<ContainerHeader*>(konanAllocUninitializedObjectMemory(alignUp(size, kObjectAlignment)));
+      if (result != nullptr) memset(result, 0, zeroedSize);
+    } else {
+      result = new (konanAllocObjectMemory(alignUp(size, kObjectAlignment))) ContainerHeader();
+    }
     atomicAdd(&allocCount, 1);
   }
   if (state != nullptr) {
@@ -1084,6 +1192,10 @@ ContainerHeader* allocContainer(MemoryState* state, size_t size) {
   return result;
 }
 
+ContainerHeader* allocContainer(MemoryState* state, size_t size) {
+  return allocContainer(state, size, size);
+}
+
 ContainerHeader* allocAggregatingFrozenContainer(KStdVector<ContainerHeader*>& containers) {
   auto componentSize = containers.size();
   auto* superContainer = allocContainer(memoryState, sizeof(ContainerHeader) + sizeof(void*) * componentSize);
@@ -1104,6 +1216,7 @@ ContainerHeader* allocAggregatingFrozenContainer(KStdVector<ContainerHeader*>& c
 #if USE_GC
 
 void processFinalizerQueue(MemoryState* state) {
+  kotlin::Tracing::Span span("gc", "processFinalizerQueue");
   // TODO: reuse elements of finalizer queue for new allocations.
   while (state->finalizerQueue != nullptr) {
     auto* container = state->finalizerQueue;
@@ -1221,6 +1334,8 @@ ALWAYS_INLINE void runDeallocationHooks(ContainerHeader* container) {
 
 void freeContainer(ContainerHeader* container) {
   RuntimeAssert(container != nullptr, "this kind of container shalln't be freed");
+  // Freeing a container may free a whole subgraph, with cleaners in it.
+  CleanerBatchScope cleanerBatchScope;
 
   if (isAggregatingFrozenContainer(container)) {
     freeAggregatingFrozenContainer(container);
@@ -1328,8 +1443,8 @@ inline bool tryIncrementRC(ContainerHeader* container) {
 #if !USE_GC
 
 template <bool Atomic>
-inline void incrementRC(ContainerHeader* container) {
-  container->incRefCount<Atomic>();
+inline void incrementRC(ContainerHeader* container, uint32_t count = 1) {
+  container->incRefCount<Atomic>(count);
 }
 
 template <bool Atomic, bool UseCycleCollector>
@@ -1354,8 +1469,8 @@ inline void enqueueDecrementRC(ContainerHeader* container) {
 #else // USE_GC
 
 template <bool Atomic>
-inline void incrementRC(ContainerHeader* container) {
-  container->incRefCount<Atomic>();
+inline void incrementRC(ContainerHeader* container, uint32_t count = 1) {
+  container->incRefCount<Atomic>(count);
 }
 
 template <bool Atomic, bool UseCycleCollector>
@@ -1599,6 +1714,7 @@ void scanBlack(ContainerHeader* start) {
 void collectWhite(MemoryState*, ContainerHeader* container);
 
 void collectCycles(MemoryState* state) {
+  kotlin::Tracing::Span span("gc", "collectCycles");
   markRoots(state);
   scanRoots(state);
   collectRoots(state);
@@ -1637,11 +1753,14 @@ void collectRoots(MemoryState* state) {
   // Here we might free some objects and call deallocation hooks on them,
   // which in turn might call DecrementRC and trigger new GC - forbid that.
   state->gcSuspendCount++;
+  uint64_t collectedCycles = 0;
   for (auto* container : *(state->roots)) {
     container->resetBuffered();
+    if (container->color() == CONTAINER_TAG_GC_WHITE) collectedCycles++;
     collectWhite(state, container);
   }
   state->gcSuspendCount--;
+  kotlin::MemoryStatistics::Instance().RecordCollectedCycles(collectedCycles);
 }
 
 void scan(ContainerHeader* start) {
@@ -1705,7 +1824,7 @@ inline bool canBeCyclic(ContainerHeader* container) {
 }
 #endif
 
-inline void addHeapRef(ContainerHeader* container) {
+inline void addHeapRef(ContainerHeader* container, uint32_t count = 1) {
   MEMORY_LOG("AddHeapRef %p: rc=%d\n", container, container->refCount())
   UPDATE_ADDREF_STAT(memoryState, container, needAtomicAccess(container), 0)
   switch (container->tag()) {
@@ -1713,12 +1832,12 @@ inline void addHeapRef(ContainerHeader* container) {
       break;
     case CONTAINER_TAG_LOCAL:
       RuntimeAssert(container->refCount() > 0, "add ref for reclaimed object");
-      incrementRC</* Atomic = */ false>(container);
+      incrementRC</* Atomic = */ false>(container, count);
       break;
     /* case CONTAINER_TAG_FROZEN: case CONTAINER_TAG_SHARED: */
     default:
       RuntimeAssert(container->refCount() > 0, "add ref for reclaimed object");
-      incrementRC</* Atomic = */ true>(container);
+      incrementRC</* Atomic = */ true>(container, count);
       break;
   }
 }
@@ -1827,6 +1946,7 @@ void incrementStack(MemoryState* state) {
 }
 
 void processDecrements(MemoryState* state) {
+  kotlin::Tracing::Span span("gc", "processDecrements");
   RuntimeAssert(IsStrictMemoryModel(), "Only works in strict model now");
   auto* toRelease = state->toRelease;
   state->gcSuspendCount++;
@@ -1848,6 +1968,7 @@ void processDecrements(MemoryState* state) {
 }
 
 void decrementStack(MemoryState* state) {
+  kotlin::Tracing::Span span("gc", "decrementStack");
   RuntimeAssert(IsStrictMemoryModel(), "Only works in strict model now");
   state->gcSuspendCount++;
   FrameOverlay* frame = currentFrame;
@@ -1870,15 +1991,20 @@ void decrementStack(MemoryState* state) {
 
 void garbageCollect(MemoryState* state, bool force) {
   RuntimeAssert(!state->gcInProgress, "Recursive GC is disallowed");
+  kotlin::Tracing::Span span("gc", "garbageCollect");
+  CleanerBatchScope cleanerBatchScope;
 
 #if TRACE_GC
   uint64_t allocSinceLastGc = state->allocSinceLastGc;
 #endif  // TRACE_GC
   state->allocSinceLastGc = 0;
+  kotlin::MemoryStatistics::Instance().RecordFinalizerQueueLength(state->finalizerQueueSize);
 
   if (!IsStrictMemoryModel()) {
     // In relaxed model we just process finalizer queue and be done with it.
+    auto finalizeStartTime = konan::getTimeMicros();
     processFinalizerQueue(state);
+    kotlin::MemoryStatistics::Instance().RecordGc(konan::getTimeMicros() - finalizeStartTime);
     return;
   }
 
@@ -1959,6 +2085,7 @@ void garbageCollect(MemoryState* state, bool force) {
 
   state->gcInProgress = false;
   auto gcEndTime = konan::getTimeMicros();
+  kotlin::MemoryStatistics::Instance().RecordGc(gcEndTime - gcStartTime);
 
   if (state->gcErgonomics) {
     auto gcToComputeRatio = double(gcEndTime - gcStartTime) / (gcStartTime - state->lastGcTimestamp + 1);
@@ -1996,13 +2123,17 @@ void garbageCollect() {
 #endif  // USE_GC
 
 ForeignRefManager* initLocalForeignRef(ObjHeader* object) {
+  checkNotStackAllocated(object, "create a foreign reference to");
   if (!IsStrictMemoryModel()) return nullptr;
 
   return memoryState->foreignRefManager;
 }
 
 ForeignRefManager* initForeignRef(ObjHeader* object) {
+  checkNotStackAllocated(object, "create a foreign reference to");
   addHeapRef(object);
+  HeapRoots::addStableRefs(&object, 1);
+  kotlin::MemoryStatistics::Instance().RecordStableRefCreated();
 
   if (!IsStrictMemoryModel()) return nullptr;
 
@@ -2029,6 +2160,8 @@ bool isForeignRefAccessible(ObjHeader* object, ForeignRefManager* manager) {
 }
 
 void deinitForeignRef(ObjHeader* object, ForeignRefManager* manager) {
+  HeapRoots::removeStableRefs(&object, 1);
+  kotlin::MemoryStatistics::Instance().RecordStableRefDisposed();
   if (IsStrictMemoryModel()) {
     if (memoryState != nullptr && isForeignRefAccessible(object, manager)) {
       releaseHeapRef<true>(object);
@@ -2058,6 +2191,7 @@ MemoryState* initMemory(bool firstRuntime) {
                 "Layout mismatch");
   RuntimeAssert(sizeof(FrameOverlay) % sizeof(ObjHeader**) == 0, "Frame overlay should contain only pointers");
   RuntimeAssert(memoryState == nullptr, "memory state must be clear");
+  konan::init_object_heap();
   memoryState = konanConstructInstance<MemoryState>();
   INIT_EVENT(memoryState)
 #if USE_GC
@@ -2156,6 +2290,8 @@ void deinitMemory(MemoryState* memoryState, bool destroyRuntime) {
 
   konanFreeMemory(memoryState);
   ::memoryState = nullptr;
+  // Releases the pages of the worker's objects in bulk.
+  konan::deinit_object_heap();
 }
 
 void makeShareable(ContainerHeader* container) {
@@ -2218,6 +2354,88 @@ void updateHeapRef(ObjHeader** location, const ObjHeader* object) {
   }
 }
 
+// Adds a heap reference for each non-null value in [begin, end), once per run of equal values.
+void addHeapRefs(ObjHeader* const* begin, ObjHeader* const* end) {
+  while (begin != end) {
+    const ObjHeader* object = *begin++;
+    if (object == nullptr) continue;
+    uint32_t count = 1;
+    while (begin != end && *begin == object) {
+      ++begin;
+      ++count;
+    }
+    auto* container = containerFor(object);
+    if (container != nullptr)
+      addHeapRef(container, count);
+  }
+}
+
+template <bool Strict>
+void copyHeapRefs(ObjHeader** destination, ObjHeader* const* source, uint32_t count) {
+  MEMORY_LOG("CopyHeapRefs %p <- %p: %u\n", destination, source, count)
+  if (destination == source || count == 0) return;
+  // Values that are moved within the overlapping part of the ranges stay referenced from the same array,
+  // so only the values entering and leaving the destination range need reference count updates.
+  ObjHeader* const* addedBegin = source;
+  ObjHeader* const* addedEnd = source + count;
+  ObjHeader** releasedBegin = destination;
+  ObjHeader** releasedEnd = destination + count;
+  if (destination < source && source < destination + count) {
+    addedBegin = destination + count;
+    releasedEnd = const_cast<ObjHeader**>(source);
+  } else if (source < destination && destination < source + count) {
+    addedEnd = destination;
+    releasedBegin = const_cast<ObjHeader**>(source) + count;
+  }
+  addHeapRefs(addedBegin, addedEnd);
+  // Old values are released only after they are overwritten, as in updateHeapRef. To keep them on the stack, the copy
+  // is done in chunks, in the direction memmove would take for the overlapping ranges.
+  constexpr uint32_t kChunkSize = 64;
+  ObjHeader* released[kChunkSize];
+  bool backward = source < destination;
+  for (uint32_t done = 0; done < count;) {
+    uint32_t size = std::min(kChunkSize, count - done);
+    uint32_t offset = backward ? count - done - size : done;
+    uint32_t releasedCount = 0;
+    for (uint32_t index = offset; index < offset + size; ++index) {
+      ObjHeader** location = destination + index;
+      UPDATE_REF_EVENT(memoryState, *location, source[index], location, 0);
+      if (location >= releasedBegin && location < releasedEnd && reinterpret_cast<uintptr_t>(*location) > 1)
+        released[releasedCount++] = *location;
+    }
+    memmove(destination + offset, source + offset, size * sizeof(ObjHeader*));
+    // Values moved within the overlap may be seen twice until the copy is done, so no collection is allowed here.
+    for (uint32_t index = 0; index < releasedCount; ++index) {
+      releaseHeapRef<Strict, /* CanCollect = */ false>(released[index]);
+    }
+    done += size;
+  }
+}
+
+template <bool Strict>
+void fillHeapRefs(ObjHeader** location, const ObjHeader* object, uint32_t count) {
+  MEMORY_LOG("FillHeapRefs %p: %p x %u\n", location, object, count)
+  uint32_t changed = 0;
+  for (uint32_t index = 0; index < count; ++index) {
+    if (location[index] != object) ++changed;
+  }
+  if (changed == 0) return;
+  if (object != nullptr) {
+    auto* container = containerFor(object);
+    if (container != nullptr)
+      addHeapRef(container, changed);
+  }
+  for (uint32_t index = 0; index < count; ++index) {
+    ObjHeader* old = location[index];
+    if (old == object) continue;
+    UPDATE_REF_EVENT(memoryState, old, object, location + index, 0);
+    *const_cast<const ObjHeader**>(location + index) = object;
+    if (reinterpret_cast<uintptr_t>(old) > 1) {
+      releaseHeapRef<Strict>(old);
+    }
+  }
+}
+
 template <bool Strict>
 void updateStackRef(ObjHeader** location, const ObjHeader* object) {
   UPDATE_REF_EVENT(memoryState, *location, object, location, 1)
@@ -2293,6 +2511,7 @@ OBJ_GETTER(allocInstance, const TypeInfo* type_info) {
 #endif  // USE_GC
   auto container = ObjectContainer(state, type_info);
   ObjHeader* obj = container.GetPlace();
+  kotlin::AllocationProfiler::OnAllocation(type_info, type_info->instanceSize_);
 #if USE_GC
   if (Strict) {
     rememberNewContainer(container.header());
@@ -2315,14 +2534,15 @@ OBJ_GETTER(allocInstance, const TypeInfo* type_info) {
 }
 
 template <bool Strict>
-OBJ_GETTER(allocArrayInstance, const TypeInfo* type_info, int32_t elements) {
+OBJ_GETTER(allocArrayInstance, const TypeInfo* type_info, int32_t elements, bool initialized) {
   RuntimeAssert(type_info->instanceSize_ < 0, "must be an array");
   if (elements < 0) ThrowIllegalArgumentException();
   auto* state = memoryState;
 #if USE_GC
   checkIfGcNeeded(state);
 #endif  // USE_GC
-  auto container = ArrayContainer(state, type_info, elements);
+  auto container = ArrayContainer(state, type_info, elements, initialized);
+  kotlin::AllocationProfiler::OnAllocation(type_info, arrayObjectSize(type_info, elements));
 #if USE_GC
   if (Strict) {
     rememberNewContainer(container.header());
@@ -2366,6 +2586,7 @@ OBJ_GETTER(initSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (
     // OK'ish, inited by someone else.
     RETURN_OBJ(value);
   }
+  HeapRoots::addGlobal(location);
   ObjHeader* object = AllocInstance(typeInfo, OBJ_RESULT);
   UpdateHeapRef(location, object);
 #if KONAN_NO_EXCEPTIONS
@@ -2401,6 +2622,7 @@ OBJ_GETTER(initSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (
     // OK'ish, inited by someone else.
     RETURN_OBJ(value);
   }
+  HeapRoots::addGlobal(location);
   ObjHeader* object = AllocInstance(typeInfo, OBJ_RESULT);
   memoryState->initializingSingletons.push_back(std::make_pair(location, object));
 #if KONAN_NO_EXCEPTIONS
@@ -2508,6 +2730,23 @@ OBJ_GETTER(readHeapRefLocked, ObjHeader** location, int32_t* spinlock, int32_t*
   return value;
 }
 
+OBJ_GETTER(readHeapRefUnlocked, ObjHeader** location, int32_t* cookie) {
+  MEMORY_LOG("ReadHeapRefUnlocked: %p\n", location)
+  ObjHeader* value = __atomic_load_n(location, __ATOMIC_ACQUIRE);
+  auto realCookie = computeCookie();
+  // Racy cookie updates are benign: at worst the container gets remembered once more.
+  bool shallRemember = __atomic_load_n(cookie, __ATOMIC_RELAXED) != realCookie;
+  if (shallRemember) __atomic_store_n(cookie, realCookie, __ATOMIC_RELAXED);
+  UpdateReturnRef(OBJ_RESULT, value);
+#if USE_GC
+  if (IsStrictMemoryModel() && shallRemember && value != nullptr) {
+    auto* container = containerFor(value);
+    rememberNewContainer(container);
+  }
+#endif  // USE_GC
+  return value;
+}
+
 OBJ_GETTER(readHeapRefNoLock, ObjHeader* object, KInt index) {
   MEMORY_LOG("ReadHeapRefNoLock: %p index %d\n", object, index)
   ObjHeader** location = reinterpret_cast<ObjHeader**>(
@@ -2649,15 +2888,46 @@ KBoolean getTuneGCThreshold() {
 
 KNativePtr createStablePointer(KRef any) {
   if (any == nullptr) return nullptr;
+  checkNotStackAllocated(any, "create a stable reference to");
   MEMORY_LOG("CreateStablePointer for %p rc=%d\n", any, containerFor(any) ? containerFor(any)->refCount() : 0)
   addHeapRef(any);
+  HeapRoots::addStableRefs(&any, 1);
+  kotlin::MemoryStatistics::Instance().RecordStableRefCreated();
   return reinterpret_cast<KNativePtr>(any);
 }
 
 void disposeStablePointer(KNativePtr pointer) {
   if (pointer == nullptr) return;
   KRef ref = reinterpret_cast<KRef>(pointer);
+  HeapRoots::removeStableRefs(&ref, 1);
   ReleaseHeapRef(ref);
+  kotlin::MemoryStatistics::Instance().RecordStableRefDisposed();
+}
+
+void createStablePointers(KRef const* objects, KNativePtr* pointers, size_t count) {
+  size_t created = 0;
+  for (size_t i = 0; i < count; ++i) {
+    KRef any = objects[i];
+    if (any != nullptr) {
+      checkNotStackAllocated(any, "create a stable reference to");
+      addHeapRef(any);
+      ++created;
+    }
+    pointers[i] = reinterpret_cast<KNativePtr>(any);
+  }
+  HeapRoots::addStableRefs(objects, count);
+  kotlin::MemoryStatistics::Instance().RecordStableRefCreated(created);
+}
+
+void disposeStablePointers(KNativePtr const* pointers, size_t count) {
+  HeapRoots::removeStableRefs(reinterpret_cast<KRef const*>(pointers), count);
+  size_t disposed = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (pointers[i] == nullptr) continue;
+    ReleaseHeapRef(reinterpret_cast<KRef>(pointers[i]));
+    ++disposed;
+  }
+  kotlin::MemoryStatistics::Instance().RecordStableRefDisposed(disposed);
 }
 
 OBJ_GETTER(derefStablePointer, KNativePtr pointer) {
@@ -2680,6 +2950,7 @@ bool clearSubgraphReferences(ObjHeader* root, bool checked) {
 #if USE_GC
   MEMORY_LOG("ClearSubgraphReferences %p\n", root)
   if (root == nullptr) return true;
+  checkNotStackAllocated(root, "transfer");
   auto state = memoryState;
   auto* container = containerFor(root);
 
@@ -2914,10 +3185,12 @@ void runFreezeHooksRecursive(ObjHeader* root) {
  */
 void freezeSubgraph(ObjHeader* root) {
   if (root == nullptr) return;
+  checkNotStackAllocated(root, "freeze");
   // First check that passed object graph has no cycles.
   // If there are cycles - run graph condensation on cyclic graphs using Kosoraju-Sharir.
   ContainerHeader* rootContainer = containerFor(root);
   if (isPermanentOrFrozen(rootContainer)) return;
+  kotlin::Tracing::Span span("freeze", "freezeSubgraph");
 
   MEMORY_LOG("Run freeze hooks on subgraph of %p\n", root);
 
@@ -2951,6 +3224,13 @@ void freezeSubgraph(ObjHeader* root) {
     freezeAcyclic(rootContainer, &newlyFrozen);
   }
   MEMORY_LOG("Graph of %p is %s with %d elements\n", root, hasCycles ? "cyclic" : "acyclic", newlyFrozen.size())
+  atomicAdd(&freezeCount, 1);
+  uint64_t frozenBytes = 0;
+  for (auto* container : newlyFrozen) {
+    // Aggregating containers only refer to the frozen ones and have no size of their own.
+    if (container->hasContainerSize()) frozenBytes += container->containerSize();
+  }
+  kotlin::MemoryStatistics::Instance().RecordFrozen(frozenBytes);
 
 #if USE_GC
   // Now remove frozen objects from the toFree list.
@@ -2975,6 +3255,7 @@ void ensureNeverFrozen(ObjHeader* object) {
 }
 
 void shareAny(ObjHeader* obj) {
+  checkNotStackAllocated(obj, "share");
   auto* container = containerFor(obj);
   if (isShareable(container)) return;
   RuntimeCheck(container->objectCount() == 1, "Must be a single object container");
@@ -3141,6 +3422,7 @@ void ObjHeader::destroyMetaObject(ObjHeader* object) {
     WeakReferenceCounterClear(meta->WeakReference.counter_);
     ZeroHeapRef(&meta->WeakReference.counter_);
   }
+  DestroyCapturedStackTrace(meta->stackTrace_);
 
 #ifdef KONAN_OBJC_INTEROP
   Kotlin_ObjCExport_releaseAssociatedObject(meta->associatedObject_);
@@ -3162,11 +3444,11 @@ void ObjectContainer::Init(MemoryState* state, const TypeInfo* typeInfo) {
   OBJECT_ALLOC_EVENT(memoryState, typeInfo->instanceSize_, GetPlace())
 }
 
-void ArrayContainer::Init(MemoryState* state, const TypeInfo* typeInfo, uint32_t elements) {
+void ArrayContainer::Init(MemoryState* state, const TypeInfo* typeInfo, uint32_t elements, bool initialized) {
   RuntimeAssert(typeInfo->instanceSize_ < 0, "Must be an array");
   uint32_t allocSize =
       sizeof(ContainerHeader) + arrayObjectSize(typeInfo, elements);
-  header_ = allocContainer(state, allocSize);
+  header_ = allocContainer(state, allocSize, initialized ? allocSize : sizeof(ContainerHeader) + sizeof(ArrayHeader));
   RuntimeCheck(header_ != nullptr, "Cannot alloc memory");
   // One object in this container, no need to set.
   header_->setContainerSize(allocSize);
@@ -3204,7 +3486,7 @@ bool ArenaContainer::allocContainer(container_size_t minSize) {
   auto size = minSize + sizeof(ContainerHeader) + sizeof(ContainerChunk);
   size = alignUp(size, kContainerAlignment);
   // TODO: keep simple cache of container chunks.
-  ContainerChunk* result = konanConstructSizedInstance<ContainerChunk>(size);
+  ContainerChunk* result = new (konanAllocObjectMemory(size)) ContainerChunk();
   RuntimeCheck(result != nullptr, "Cannot alloc memory");
   if (result == nullptr) return false;
   result->next = currentChunk_;
@@ -3304,6 +3586,19 @@ void DeinitForeignRef(ObjHeader* object, ForeignRefContext context) {
   deinitForeignRef(object, context);
 }
 
+// Reference counting has nothing to share between the references of a batch.
+void InitForeignRefs(ObjHeader* const* objects, ForeignRefContext* contexts, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    contexts[i] = initForeignRef(objects[i]);
+  }
+}
+
+void DeinitForeignRefs(ObjHeader* const* objects, const ForeignRefContext* contexts, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    deinitForeignRef(objects[i], contexts[i]);
+  }
+}
+
 bool IsForeignRefAccessible(ObjHeader* object, ForeignRefContext context) {
   return isForeignRefAccessible(object, context);
 }
@@ -3337,10 +3632,17 @@ OBJ_GETTER(AllocInstanceRelaxed, const TypeInfo* type_info) {
 }
 
 OBJ_GETTER(AllocArrayInstanceStrict, const TypeInfo* typeInfo, int32_t elements) {
-  RETURN_RESULT_OF(allocArrayInstance<true>, typeInfo, elements);
+  RETURN_RESULT_OF(allocArrayInstance<true>, typeInfo, elements, true);
 }
 OBJ_GETTER(AllocArrayInstanceRelaxed, const TypeInfo* typeInfo, int32_t elements) {
-  RETURN_RESULT_OF(allocArrayInstance<false>, typeInfo, elements);
+  RETURN_RESULT_OF(allocArrayInstance<false>, typeInfo, elements, true);
+}
+
+OBJ_GETTER(AllocUninitializedArrayInstanceStrict, const TypeInfo* typeInfo, int32_t elements) {
+  RETURN_RESULT_OF(allocArrayInstance<true>, typeInfo, elements, false);
+}
+OBJ_GETTER(AllocUninitializedArrayInstanceRelaxed, const TypeInfo* typeInfo, int32_t elements) {
+  RETURN_RESULT_OF(allocArrayInstance<false>, typeInfo, elements, false);
 }
 
 OBJ_GETTER(InitThreadLocalSingletonStrict, ObjHeader** location, const TypeInfo* typeInfo, void (*ctor)(ObjHeader*)) {
@@ -3358,7 +3660,10 @@ OBJ_GETTER(InitSingletonRelaxed, ObjHeader** location, const TypeInfo* typeInfo,
 }
 
 void RUNTIME_NOTHROW InitAndRegisterGlobal(ObjHeader** location, const ObjHeader* initialValue) {
-    RuntimeCheck(false, "Global registration is impossible in legacy MM");
+  // Globals are only registered as heap snapshot roots.
+  HeapRoots::addGlobal(location);
+  if (initialValue != nullptr)
+    UpdateHeapRef(location, initialValue);
 }
 
 RUNTIME_NOTHROW void SetStackRefStrict(ObjHeader** location, const ObjHeader* object) {
@@ -3400,6 +3705,20 @@ RUNTIME_NOTHROW void UpdateHeapRefRelaxed(ObjHeader** location, const ObjHeader*
   updateHeapRef<false>(location, object);
 }
 
+RUNTIME_NOTHROW void CopyHeapRefsStrict(ObjHeader** destination, ObjHeader* const* source, uint32_t count) {
+  copyHeapRefs<true>(destination, source, count);
+}
+RUNTIME_NOTHROW void CopyHeapRefsRelaxed(ObjHeader** destination, ObjHeader* const* source, uint32_t count) {
+  copyHeapRefs<false>(destination, source, count);
+}
+
+RUNTIME_NOTHROW void FillHeapRefsStrict(ObjHeader** location, const ObjHeader* object, uint32_t count) {
+  fillHeapRefs<true>(location, object, count);
+}
+RUNTIME_NOTHROW void FillHeapRefsRelaxed(ObjHeader** location, const ObjHeader* object, uint32_t count) {
+  fillHeapRefs<false>(location, object, count);
+}
+
 RUNTIME_NOTHROW void UpdateReturnRefStrict(ObjHeader** returnSlot, const ObjHeader* value) {
   updateReturnRef<true>(returnSlot, value);
 }
@@ -3431,6 +3750,10 @@ OBJ_GETTER(ReadHeapRefLocked, ObjHeader** location, int32_t* spinlock, int32_t*
   RETURN_RESULT_OF(readHeapRefLocked, location, spinlock, cookie);
 }
 
+OBJ_GETTER(ReadHeapRefUnlocked, ObjHeader** location, int32_t* cookie) {
+  RETURN_RESULT_OF(readHeapRefUnlocked, location, cookie);
+}
+
 OBJ_GETTER(ReadHeapRefNoLock, ObjHeader* object, KInt index) {
   RETURN_RESULT_OF(readHeapRefNoLock, object, index);
 }
@@ -3569,6 +3892,14 @@ RUNTIME_NOTHROW void DisposeStablePointer(KNativePtr pointer) {
   disposeStablePointer(pointer);
 }
 
+RUNTIME_NOTHROW void CreateStablePointers(KRef const* objects, KNativePtr* pointers, size_t count) {
+  createStablePointers(objects, pointers, count);
+}
+
+RUNTIME_NOTHROW void DisposeStablePointers(KNativePtr const* pointers, size_t count) {
+  disposeStablePointers(pointers, count);
+}
+
 OBJ_GETTER(DerefStablePointer, KNativePtr pointer) {
   RETURN_RESULT_OF(derefStablePointer, pointer);
 }
@@ -3663,6 +3994,23 @@ void Kotlin_native_internal_GC_setCyclicCollector(KRef gc, KBoolean value) {
 #endif  // USE_CYCLIC_GC
 }
 
+KBoolean Kotlin_native_internal_GC_getGenerational(KRef) {
+  return false;
+}
+
+void Kotlin_native_internal_GC_setGenerational(KRef, KBoolean value) {
+  // Reference counting frees most of the short-lived objects right away.
+  if (value)
+    ThrowIllegalArgumentException();
+}
+
+KLong Kotlin_native_internal_GC_getNurserySize(KRef) {
+  return -1;
+}
+
+void Kotlin_native_internal_GC_setNurserySize(KRef, KLong) {
+}
+
 bool Kotlin_Any_isShareable(KRef thiz) {
     return thiz == nullptr || isShareable(containerFor(thiz));
 }
@@ -3671,6 +4019,79 @@ RUNTIME_NOTHROW void PerformFullGC(MemoryState* memory) {
     garbageCollect(memory, true);
 }
 
+// Roots are the current thread's stack and thread local storage, globals and stable references. Objects reachable only
+// from the other threads are not in the snapshot.
+bool DumpHeapSnapshot(const char* path) {
+  kotlin::HeapSnapshotWriter writer(path);
+  if (!writer.ok()) return false;
+
+  KStdVector<HeapRoots::Root> roots;
+  for (FrameOverlay* frame = currentFrame; frame != nullptr; frame = frame->previous) {
+    ObjHeader** current = reinterpret_cast<ObjHeader**>(frame + 1) + frame->parameters;
+    ObjHeader** end = current + frame->count - kFrameOverlaySlots - frame->parameters;
+    while (current < end) {
+      roots.emplace_back(kotlin::HeapSnapshotWriter::RootKind::kStack, *current++);
+    }
+  }
+  if (::memoryState != nullptr) {
+    ::memoryState->tls.ForEachRef([&roots](ObjHeader* obj) {
+      roots.emplace_back(kotlin::HeapSnapshotWriter::RootKind::kThreadLocal, obj);
+    });
+  }
+  HeapRoots::collect(&roots);
+
+  // Objects in the containers of this thread are marked with the container mark bit, the others (permanent, frozen and
+  // multi-object containers) are remembered in `visitedShared`. The second traversal clears the marks.
+  KStdVector<ObjHeader*> toVisit;
+  KStdUnorderedSet<ObjHeader*> visitedShared;
+  auto markable = [](ContainerHeader* container) {
+    return container != nullptr && !container->shareable() && container->objectCount() == 1;
+  };
+  auto visit = [&toVisit, &visitedShared, &markable](ObjHeader* obj) {
+    if (obj == nullptr) return;
+    ContainerHeader* container = containerFor(obj);
+    if (markable(container)) {
+      if (container->marked()) return;
+      container->mark();
+    } else if (!visitedShared.insert(obj).second) {
+      return;
+    }
+    toVisit.push_back(obj);
+  };
+  auto unvisit = [&toVisit, &visitedShared, &markable](ObjHeader* obj) {
+    if (obj == nullptr) return;
+    ContainerHeader* container = containerFor(obj);
+    if (markable(container)) {
+      if (!container->marked()) return;
+      container->unMark();
+    } else if (visitedShared.erase(obj) == 0) {
+      return;
+    }
+    toVisit.push_back(obj);
+  };
+
+  for (auto& root : roots) {
+    writer.WriteRoot(root.first, root.second);
+    visit(root.second);
+  }
+  while (!toVisit.empty()) {
+    ObjHeader* obj = toVisit.back();
+    toVisit.pop_back();
+    writer.WriteObject(obj);
+    traverseReferredObjects(obj, visit);
+  }
+
+  for (auto& root : roots) {
+    unvisit(root.second);
+  }
+  while (!toVisit.empty()) {
+    ObjHeader* obj = toVisit.back();
+    toVisit.pop_back();
+    traverseReferredObjects(obj, unvisit);
+  }
+  return writer.Finish();
+}
+
 void CheckGlobalsAccessible() {
     if (!::memoryState->isMainThread)
         ThrowIncorrectDereferenceException();
@@ -113,14 +113,14 @@ struct ContainerHeader {
   }
 
   template <bool Atomic>
-  inline void incRefCount() {
+  inline void incRefCount(uint32_t count = 1) {
 #ifdef KONAN_NO_THREADS
-    refCount_ += CONTAINER_TAG_INCREMENT;
+    refCount_ += count * CONTAINER_TAG_INCREMENT;
 #else
     if (Atomic)
-      __sync_add_and_fetch(&refCount_, CONTAINER_TAG_INCREMENT);
+      __sync_add_and_fetch(&refCount_, count * CONTAINER_TAG_INCREMENT);
     else
-      refCount_ += CONTAINER_TAG_INCREMENT;
+      refCount_ += count * CONTAINER_TAG_INCREMENT;
 #endif
   }
 
@@ -290,6 +290,11 @@ struct MetaObjHeader {
 
   // Flags for the object state.
   int32_t flags_;
+  // Identity hash code, 0 until it's requested.
+  int32_t identityHash_;
+
+  // Frames captured on creation of a `Throwable`.
+  void* stackTrace_;
 
   struct {
     // Strong reference to the counter object.
@@ -309,6 +314,9 @@ OBJ_GETTER(AllocInstanceRelaxed, const TypeInfo* type_info) RUNTIME_NOTHROW;
 OBJ_GETTER(AllocArrayInstanceStrict, const TypeInfo* type_info, int32_t elements);
 OBJ_GETTER(AllocArrayInstanceRelaxed, const TypeInfo* type_info, int32_t elements);
 
+OBJ_GETTER(AllocUninitializedArrayInstanceStrict, const TypeInfo* type_info, int32_t elements);
+OBJ_GETTER(AllocUninitializedArrayInstanceRelaxed, const TypeInfo* type_info, int32_t elements);
+
 OBJ_GETTER(InitThreadLocalSingletonStrict, ObjHeader** location, const TypeInfo* typeInfo, void (*ctor)(ObjHeader*));
 OBJ_GETTER(InitThreadLocalSingletonRelaxed, ObjHeader** location, const TypeInfo* typeInfo, void (*ctor)(ObjHeader*));
 
@@ -321,6 +329,8 @@ MODEL_VARIANTS(void, ZeroStackRef, ObjHeader** location);
 MODEL_VARIANTS(void, UpdateStackRef, ObjHeader** location, const ObjHeader* object);
 MODEL_VARIANTS(void, UpdateHeapRef, ObjHeader** location, const ObjHeader* object);
 MODEL_VARIANTS(void, UpdateHeapRefIfNull, ObjHeader** location, const ObjHeader* object);
+MODEL_VARIANTS(void, CopyHeapRefs, ObjHeader** destination, ObjHeader* const* source, uint32_t count);
+MODEL_VARIANTS(void, FillHeapRefs, ObjHeader** location, const ObjHeader* object, uint32_t count);
 MODEL_VARIANTS(void, UpdateReturnRef, ObjHeader** returnSlot, const ObjHeader* object);
 MODEL_VARIANTS(void, EnterFrame, ObjHeader** start, int parameters, int count);
 MODEL_VARIANTS(void, LeaveFrame, ObjHeader** start, int parameters, int count);
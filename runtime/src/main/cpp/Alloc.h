@@ -33,6 +33,20 @@ inline void* konanAllocAlignedMemory(size_t size, size_t alignment) {
     return konan::calloc_aligned(1, size, alignment);
 }
 
+// Memory for Kotlin objects, from the object heap of the current thread. Freed with `konanFreeMemory`.
+inline void* konanAllocObjectMemory(size_t size) {
+  return konan::calloc_object(1, size);
+}
+
+// Same as `konanAllocObjectMemory`, but the memory is not zeroed.
+inline void* konanAllocUninitializedObjectMemory(size_t size) {
+  return konan::malloc_object(size);
+}
+
+inline void* konanAllocAlignedObjectMemory(size_t size, size_t alignment) {
+  return konan::calloc_object_aligned(1, size, alignment);
+}
+
 inline void konanFreeMemory(void* memory) {
   konan::free(memory);
 }
@@ -0,0 +1,533 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "AllocationProfiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+
+#if USE_ELF_SYMBOLS
+#include <elf.h>
+#include <link.h>
+#include <unistd.h>
+#elif KONAN_OBJC_INTEROP
+#include <mach-o/dyld.h>
+#include <mach-o/loader.h>
+#endif
+
+#include "Alignment.hpp"
+#include "Alloc.h"
+#include "Exceptions.h"
+#include "ExecFormat.h"
+#include "KAssert.h"
+#include "KString.h"
+#include "Memory.h"
+#include "Porting.h"
+#include "TypeInfo.h"
+
+using namespace kotlin;
+
+namespace {
+
+// Minimal protobuf encoder, enough for the pprof `Profile` message.
+class ProtoWriter : private MoveOnly {
+public:
+    explicit ProtoWriter(KStdString& out) noexcept : out_(out) {}
+
+    void Varint(uint64_t value) noexcept {
+        while (value >= 0x80) {
+            out_ += static_cast<char>((value & 0x7f) | 0x80);
+            value >>= 7;
+        }
+        out_ += static_cast<char>(value);
+    }
+
+    void Uint64Field(int field, uint64_t value) noexcept {
+        if (value == 0) return;
+        Tag(field, kVarint);
+        Varint(value);
+    }
+
+    void BoolField(int field, bool value) noexcept { Uint64Field(field, value ? 1 : 0); }
+
+    void BytesField(int field, const char* data, size_t size) noexcept {
+        Tag(field, kLengthDelimited);
+        Varint(size);
+        out_.append(data, size);
+    }
+
+    void BytesField(int field, const KStdString& value) noexcept { BytesField(field, value.data(), value.size()); }
+
+    // Writes a packed repeated field of `count` varints produced by `value(i)`.
+    template <typename F>
+    void PackedField(int field, size_t count, F value) noexcept {
+        KStdString packed;
+        ProtoWriter writer(packed);
+        for (size_t i = 0; i < count; ++i) {
+            writer.Varint(value(i));
+        }
+        BytesField(field, packed);
+    }
+
+    // Writes a nested message, filled by `fill(writer)`.
+    template <typename F>
+    void MessageField(int field, F fill) noexcept {
+        KStdString message;
+        ProtoWriter writer(message);
+        fill(writer);
+        BytesField(field, message);
+    }
+
+private:
+    static constexpr int kVarint = 0;
+    static constexpr int kLengthDelimited = 2;
+
+    void Tag(int field, int wireType) noexcept { Varint((static_cast<uint64_t>(field) << 3) | wireType); }
+
+    KStdString& out_;
+};
+
+// Field numbers of profile.proto.
+namespace pprof {
+constexpr int kProfileSampleType = 1;
+constexpr int kProfileSample = 2;
+constexpr int kProfileMapping = 3;
+constexpr int kProfileLocation = 4;
+constexpr int kProfileFunction = 5;
+constexpr int kProfileStringTable = 6;
+constexpr int kProfilePeriodType = 11;
+constexpr int kProfilePeriod = 12;
+constexpr int kValueTypeType = 1;
+constexpr int kValueTypeUnit = 2;
+constexpr int kSampleLocationId = 1;
+constexpr int kSampleValue = 2;
+constexpr int kSampleLabel = 3;
+constexpr int kLabelKey = 1;
+constexpr int kLabelStr = 2;
+constexpr int kLabelNum = 3;
+constexpr int kLabelNumUnit = 4;
+constexpr int kMappingId = 1;
+constexpr int kMappingMemoryStart = 2;
+constexpr int kMappingMemoryLimit = 3;
+constexpr int kMappingFileOffset = 4;
+constexpr int kMappingFilename = 5;
+constexpr int kMappingBuildId = 6;
+constexpr int kMappingHasFunctions = 7;
+constexpr int kLocationId = 1;
+constexpr int kLocationMappingId = 2;
+constexpr int kLocationAddress = 3;
+constexpr int kLocationLine = 4;
+constexpr int kLineFunctionId = 1;
+constexpr int kFunctionId = 1;
+constexpr int kFunctionName = 2;
+constexpr int kFunctionSystemName = 3;
+} // namespace pprof
+
+class StringTable : private Pinned {
+public:
+    StringTable() noexcept { Intern(""); }
+
+    uint64_t Intern(const KStdString& string) noexcept {
+        auto it = indices_.find(string);
+        if (it != indices_.end()) return it->second;
+        uint64_t index = strings_.size();
+        strings_.push_back(string);
+        indices_.emplace(string, index);
+        return index;
+    }
+
+    const KStdVector<KStdString>& strings() const noexcept { return strings_; }
+
+private:
+    KStdVector<KStdString> strings_;
+    KStdOrderedMap<KStdString, uint64_t> indices_;
+};
+
+// Executable code of a loaded binary.
+struct Module {
+    uintptr_t start;
+    uintptr_t limit;
+    uint64_t fileOffset;
+    KStdString filename;
+    KStdString buildId;
+};
+
+KStdString HexString(const uint8_t* data, size_t size) noexcept {
+    static constexpr char kDigits[] = "0123456789abcdef";
+    KStdString result;
+    for (size_t i = 0; i < size; ++i) {
+        result += kDigits[data[i] >> 4];
+        result += kDigits[data[i] & 0xf];
+    }
+    return result;
+}
+
+#if USE_ELF_SYMBOLS
+
+KStdString ElfBuildId(const dl_phdr_info* info) noexcept {
+    for (int i = 0; i < info->dlpi_phnum; ++i) {
+        const auto& header = info->dlpi_phdr[i];
+        if (header.p_type != PT_NOTE) continue;
+        auto* note = reinterpret_cast<const uint8_t*>(info->dlpi_addr + header.p_vaddr);
+        auto* end = note + header.p_memsz;
+        while (note + sizeof(ElfW(Nhdr)) <= end) {
+            auto* noteHeader = reinterpret_cast<const ElfW(Nhdr)*>(note);
+            auto* name = note + sizeof(ElfW(Nhdr));
+            auto* description = name + AlignUp(noteHeader->n_namesz, 4);
+            if (noteHeader->n_type == NT_GNU_BUILD_ID && noteHeader->n_namesz == 4 && memcmp(name, "GNU", 4) == 0) {
+                return HexString(description, noteHeader->n_descsz);
+            }
+            note = description + AlignUp(noteHeader->n_descsz, 4);
+        }
+    }
+    return KStdString();
+}
+
+int AddElfModules(dl_phdr_info* info, size_t, void* data) {
+    auto& modules = *static_cast<KStdVector<Module>*>(data);
+    KStdString filename = info->dlpi_name != nullptr ? info->dlpi_name : "";
+    // The main executable is reported first, without a name.
+    if (filename.empty() && modules.empty()) {
+        char path[4096];
+        ssize_t size = readlink("/proc/self/exe", path, sizeof(path));
+        if (size > 0) filename.assign(path, size);
+    }
+    KStdString buildId = ElfBuildId(info);
+    for (int i = 0; i < info->dlpi_phnum; ++i) {
+        const auto& header = info->dlpi_phdr[i];
+        if (header.p_type != PT_LOAD || (header.p_flags & PF_X) == 0) continue;
+        uintptr_t start = info->dlpi_addr + header.p_vaddr;
+        modules.push_back(Module{start, start + header.p_memsz, header.p_offset, filename, buildId});
+    }
+    return 0;
+}
+
+KStdVector<Module> LoadedModules() noexcept {
+    KStdVector<Module> modules;
+    dl_iterate_phdr(AddElfModules, &modules);
+    return modules;
+}
+
+#elif KONAN_OBJC_INTEROP
+
+#if __LP64__
+using MachHeader = mach_header_64;
+using SegmentCommand = segment_command_64;
+constexpr uint32_t kSegmentCommand = LC_SEGMENT_64;
+#else
+using MachHeader = mach_header;
+using SegmentCommand = segment_command;
+constexpr uint32_t kSegmentCommand = LC_SEGMENT;
+#endif
+
+KStdVector<Module> LoadedModules() noexcept {
+    KStdVector<Module> modules;
+    for (uint32_t i = 0; i < _dyld_image_count(); ++i) {
+        auto* header = reinterpret_cast<const MachHeader*>(_dyld_get_image_header(i));
+        if (header == nullptr) continue;
+        const char* name = _dyld_get_image_name(i);
+        Module module{0, 0, 0, name != nullptr ? name : "", KStdString()};
+        bool hasText = false;
+        auto* command = reinterpret_cast<const uint8_t*>(header + 1);
+        for (uint32_t j = 0; j < header->ncmds; ++j) {
+            auto* loadCommand = reinterpret_cast<const load_command*>(command);
+            if (loadCommand->cmd == kSegmentCommand) {
+                auto* segment = reinterpret_cast<const SegmentCommand*>(loadCommand);
+                if (strcmp(segment->segname, SEG_TEXT) == 0) {
+                    module.start = segment->vmaddr + _dyld_get_image_vmaddr_slide(i);
+                    module.limit = module.start + segment->vmsize;
+                    module.fileOffset = segment->fileoff;
+                    hasText = true;
+                }
+            } else if (loadCommand->cmd == LC_UUID) {
+                auto* uuid = reinterpret_cast<const uuid_command*>(loadCommand);
+                module.buildId = HexString(uuid->uuid, sizeof(uuid->uuid));
+            }
+            command += loadCommand->cmdsize;
+        }
+        if (hasText) modules.push_back(std::move(module));
+    }
+    return modules;
+}
+
+#else
+
+KStdVector<Module> LoadedModules() noexcept {
+    return KStdVector<Module>();
+}
+
+#endif
+
+THREAD_LOCAL_VARIABLE uint64_t randomState = 0;
+
+// Returns a uniform value from [0, 1).
+double nextRandom() noexcept {
+    if (randomState == 0) {
+        randomState = konan::getTimeNanos() ^ reinterpret_cast<uintptr_t>(&randomState) ^ 0x9e3779b97f4a7c15ULL;
+        if (randomState == 0) randomState = 1;
+    }
+    // xorshift64*
+    randomState ^= randomState >> 12;
+    randomState ^= randomState << 25;
+    randomState ^= randomState >> 27;
+    uint64_t value = randomState * 0x2545f4914f6cdd1dULL;
+    return static_cast<double>(value >> 11) * (1.0 / (uint64_t(1) << 53));
+}
+
+} // namespace
+
+class AllocationProfiler::SampleTable : private Pinned {
+public:
+    struct Key {
+        const TypeInfo* typeInfo;
+        KStdVector<KNativePtr> frames;
+
+        bool operator<(const Key& other) const noexcept {
+            if (typeInfo != other.typeInfo) return typeInfo < other.typeInfo;
+            return frames < other.frames;
+        }
+    };
+
+    struct Value {
+        uint64_t count = 0;
+        uint64_t bytes = 0;
+    };
+
+    KStdOrderedMap<Key, Value> samples;
+};
+
+// static
+AllocationProfiler AllocationProfiler::instance_;
+// static
+THREAD_LOCAL_VARIABLE int64_t AllocationProfiler::bytesUntilSample_ = 0;
+// static
+THREAD_LOCAL_VARIABLE uint64_t AllocationProfiler::threadEpoch_ = 0;
+
+void AllocationProfiler::Start(uint64_t samplingInterval) noexcept {
+    RuntimeAssert(samplingInterval > 0, "Sampling interval must be positive");
+    samplingInterval_.store(samplingInterval, std::memory_order_relaxed);
+    epoch_.fetch_add(1, std::memory_order_relaxed);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void AllocationProfiler::Stop() noexcept {
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+void AllocationProfiler::Clear() noexcept {
+    std::lock_guard<SpinLock> guard(samplesLock_);
+    if (samples_ == nullptr) return;
+    konanDestructInstance(samples_);
+    samples_ = nullptr;
+}
+
+size_t AllocationProfiler::sampleCount() noexcept {
+    std::lock_guard<SpinLock> guard(samplesLock_);
+    return samples_ == nullptr ? 0 : samples_->samples.size();
+}
+
+// static
+int64_t AllocationProfiler::NextSampleDistance(uint64_t samplingInterval, double random) noexcept {
+    double distance = -std::log(1.0 - random) * static_cast<double>(samplingInterval);
+    // Cap the tail, and never return 0, so that each allocation is sampled at most once.
+    double limit = static_cast<double>(samplingInterval) * 64;
+    if (distance > limit) distance = limit;
+    return static_cast<int64_t>(distance) + 1;
+}
+
+NO_INLINE void AllocationProfiler::OnSamplePoint(const TypeInfo* typeInfo, size_t size) noexcept {
+    uint64_t epoch = epoch_.load(std::memory_order_relaxed);
+    uint64_t samplingInterval = samplingInterval_.load(std::memory_order_relaxed);
+    bytesUntilSample_ = NextSampleDistance(samplingInterval, nextRandom());
+    if (threadEpoch_ != epoch) {
+        // The first allocation of the thread since `Start`: the distance was computed with another interval, if any.
+        threadEpoch_ = epoch;
+        return;
+    }
+    // Skip this function; with `GetCurrentStackTraceAddresses` itself that's 2 extra frames.
+    KNativePtr frames[kMaxStackDepth + 2];
+    int frameCount = GetCurrentStackTraceAddresses(frames, kMaxStackDepth + 2, 1);
+    RecordSample(typeInfo, size, frames, frameCount);
+}
+
+void AllocationProfiler::RecordSample(const TypeInfo* typeInfo, size_t size, const KNativePtr* frames, int frameCount) noexcept {
+    SampleTable::Key key{typeInfo, KStdVector<KNativePtr>(frames, frames + frameCount)};
+    std::lock_guard<SpinLock> guard(samplesLock_);
+    if (samples_ == nullptr) {
+        samples_ = konanConstructInstance<SampleTable>();
+        RuntimeCheck(samples_ != nullptr, "Cannot allocate allocation profiler samples");
+    }
+    auto& value = samples_->samples[std::move(key)];
+    value.count++;
+    value.bytes += size;
+}
+
+void AllocationProfiler::WritePprof(KStdString& out) noexcept {
+    // The samples are copied out, so that the allocating threads aren't blocked while the profile is being symbolized.
+    KStdVector<std::pair<SampleTable::Key, SampleTable::Value>> samples;
+    {
+        std::lock_guard<SpinLock> guard(samplesLock_);
+        if (samples_ != nullptr) samples.assign(samples_->samples.begin(), samples_->samples.end());
+    }
+    double samplingInterval = static_cast<double>(samplingInterval_.load(std::memory_order_relaxed));
+
+    StringTable strings;
+    KStdUnorderedMap<KNativePtr, uint64_t> locations;
+    KStdVector<KNativePtr> locationAddresses;
+    ProtoWriter writer(out);
+
+    auto writeValueType = [&writer, &strings](int field, const char* type, const char* unit) {
+        writer.MessageField(field, [&](ProtoWriter& valueType) {
+            valueType.Uint64Field(pprof::kValueTypeType, strings.Intern(type));
+            valueType.Uint64Field(pprof::kValueTypeUnit, strings.Intern(unit));
+        });
+    };
+    writeValueType(pprof::kProfileSampleType, "alloc_objects", "count");
+    writeValueType(pprof::kProfileSampleType, "alloc_space", "bytes");
+
+    for (auto& entry : samples) {
+        const auto& key = entry.first;
+        const auto& value = entry.second;
+        KStdVector<uint64_t> locationIds;
+        for (auto frame : key.frames) {
+            auto it = locations.find(frame);
+            if (it == locations.end()) {
+                locationAddresses.push_back(frame);
+                it = locations.emplace(frame, locationAddresses.size()).first;
+            }
+            locationIds.push_back(it->second);
+        }
+        // Each sample stands for all the allocations of about the same size since the previous one:
+        // the sampling probability for an allocation of `size` bytes is `1 - exp(-size / interval)`.
+        double averageSize = static_cast<double>(value.bytes) / value.count;
+        double scale = 1 / (1 - std::exp(-averageSize / samplingInterval));
+        uint64_t values[] = {static_cast<uint64_t>(value.count * scale + 0.5), static_cast<uint64_t>(value.bytes * scale + 0.5)};
+        auto typeNameIndex = strings.Intern(QualifiedTypeName(key.typeInfo));
+        writer.MessageField(pprof::kProfileSample, [&](ProtoWriter& sample) {
+            sample.PackedField(pprof::kSampleLocationId, locationIds.size(), [&](size_t i) { return locationIds[i]; });
+            sample.PackedField(pprof::kSampleValue, 2, [&](size_t i) { return values[i]; });
+            sample.MessageField(pprof::kSampleLabel, [&](ProtoWriter& label) {
+                label.Uint64Field(pprof::kLabelKey, strings.Intern("type"));
+                label.Uint64Field(pprof::kLabelStr, typeNameIndex);
+            });
+            sample.MessageField(pprof::kSampleLabel, [&](ProtoWriter& label) {
+                label.Uint64Field(pprof::kLabelKey, strings.Intern("bytes"));
+                label.Uint64Field(pprof::kLabelNum, static_cast<uint64_t>(averageSize + 0.5));
+                label.Uint64Field(pprof::kLabelNumUnit, strings.Intern("bytes"));
+            });
+        });
+    }
+
+    // Locations are symbolized here when the runtime can do that, otherwise pprof symbolizes them with the binary.
+    KStdOrderedMap<KStdString, uint64_t> functions;
+    KStdVector<uint64_t> locationFunctions(locationAddresses.size(), 0);
+    for (size_t i = 0; i < locationAddresses.size(); ++i) {
+        char symbol[512];
+        if (!AddressToSymbol(locationAddresses[i], symbol, sizeof(symbol))) continue;
+        auto it = functions.emplace(KStdString(symbol), functions.size() + 1).first;
+        locationFunctions[i] = it->second;
+    }
+
+    // Only the modules with sampled locations are written. Locations outside of the known modules go to a mapping
+    // that covers the whole address space.
+    auto modules = LoadedModules();
+    std::sort(modules.begin(), modules.end(), [](const Module& lhs, const Module& rhs) { return lhs.start < rhs.start; });
+    KStdVector<uint64_t> moduleMappings(modules.size(), 0);
+    uint64_t unknownModuleMapping = 0;
+    KStdVector<Module> mappings;
+    KStdVector<bool> mappingHasFunctions;
+    KStdVector<uint64_t> locationMappings(locationAddresses.size(), 0);
+    for (size_t i = 0; i < locationAddresses.size(); ++i) {
+        auto address = reinterpret_cast<uintptr_t>(locationAddresses[i]);
+        auto it = std::upper_bound(
+                modules.begin(), modules.end(), address, [](uintptr_t address, const Module& module) { return address < module.start; });
+        uint64_t* mappingId = &unknownModuleMapping;
+        if (it != modules.begin() && address < std::prev(it)->limit) {
+            mappingId = &moduleMappings[std::prev(it) - modules.begin()];
+        }
+        if (*mappingId == 0) {
+            mappings.push_back(mappingId == &unknownModuleMapping ? Module{0, UINTPTR_MAX, 0, KStdString(), KStdString()} : *std::prev(it));
+            mappingHasFunctions.push_back(false);
+            *mappingId = mappings.size();
+        }
+        locationMappings[i] = *mappingId;
+        if (locationFunctions[i] != 0) mappingHasFunctions[*mappingId - 1] = true;
+    }
+    for (size_t i = 0; i < mappings.size(); ++i) {
+        auto filenameIndex = strings.Intern(mappings[i].filename);
+        auto buildIdIndex = strings.Intern(mappings[i].buildId);
+        writer.MessageField(pprof::kProfileMapping, [&](ProtoWriter& mapping) {
+            mapping.Uint64Field(pprof::kMappingId, i + 1);
+            mapping.Uint64Field(pprof::kMappingMemoryStart, mappings[i].start);
+            mapping.Uint64Field(pprof::kMappingMemoryLimit, mappings[i].limit);
+            mapping.Uint64Field(pprof::kMappingFileOffset, mappings[i].fileOffset);
+            mapping.Uint64Field(pprof::kMappingFilename, filenameIndex);
+            mapping.Uint64Field(pprof::kMappingBuildId, buildIdIndex);
+            mapping.BoolField(pprof::kMappingHasFunctions, mappingHasFunctions[i]);
+        });
+    }
+    for (size_t i = 0; i < locationAddresses.size(); ++i) {
+        writer.MessageField(pprof::kProfileLocation, [&](ProtoWriter& location) {
+            location.Uint64Field(pprof::kLocationId, i + 1);
+            location.Uint64Field(pprof::kLocationMappingId, locationMappings[i]);
+            location.Uint64Field(pprof::kLocationAddress, reinterpret_cast<uintptr_t>(locationAddresses[i]));
+            if (locationFunctions[i] != 0) {
+                location.MessageField(pprof::kLocationLine, [&](ProtoWriter& line) {
+                    line.Uint64Field(pprof::kLineFunctionId, locationFunctions[i]);
+                });
+            }
+        });
+    }
+    for (auto& function : functions) {
+        auto nameIndex = strings.Intern(function.first);
+        writer.MessageField(pprof::kProfileFunction, [&](ProtoWriter& message) {
+            message.Uint64Field(pprof::kFunctionId, function.second);
+            message.Uint64Field(pprof::kFunctionName, nameIndex);
+            message.Uint64Field(pprof::kFunctionSystemName, nameIndex);
+        });
+    }
+
+    writeValueType(pprof::kProfilePeriodType, "space", "bytes");
+    writer.Uint64Field(pprof::kProfilePeriod, static_cast<uint64_t>(samplingInterval));
+    // The string table goes last, as the messages above add to it.
+    for (auto& string : strings.strings()) {
+        writer.BytesField(pprof::kProfileStringTable, string);
+    }
+}
+
+bool AllocationProfiler::WritePprof(const char* path) noexcept {
+    KStdString profile;
+    WritePprof(profile);
+    return konan::writeFile(path, profile.data(), profile.size());
+}
+
+extern "C" {
+
+void Kotlin_AllocationProfiler_start(KLong samplingInterval) {
+    AllocationProfiler::Instance().Start(samplingInterval);
+}
+
+void Kotlin_AllocationProfiler_stop() {
+    AllocationProfiler::Instance().Stop();
+}
+
+void Kotlin_AllocationProfiler_clear() {
+    AllocationProfiler::Instance().Clear();
+}
+
+KBoolean Kotlin_AllocationProfiler_isEnabled() {
+    return AllocationProfiler::Instance().enabled();
+}
+
+KBoolean Kotlin_AllocationProfiler_writeProfile(KConstRef path) {
+    auto utf8Path = CreateCStringFromString(path);
+    bool result = AllocationProfiler::Instance().WritePprof(utf8Path);
+    DisposeCString(utf8Path);
+    return result;
+}
+
+} // extern "C"
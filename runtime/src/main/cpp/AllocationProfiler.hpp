@@ -0,0 +1,84 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_ALLOCATION_PROFILER_H
+#define RUNTIME_ALLOCATION_PROFILER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Common.h"
+#include "Mutex.hpp"
+#include "Types.h"
+#include "Utils.hpp"
+
+namespace kotlin {
+
+// Samples Kotlin heap allocations about every `samplingInterval` bytes and aggregates them by allocation stack
+// and type. The profile is written in the pprof format (https://github.com/google/pprof/blob/master/proto/profile.proto),
+// with the sampled values scaled back to estimate all the allocations.
+//
+// Disabled by default. When disabled, an allocation costs a single relaxed load.
+class AllocationProfiler : private Pinned {
+public:
+    static constexpr uint64_t kDefaultSamplingInterval = 512 * 1024;
+    static constexpr int kMaxStackDepth = 64;
+
+    static AllocationProfiler& Instance() noexcept { return instance_; }
+
+    // Must be called for each allocated object with its size in bytes.
+    static ALWAYS_INLINE void OnAllocation(const TypeInfo* typeInfo, size_t size) noexcept {
+        if (!instance_.enabled_.load(std::memory_order_relaxed)) return;
+        bytesUntilSample_ -= static_cast<int64_t>(size);
+        if (bytesUntilSample_ > 0) return;
+        instance_.OnSamplePoint(typeInfo, size);
+    }
+
+    // Starts sampling, keeping the samples collected so far.
+    void Start(uint64_t samplingInterval) noexcept;
+    void Stop() noexcept;
+    void Clear() noexcept;
+
+    bool enabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+    uint64_t samplingInterval() const noexcept { return samplingInterval_.load(std::memory_order_relaxed); }
+    // Number of distinct (stack, type) pairs sampled so far.
+    size_t sampleCount() noexcept;
+
+    // Appends the profile encoded as pprof `Profile` message.
+    void WritePprof(KStdString& out) noexcept;
+    // Writes the profile into the file at `path`. Returns false if the file couldn't be written.
+    bool WritePprof(const char* path) noexcept;
+
+    // Records one sample of an allocation of `size` bytes with the given stack, innermost frame first.
+    void RecordSample(const TypeInfo* typeInfo, size_t size, const KNativePtr* frames, int frameCount) noexcept;
+
+    // Returns an exponentially distributed distance to the next sample with the mean of `samplingInterval`,
+    // so that the sampling doesn't lock onto periodic allocation patterns. `random` is a uniform value from [0, 1).
+    static int64_t NextSampleDistance(uint64_t samplingInterval, double random) noexcept;
+
+private:
+    class SampleTable;
+
+    constexpr AllocationProfiler() noexcept = default;
+
+    NO_INLINE void OnSamplePoint(const TypeInfo* typeInfo, size_t size) noexcept;
+
+    static AllocationProfiler instance_;
+    static THREAD_LOCAL_VARIABLE int64_t bytesUntilSample_;
+    static THREAD_LOCAL_VARIABLE uint64_t threadEpoch_;
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<uint64_t> samplingInterval_{kDefaultSamplingInterval};
+    // Changed by each `Start`, so that threads reset their sampling distance with the new interval.
+    std::atomic<uint64_t> epoch_{0};
+    SpinLock samplesLock_;
+    // Created with the first sample.
+    SampleTable* samples_ = nullptr;
+};
+
+} // namespace kotlin
+
+#endif // RUNTIME_ALLOCATION_PROFILER_H
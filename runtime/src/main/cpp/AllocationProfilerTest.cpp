@@ -0,0 +1,231 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "AllocationProfiler.hpp"
+
+#include <map>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "TypeInfo.h"
+
+using namespace kotlin;
+
+namespace {
+
+struct Field {
+    int number;
+    uint64_t value;
+    std::string bytes;
+};
+
+uint64_t ReadVarint(const std::string& data, size_t& position) {
+    uint64_t result = 0;
+    for (int shift = 0;; shift += 7) {
+        uint8_t byte = data.at(position++);
+        result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) return result;
+    }
+}
+
+// Decodes top-level fields of a protobuf message that only uses varint and length-delimited fields.
+std::vector<Field> Decode(const std::string& data) {
+    std::vector<Field> result;
+    size_t position = 0;
+    while (position < data.size()) {
+        uint64_t tag = ReadVarint(data, position);
+        Field field{static_cast<int>(tag >> 3), 0, ""};
+        switch (tag & 7) {
+            case 0:
+                field.value = ReadVarint(data, position);
+                break;
+            case 2: {
+                uint64_t size = ReadVarint(data, position);
+                field.bytes = data.substr(position, size);
+                position += size;
+                break;
+            }
+            default:
+                ADD_FAILURE() << "Unexpected wire type " << (tag & 7);
+                return result;
+        }
+        result.push_back(field);
+    }
+    return result;
+}
+
+std::vector<Field> FieldsOf(const std::vector<Field>& fields, int number) {
+    std::vector<Field> result;
+    for (auto& field : fields) {
+        if (field.number == number) result.push_back(field);
+    }
+    return result;
+}
+
+std::vector<std::string> StringTable(const std::vector<Field>& profile) {
+    std::vector<std::string> result;
+    for (auto& field : FieldsOf(profile, 6)) {
+        result.push_back(field.bytes);
+    }
+    return result;
+}
+
+std::vector<Field> WriteProfile() {
+    KStdString out;
+    AllocationProfiler::Instance().WritePprof(out);
+    return Decode(std::string(out.begin(), out.end()));
+}
+
+class AllocationProfilerTest : public testing::Test {
+public:
+    AllocationProfilerTest() { AllocationProfiler::Instance().Clear(); }
+
+    ~AllocationProfilerTest() override {
+        AllocationProfiler::Instance().Stop();
+        AllocationProfiler::Instance().Clear();
+    }
+};
+
+} // namespace
+
+TEST(AllocationProfilerSamplingTest, NextSampleDistance) {
+    constexpr int kCount = 10000;
+    constexpr uint64_t kInterval = 1000;
+    double sum = 0;
+    for (int i = 0; i < kCount; ++i) {
+        auto distance = AllocationProfiler::NextSampleDistance(kInterval, (i + 0.5) / kCount);
+        EXPECT_GT(distance, 0);
+        EXPECT_LE(distance, static_cast<int64_t>(kInterval * 64 + 1));
+        sum += distance;
+    }
+    EXPECT_NEAR(sum / kCount, kInterval, kInterval * 0.05);
+    EXPECT_THAT(AllocationProfiler::NextSampleDistance(kInterval, 0), 1);
+}
+
+TEST_F(AllocationProfilerTest, DisabledByDefault) {
+    TypeInfo type{};
+    for (int i = 0; i < 1000; ++i) {
+        AllocationProfiler::OnAllocation(&type, 1024 * 1024);
+    }
+    EXPECT_FALSE(AllocationProfiler::Instance().enabled());
+    EXPECT_THAT(AllocationProfiler::Instance().sampleCount(), 0);
+}
+
+TEST_F(AllocationProfilerTest, SamplesWhenEnabled) {
+    TypeInfo type{};
+    AllocationProfiler::Instance().Start(1);
+    for (int i = 0; i < 10; ++i) {
+        AllocationProfiler::OnAllocation(&type, 1024);
+    }
+    AllocationProfiler::Instance().Stop();
+    // All the samples have the same type and stack.
+    EXPECT_THAT(AllocationProfiler::Instance().sampleCount(), 1);
+}
+
+TEST_F(AllocationProfilerTest, AggregatesByStackAndType) {
+    TypeInfo type1{};
+    TypeInfo type2{};
+    KNativePtr stack1[] = {reinterpret_cast<KNativePtr>(0x1000), reinterpret_cast<KNativePtr>(0x2000)};
+    KNativePtr stack2[] = {reinterpret_cast<KNativePtr>(0x1000), reinterpret_cast<KNativePtr>(0x3000)};
+    auto& profiler = AllocationProfiler::Instance();
+    profiler.RecordSample(&type1, 16, stack1, 2);
+    profiler.RecordSample(&type1, 16, stack1, 2);
+    profiler.RecordSample(&type1, 16, stack2, 2);
+    profiler.RecordSample(&type2, 16, stack1, 2);
+
+    EXPECT_THAT(profiler.sampleCount(), 3);
+}
+
+TEST_F(AllocationProfilerTest, WritePprof) {
+    TypeInfo type{};
+    KNativePtr stack1[] = {reinterpret_cast<KNativePtr>(0x1000), reinterpret_cast<KNativePtr>(0x2000)};
+    KNativePtr stack2[] = {reinterpret_cast<KNativePtr>(0x1000)};
+    auto& profiler = AllocationProfiler::Instance();
+    profiler.Start(1024);
+    profiler.RecordSample(&type, 1024 * 1024, stack1, 2);
+    profiler.RecordSample(&type, 1024 * 1024, stack1, 2);
+    profiler.RecordSample(&type, 1024 * 1024, stack2, 1);
+
+    auto profile = WriteProfile();
+    auto strings = StringTable(profile);
+    ASSERT_THAT(strings, testing::Not(testing::IsEmpty()));
+    EXPECT_THAT(strings[0], "");
+    EXPECT_THAT(strings, testing::IsSupersetOf({"alloc_objects", "alloc_space", "count", "bytes", "space", "type", "<anonymous>"}));
+
+    EXPECT_THAT(FieldsOf(profile, 1), testing::SizeIs(2));
+    EXPECT_THAT(FieldsOf(profile, 4), testing::SizeIs(2));
+    EXPECT_THAT(FieldsOf(profile, 12), testing::ElementsAre(testing::Field(&Field::value, 1024)));
+
+    auto samples = FieldsOf(profile, 2);
+    ASSERT_THAT(samples, testing::SizeIs(2));
+    std::vector<uint64_t> objects;
+    for (auto& sample : samples) {
+        auto values = FieldsOf(Decode(sample.bytes), 2);
+        ASSERT_THAT(values, testing::SizeIs(1));
+        size_t position = 0;
+        objects.push_back(ReadVarint(values[0].bytes, position));
+        uint64_t bytes = ReadVarint(values[0].bytes, position);
+        // Allocations much bigger than the sampling interval are always sampled, so there's nothing to scale.
+        EXPECT_THAT(bytes, objects.back() * 1024 * 1024);
+    }
+    EXPECT_THAT(objects, testing::UnorderedElementsAre(1, 2));
+}
+
+TEST_F(AllocationProfilerTest, WritePprofMappings) {
+    TypeInfo type{};
+    // An address in this binary, and one outside of any module.
+    KNativePtr stack[] = {reinterpret_cast<KNativePtr>(&ReadVarint), reinterpret_cast<KNativePtr>(0x1000)};
+    auto& profiler = AllocationProfiler::Instance();
+    profiler.Start(1024);
+    profiler.RecordSample(&type, 1024, stack, 2);
+
+    auto profile = WriteProfile();
+    auto strings = StringTable(profile);
+    auto mappings = FieldsOf(profile, 3);
+    ASSERT_THAT(mappings, testing::Not(testing::IsEmpty()));
+    std::map<uint64_t, std::vector<Field>> mappingsById;
+    for (auto& mapping : mappings) {
+        auto fields = Decode(mapping.bytes);
+        ASSERT_THAT(FieldsOf(fields, 1), testing::SizeIs(1));
+        mappingsById[FieldsOf(fields, 1)[0].value] = fields;
+    }
+    std::map<uint64_t, uint64_t> locationMappings;
+    for (auto& location : FieldsOf(profile, 4)) {
+        auto fields = Decode(location.bytes);
+        auto mappingIds = FieldsOf(fields, 2);
+        ASSERT_THAT(mappingIds, testing::SizeIs(1));
+        EXPECT_THAT(mappingsById, testing::Contains(testing::Key(mappingIds[0].value)));
+        auto addresses = FieldsOf(fields, 3);
+        ASSERT_THAT(addresses, testing::SizeIs(1));
+        locationMappings[addresses[0].value] = mappingIds[0].value;
+    }
+    ASSERT_THAT(locationMappings, testing::SizeIs(2));
+
+    auto valueOf = [](const std::vector<Field>& fields, int number) {
+        auto values = FieldsOf(fields, number);
+        return values.empty() ? 0 : values[0].value;
+    };
+    auto& unknown = mappingsById[locationMappings[0x1000]];
+    EXPECT_THAT(valueOf(unknown, 2), 0);
+    EXPECT_THAT(valueOf(unknown, 3), UINTPTR_MAX);
+#if USE_ELF_SYMBOLS || KONAN_OBJC_INTEROP
+    auto address = reinterpret_cast<uintptr_t>(&ReadVarint);
+    auto& module = mappingsById[locationMappings[address]];
+    EXPECT_THAT(locationMappings[address], testing::Ne(locationMappings[0x1000]));
+    EXPECT_THAT(valueOf(module, 2), testing::Le(address));
+    EXPECT_THAT(valueOf(module, 3), testing::Gt(address));
+    EXPECT_THAT(strings.at(valueOf(module, 5)), testing::Not(testing::IsEmpty()));
+#endif
+}
+
+TEST_F(AllocationProfilerTest, WriteEmptyPprof) {
+    auto profile = WriteProfile();
+
+    EXPECT_THAT(FieldsOf(profile, 2), testing::IsEmpty());
+    EXPECT_THAT(FieldsOf(profile, 4), testing::IsEmpty());
+    EXPECT_THAT(StringTable(profile), testing::Contains("alloc_space"));
+}
@@ -0,0 +1,269 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ArrayKernels.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+using namespace kotlin;
+
+namespace {
+
+constexpr size_t kVectorSize = 16;
+
+// Unsigned integer with the size of `T`: elements are moved and compared as bits.
+template <typename T>
+using Bits = std::conditional_t<sizeof(T) == 1, uint8_t,
+        std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+// Compiles to SSE2 or NEON where available, and to scalar code elsewhere.
+typedef uint8_t __attribute__((__vector_size__(kVectorSize))) Vector8;
+typedef uint16_t __attribute__((__vector_size__(kVectorSize))) Vector16;
+typedef uint32_t __attribute__((__vector_size__(kVectorSize))) Vector32;
+typedef uint64_t __attribute__((__vector_size__(kVectorSize))) Vector64;
+
+template <typename T>
+using Vector = std::conditional_t<sizeof(T) == 1, Vector8,
+        std::conditional_t<sizeof(T) == 2, Vector16, std::conditional_t<sizeof(T) == 4, Vector32, Vector64>>>;
+
+template <typename T>
+constexpr size_t kLaneCount = kVectorSize / sizeof(T);
+
+using HashVector = Vector32;
+
+template <typename T>
+inline Bits<T> ToBits(T value) noexcept {
+    Bits<T> result;
+    memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+template <typename T>
+inline Vector<T> Load(const T* elements) noexcept {
+    Vector<T> result;
+    memcpy(&result, elements, sizeof(result));
+    return result;
+}
+
+template <typename T>
+inline Vector<T> Splat(T value) noexcept {
+    Vector<T> result;
+    for (size_t lane = 0; lane < kLaneCount<T>; ++lane) {
+        result[lane] = ToBits(value);
+    }
+    return result;
+}
+
+template <typename T>
+inline bool Any(Vector<T> vector) noexcept {
+    uint64_t words[2];
+    memcpy(words, &vector, sizeof(words));
+    return (words[0] | words[1]) != 0;
+}
+
+template <typename T>
+inline bool ElementEquals(T first, T second) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        return ToBits(first) == ToBits(second) || (std::isnan(first) && std::isnan(second));
+    } else {
+        return first == second;
+    }
+}
+
+// `hashCode` of the boxed element.
+template <typename T>
+inline uint32_t ElementHashCode(T value) noexcept {
+    if constexpr (std::is_floating_point_v<T> || sizeof(T) == 8) {
+        uint64_t bits = ToBits(value);
+        return sizeof(T) == 8 ? static_cast<uint32_t>(bits ^ (bits >> 32)) : static_cast<uint32_t>(bits);
+    } else {
+        return static_cast<uint32_t>(static_cast<int32_t>(value));
+    }
+}
+
+// Lanes of the block at `elements` equal to `value` by bits have all their bits set, the others are zero.
+template <typename T>
+inline Vector<T> EqualLanes(const T* elements, Vector<T> value) noexcept {
+    return __builtin_convertvector(Load(elements) == value, Vector<T>);
+}
+
+uint32_t PowerOf31(size_t exponent) noexcept {
+    uint32_t result = 1;
+    uint32_t base = 31;
+    while (exponent != 0) {
+        if ((exponent & 1) != 0) result *= base;
+        base *= base;
+        exponent >>= 1;
+    }
+    return result;
+}
+
+inline uint16_t ByteSwap(uint16_t value) noexcept {
+    return __builtin_bswap16(value);
+}
+
+inline uint32_t ByteSwap(uint32_t value) noexcept {
+    return __builtin_bswap32(value);
+}
+
+inline uint64_t ByteSwap(uint64_t value) noexcept {
+    return __builtin_bswap64(value);
+}
+
+} // namespace
+
+template <typename T>
+void kotlin::FillArray(T* to, size_t count, T value) noexcept {
+    if constexpr (sizeof(T) == 1) {
+        memset(to, ToBits(value), count);
+    } else {
+        Vector<T> vector = Splat(value);
+        size_t index = 0;
+        for (; index + kLaneCount<T> <= count; index += kLaneCount<T>) {
+            memcpy(to + index, &vector, sizeof(vector));
+        }
+        for (; index < count; ++index) {
+            to[index] = value;
+        }
+    }
+}
+
+template <typename T>
+bool kotlin::ArrayContentEquals(const T* first, const T* second, size_t count) noexcept {
+    if constexpr (!std::is_floating_point_v<T>) {
+        return memcmp(first, second, count * sizeof(T)) == 0;
+    } else {
+        // Different bits are still equal if both are NaNs.
+        size_t index = 0;
+        for (; index + kLaneCount<T> <= count; index += kLaneCount<T>) {
+            if (!Any<T>(Load(first + index) ^ Load(second + index))) continue;
+            for (size_t i = index; i < index + kLaneCount<T>; ++i) {
+                if (!ElementEquals(first[i], second[i])) return false;
+            }
+        }
+        for (; index < count; ++index) {
+            if (!ElementEquals(first[index], second[index])) return false;
+        }
+        return true;
+    }
+}
+
+template <typename T>
+int32_t kotlin::ArrayContentHashCode(const T* elements, size_t count) noexcept {
+    // Lane `j` accumulates elements `4k + j` with the multiplier 31^4 per block, so that for `n` elements
+    //   1 * 31^n + lanes[0] * 31^3 + lanes[1] * 31^2 + lanes[2] * 31 + lanes[3]
+    // is the usual `31 * result + element` hash code.
+    constexpr size_t kHashLaneCount = sizeof(HashVector) / sizeof(uint32_t);
+    constexpr uint32_t kBlockMultiplier = 31 * 31 * 31 * 31;
+    size_t index = 0;
+    uint32_t result = 1;
+    if (count >= 2 * kHashLaneCount) {
+        HashVector lanes = {0, 0, 0, 0};
+        for (; index + kHashLaneCount <= count; index += kHashLaneCount) {
+            HashVector block = {
+                    ElementHashCode(elements[index]), ElementHashCode(elements[index + 1]),
+                    ElementHashCode(elements[index + 2]), ElementHashCode(elements[index + 3])};
+            lanes = lanes * kBlockMultiplier + block;
+        }
+        result = PowerOf31(index) + lanes[0] * (31 * 31 * 31) + lanes[1] * (31 * 31) + lanes[2] * 31 + lanes[3];
+    }
+    for (; index < count; ++index) {
+        result = 31 * result + ElementHashCode(elements[index]);
+    }
+    return static_cast<int32_t>(result);
+}
+
+template <typename T>
+size_t kotlin::ArrayIndexOf(const T* elements, size_t count, T value) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        // NaNs with any bits are equal to each other.
+        if (std::isnan(value)) {
+            for (size_t index = 0; index < count; ++index) {
+                if (std::isnan(elements[index])) return index;
+            }
+            return count;
+        }
+    }
+    Vector<T> splat = Splat(value);
+    size_t index = 0;
+    for (; index + kLaneCount<T> <= count; index += kLaneCount<T>) {
+        Vector<T> equal = EqualLanes(elements + index, splat);
+        if (!Any<T>(equal)) continue;
+        for (size_t lane = 0;; ++lane) {
+            if (equal[lane] != 0) return index + lane;
+        }
+    }
+    for (; index < count; ++index) {
+        if (ToBits(elements[index]) == ToBits(value)) return index;
+    }
+    return count;
+}
+
+template <typename T>
+size_t kotlin::ArrayLastIndexOf(const T* elements, size_t count, T value) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        if (std::isnan(value)) {
+            for (size_t index = count; index > 0; --index) {
+                if (std::isnan(elements[index - 1])) return index - 1;
+            }
+            return count;
+        }
+    }
+    Vector<T> splat = Splat(value);
+    // Blocks end at `index`, the head that doesn't fill a block is checked last.
+    size_t index = count;
+    for (; index >= kLaneCount<T>; index -= kLaneCount<T>) {
+        Vector<T> equal = EqualLanes(elements + index - kLaneCount<T>, splat);
+        if (!Any<T>(equal)) continue;
+        for (size_t lane = kLaneCount<T>;; --lane) {
+            if (equal[lane - 1] != 0) return index - kLaneCount<T> + lane - 1;
+        }
+    }
+    for (; index > 0; --index) {
+        if (ToBits(elements[index - 1]) == ToBits(value)) return index - 1;
+    }
+    return count;
+}
+
+template <typename T>
+void kotlin::ReadLittleEndian(const uint8_t* from, size_t count, T* to) noexcept {
+#if __BIG_ENDIAN__
+    for (size_t index = 0; index < count; ++index) {
+        Bits<T> bits;
+        memcpy(&bits, from + index * sizeof(T), sizeof(bits));
+        bits = ByteSwap(bits);
+        memcpy(to + index, &bits, sizeof(bits));
+    }
+#else
+    memcpy(to, from, count * sizeof(T));
+#endif
+}
+
+#define INSTANTIATE_ARRAY_KERNELS(T) \
+    template void kotlin::FillArray<T>(T*, size_t, T) noexcept; \
+    template bool kotlin::ArrayContentEquals<T>(const T*, const T*, size_t) noexcept; \
+    template int32_t kotlin::ArrayContentHashCode<T>(const T*, size_t) noexcept; \
+    template size_t kotlin::ArrayIndexOf<T>(const T*, size_t, T) noexcept; \
+    template size_t kotlin::ArrayLastIndexOf<T>(const T*, size_t, T) noexcept;
+
+INSTANTIATE_ARRAY_KERNELS(KBoolean)
+INSTANTIATE_ARRAY_KERNELS(KByte)
+INSTANTIATE_ARRAY_KERNELS(KChar)
+INSTANTIATE_ARRAY_KERNELS(KShort)
+INSTANTIATE_ARRAY_KERNELS(KInt)
+INSTANTIATE_ARRAY_KERNELS(KLong)
+INSTANTIATE_ARRAY_KERNELS(KFloat)
+INSTANTIATE_ARRAY_KERNELS(KDouble)
+
+#undef INSTANTIATE_ARRAY_KERNELS
+
+template void kotlin::ReadLittleEndian<KChar>(const uint8_t*, size_t, KChar*) noexcept;
+template void kotlin::ReadLittleEndian<KShort>(const uint8_t*, size_t, KShort*) noexcept;
+template void kotlin::ReadLittleEndian<KInt>(const uint8_t*, size_t, KInt*) noexcept;
+template void kotlin::ReadLittleEndian<KLong>(const uint8_t*, size_t, KLong*) noexcept;
+template void kotlin::ReadLittleEndian<KFloat>(const uint8_t*, size_t, KFloat*) noexcept;
+template void kotlin::ReadLittleEndian<KDouble>(const uint8_t*, size_t, KDouble*) noexcept;
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_ARRAY_KERNELS_H
+#define RUNTIME_ARRAY_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Types.h"
+
+namespace kotlin {
+
+// Bulk operations on elements of primitive arrays, processing blocks of elements 16 bytes per step.
+// Defined for all primitive array element types: KBoolean, KByte, KChar, KShort, KInt, KLong, KFloat and KDouble.
+
+template <typename T>
+void FillArray(T* to, size_t count, T value) noexcept;
+
+// Whether the elements are pairwise equal as by `equals`: floating point values are compared by their bits,
+// except that all NaNs are equal to each other.
+template <typename T>
+bool ArrayContentEquals(const T* first, const T* second, size_t count) noexcept;
+
+// `hashCode` of a `List` with the elements.
+template <typename T>
+int32_t ArrayContentHashCode(const T* elements, size_t count) noexcept;
+
+// Index of the first element equal to `value` as by `ArrayContentEquals`, or `count` if there's none.
+template <typename T>
+size_t ArrayIndexOf(const T* elements, size_t count, T value) noexcept;
+
+// Index of the last element equal to `value` as by `ArrayContentEquals`, or `count` if there's none.
+template <typename T>
+size_t ArrayLastIndexOf(const T* elements, size_t count, T value) noexcept;
+
+// Reads `count` values stored in the little-endian byte order. Not defined for KBoolean and KByte.
+template <typename T>
+void ReadLittleEndian(const uint8_t* from, size_t count, T* to) noexcept;
+
+} // namespace kotlin
+
+#endif // RUNTIME_ARRAY_KERNELS_H
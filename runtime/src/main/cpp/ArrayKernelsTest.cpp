@@ -0,0 +1,166 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "ArrayKernels.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace kotlin;
+
+namespace {
+
+// Straightforward `31 * result + hashCode` over the elements.
+template <typename T, typename Hash>
+int32_t NaiveHashCode(const T* elements, size_t count, Hash hash) {
+    uint32_t result = 1;
+    for (size_t i = 0; i < count; ++i) {
+        result = 31 * result + static_cast<uint32_t>(hash(elements[i]));
+    }
+    return static_cast<int32_t>(result);
+}
+
+} // namespace
+
+TEST(ArrayKernelsTest, FillArray) {
+    for (size_t count = 0; count < 40; ++count) {
+        KStdVector<KInt> ints(count + 2, 7);
+        FillArray(ints.data() + 1, count, -5);
+        EXPECT_THAT(ints.front(), 7);
+        EXPECT_THAT(ints.back(), 7);
+        EXPECT_THAT(std::count(ints.begin() + 1, ints.end() - 1, -5), count);
+
+        KStdVector<KByte> bytes(count, 0);
+        FillArray<KByte>(bytes.data(), count, -1);
+        EXPECT_THAT(std::count(bytes.begin(), bytes.end(), -1), count);
+
+        KStdVector<KDouble> doubles(count, 0.0);
+        FillArray(doubles.data(), count, -0.5);
+        EXPECT_THAT(std::count(doubles.begin(), doubles.end(), -0.5), count);
+    }
+}
+
+TEST(ArrayKernelsTest, ContentEqualsIntegral) {
+    for (size_t count = 0; count < 40; ++count) {
+        KStdVector<KShort> first(count);
+        for (size_t i = 0; i < count; ++i) first[i] = static_cast<KShort>(i * 1000);
+        KStdVector<KShort> second = first;
+        EXPECT_TRUE(ArrayContentEquals(first.data(), second.data(), count));
+        for (size_t i = 0; i < count; ++i) {
+            second[i] = static_cast<KShort>(second[i] + 1);
+            EXPECT_FALSE(ArrayContentEquals(first.data(), second.data(), count));
+            second[i] = first[i];
+        }
+    }
+}
+
+TEST(ArrayKernelsTest, ContentEqualsFloatingPoint) {
+    KDouble nan = std::numeric_limits<KDouble>::quiet_NaN();
+    KDouble otherNan = -nan;
+    KStdVector<KDouble> first = {1.0, nan, 3.0, 4.0, 0.0, 6.0};
+    KStdVector<KDouble> second = {1.0, otherNan, 3.0, 4.0, 0.0, 6.0};
+    EXPECT_TRUE(ArrayContentEquals(first.data(), second.data(), first.size()));
+
+    second[4] = -0.0;
+    EXPECT_FALSE(ArrayContentEquals(first.data(), second.data(), first.size()));
+
+    KStdVector<KFloat> floats(9, std::numeric_limits<KFloat>::quiet_NaN());
+    KStdVector<KFloat> otherFloats(9, -std::numeric_limits<KFloat>::quiet_NaN());
+    EXPECT_TRUE(ArrayContentEquals(floats.data(), otherFloats.data(), floats.size()));
+    otherFloats[8] = 1.0f;
+    EXPECT_FALSE(ArrayContentEquals(floats.data(), otherFloats.data(), floats.size()));
+}
+
+TEST(ArrayKernelsTest, ContentHashCode) {
+    for (size_t count = 0; count < 40; ++count) {
+        KStdVector<KInt> ints(count);
+        KStdVector<KByte> bytes(count);
+        KStdVector<KChar> chars(count);
+        KStdVector<KLong> longs(count);
+        KBoolean booleans[40] = {};
+        KStdVector<KDouble> doubles(count);
+        for (size_t i = 0; i < count; ++i) {
+            ints[i] = static_cast<KInt>(i * 2654435761u);
+            bytes[i] = static_cast<KByte>(i * 37);
+            chars[i] = static_cast<KChar>(0xfff0 + i);
+            longs[i] = static_cast<KLong>(i) * -0x123456789LL;
+            booleans[i] = i % 3 == 0;
+            doubles[i] = i * 1.5 - 10;
+        }
+
+        EXPECT_THAT(ArrayContentHashCode(ints.data(), count), NaiveHashCode(ints.data(), count, [](KInt value) { return value; }));
+        EXPECT_THAT(ArrayContentHashCode(bytes.data(), count), NaiveHashCode(bytes.data(), count, [](KByte value) { return KInt(value); }));
+        EXPECT_THAT(ArrayContentHashCode(chars.data(), count), NaiveHashCode(chars.data(), count, [](KChar value) { return KInt(value); }));
+        EXPECT_THAT(ArrayContentHashCode(longs.data(), count), NaiveHashCode(longs.data(), count, [](KLong value) {
+            return static_cast<KInt>(static_cast<uint64_t>(value) ^ (static_cast<uint64_t>(value) >> 32));
+        }));
+        EXPECT_THAT(ArrayContentHashCode(booleans, count), NaiveHashCode(booleans, count, [](KBoolean value) {
+            return value ? 1 : 0;
+        }));
+        EXPECT_THAT(ArrayContentHashCode(doubles.data(), count), NaiveHashCode(doubles.data(), count, [](KDouble value) {
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return static_cast<KInt>(bits ^ (bits >> 32));
+        }));
+    }
+}
+
+TEST(ArrayKernelsTest, IndexOfIntegral) {
+    for (size_t count = 0; count < 40; ++count) {
+        KStdVector<KShort> shorts(count, 7);
+        KStdVector<KLong> longs(count, -1);
+        EXPECT_THAT(ArrayIndexOf(shorts.data(), count, KShort(8)), count);
+        EXPECT_THAT(ArrayLastIndexOf(longs.data(), count, KLong(0)), count);
+        for (size_t position = 0; position < count; ++position) {
+            shorts[position] = 8;
+            longs[position] = 0;
+            EXPECT_THAT(ArrayIndexOf(shorts.data(), count, KShort(8)), position);
+            EXPECT_THAT(ArrayLastIndexOf(longs.data(), count, KLong(0)), position);
+            shorts[position] = 7;
+            longs[position] = -1;
+        }
+    }
+
+    KByte bytes[] = {1, 2, 3, 2, 1, 2, 3, 2, 1, 2, 3, 2, 1, 2, 3, 2, 1, 2, 3};
+    EXPECT_THAT(ArrayIndexOf(bytes, std::size(bytes), KByte(3)), 2);
+    EXPECT_THAT(ArrayLastIndexOf(bytes, std::size(bytes), KByte(3)), 18);
+    EXPECT_THAT(ArrayLastIndexOf(bytes, std::size(bytes), KByte(1)), 16);
+}
+
+TEST(ArrayKernelsTest, IndexOfFloatingPoint) {
+    KDouble nan = std::numeric_limits<KDouble>::quiet_NaN();
+    KStdVector<KDouble> doubles = {1.0, -0.0, -nan, 0.0, 1.0, nan};
+    EXPECT_THAT(ArrayIndexOf(doubles.data(), doubles.size(), 0.0), 3);
+    EXPECT_THAT(ArrayIndexOf(doubles.data(), doubles.size(), -0.0), 1);
+    EXPECT_THAT(ArrayIndexOf(doubles.data(), doubles.size(), nan), 2);
+    EXPECT_THAT(ArrayLastIndexOf(doubles.data(), doubles.size(), -nan), 5);
+    EXPECT_THAT(ArrayLastIndexOf(doubles.data(), doubles.size(), 1.0), 4);
+    EXPECT_THAT(ArrayIndexOf(doubles.data(), doubles.size(), 2.0), doubles.size());
+
+    KStdVector<KFloat> floats(9, 1.0f);
+    EXPECT_THAT(ArrayIndexOf(floats.data(), floats.size(), std::numeric_limits<KFloat>::quiet_NaN()), floats.size());
+    floats[6] = std::numeric_limits<KFloat>::quiet_NaN();
+    EXPECT_THAT(ArrayLastIndexOf(floats.data(), floats.size(), -std::numeric_limits<KFloat>::quiet_NaN()), 6);
+}
+
+TEST(ArrayKernelsTest, ReadLittleEndian) {
+    uint8_t bytes[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09};
+
+    KStdVector<KInt> ints(2);
+    ReadLittleEndian(bytes + 1, ints.size(), ints.data());
+    EXPECT_THAT(ints, testing::ElementsAre(0x05040302, 0x09080706));
+
+    KStdVector<KChar> chars(4);
+    ReadLittleEndian(bytes, chars.size(), chars.data());
+    EXPECT_THAT(chars, testing::ElementsAre(0x0201, 0x0403, 0x0605, 0x0807));
+
+    KStdVector<KLong> longs(1);
+    ReadLittleEndian(bytes, longs.size(), longs.data());
+    EXPECT_THAT(longs, testing::ElementsAre(0x0807060504030201LL));
+}
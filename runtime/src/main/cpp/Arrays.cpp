@@ -17,8 +17,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "ArrayKernels.hpp"
 #include "KAssert.h"
 #include "Exceptions.h"
+#include "KString.h"
 #include "Memory.h"
 #include "Natives.h"
 #include "Types.h"
@@ -27,11 +29,23 @@ extern "C" void checkRangeIndexes(KInt from, KInt to, KInt size);
 
 namespace {
 
-ALWAYS_INLINE inline void mutabilityCheck(KConstRef thiz) {
-  // TODO: optimize it!
-  if (!thiz->local() && isFrozen(thiz)) {
+// The last array that passed the mutability check on this thread, valid until anything gets frozen.
+// Makes checks in loops writing to the same array avoid the container lookup.
+THREAD_LOCAL_VARIABLE KConstRef lastMutableArray = nullptr;
+THREAD_LOCAL_VARIABLE int32_t lastMutableArrayFreezeCount = 0;
+
+NO_INLINE void mutabilityCheckSlowPath(KConstRef thiz, int32_t currentFreezeCount) {
+  if (!thiz->local() && isPermanentOrFrozen(thiz)) {
       ThrowInvalidMutabilityException(thiz);
   }
+  lastMutableArray = thiz;
+  lastMutableArrayFreezeCount = currentFreezeCount;
+}
+
+ALWAYS_INLINE inline void mutabilityCheck(KConstRef thiz) {
+  int32_t currentFreezeCount = atomicGet(&freezeCount);
+  if (thiz == lastMutableArray && currentFreezeCount == lastMutableArrayFreezeCount) return;
+  mutabilityCheckSlowPath(thiz, currentFreezeCount);
 }
 
 ALWAYS_INLINE inline void boundsCheck(const ArrayHeader* array, KInt index) {
@@ -48,10 +62,7 @@ inline void fillImpl(KRef thiz, KInt fromIndex, KInt toIndex, T value) {
   ArrayHeader* array = thiz->array();
   checkRangeIndexes(fromIndex, toIndex, array->count_);
   mutabilityCheck(thiz);
-  T* address = PrimitiveArrayAddressOfElementAt<T>(array, fromIndex);
-  for (KInt index = fromIndex; index < toIndex; ++index) {
-    *address++ = value;
-  }
+  kotlin::FillArray(PrimitiveArrayAddressOfElementAt<T>(array, fromIndex), toIndex - fromIndex, value);
 }
 
 template<typename T>
@@ -71,6 +82,51 @@ inline void copyImpl(KConstRef thiz, KInt fromIndex,
 }
 
 
+template<typename T>
+inline KBoolean contentEqualsImpl(KConstRef thiz, KConstRef other) {
+  const ArrayHeader* array = thiz->array();
+  const ArrayHeader* otherArray = other->array();
+  return array->count_ == otherArray->count_ &&
+      kotlin::ArrayContentEquals(PrimitiveArrayAddressOfElementAt<T>(array, 0),
+                                 PrimitiveArrayAddressOfElementAt<T>(otherArray, 0),
+                                 array->count_);
+}
+
+template<typename T>
+inline KInt contentHashCodeImpl(KConstRef thiz) {
+  const ArrayHeader* array = thiz->array();
+  return kotlin::ArrayContentHashCode(PrimitiveArrayAddressOfElementAt<T>(array, 0), array->count_);
+}
+
+template<typename T>
+inline KInt indexOfImpl(KConstRef thiz, T element) {
+  const ArrayHeader* array = thiz->array();
+  size_t index = kotlin::ArrayIndexOf(PrimitiveArrayAddressOfElementAt<T>(array, 0), array->count_, element);
+  return index == array->count_ ? -1 : static_cast<KInt>(index);
+}
+
+template<typename T>
+inline KInt lastIndexOfImpl(KConstRef thiz, T element) {
+  const ArrayHeader* array = thiz->array();
+  size_t index = kotlin::ArrayLastIndexOf(PrimitiveArrayAddressOfElementAt<T>(array, 0), array->count_, element);
+  return index == array->count_ ? -1 : static_cast<KInt>(index);
+}
+
+// Reads `count` little-endian values starting from byte `index` into `destination` starting from `destinationOffset`.
+template<typename T>
+inline void getValuesAt(KConstRef thiz, KInt index, KRef destination, KInt destinationOffset, KInt count) {
+  const ArrayHeader* array = thiz->array();
+  ArrayHeader* destinationArray = destination->array();
+  if (count < 0 ||
+      index < 0 || static_cast<uint64_t>(count) * sizeof(T) + index > array->count_ ||
+      destinationOffset < 0 || static_cast<uint32_t>(count) + destinationOffset > destinationArray->count_) {
+      ThrowArrayIndexOutOfBoundsException();
+  }
+  mutabilityCheck(destination);
+  kotlin::ReadLittleEndian(reinterpret_cast<const uint8_t*>(ByteArrayAddressOfElementAt(array, index)), count,
+                           PrimitiveArrayAddressOfElementAt<T>(destinationArray, destinationOffset));
+}
+
 template <class T>
 inline void PrimitiveArraySet(KRef thiz, KInt index, T value) {
   ArrayHeader* array = thiz->array();
@@ -118,9 +174,7 @@ void Kotlin_Array_fillImpl(KRef thiz, KInt fromIndex, KInt toIndex, KRef value)
   ArrayHeader* array = thiz->array();
   checkRangeIndexes(fromIndex, toIndex, array->count_);
   mutabilityCheck(thiz);
-  for (KInt index = fromIndex; index < toIndex; ++index) {
-    UpdateHeapRef(ArrayAddressOfElementAt(array, index), value);
-  }
+  FillHeapRefs(ArrayAddressOfElementAt(array, fromIndex), value, toIndex - fromIndex);
 }
 
 void Kotlin_Array_copyImpl(KConstRef thiz, KInt fromIndex,
@@ -133,17 +187,7 @@ void Kotlin_Array_copyImpl(KConstRef thiz, KInt fromIndex,
     ThrowArrayIndexOutOfBoundsException();
   }
   mutabilityCheck(destination);
-  if (fromIndex >= toIndex) {
-    for (int index = 0; index < count; index++) {
-      UpdateHeapRef(ArrayAddressOfElementAt(destinationArray, toIndex + index),
-                      *ArrayAddressOfElementAt(array, fromIndex + index));
-    }
-  } else {
-    for (int index = count - 1; index >= 0; index--) {
-      UpdateHeapRef(ArrayAddressOfElementAt(destinationArray, toIndex + index),
-                      *ArrayAddressOfElementAt(array, fromIndex + index));
-    }
-  }
+  CopyHeapRefs(ArrayAddressOfElementAt(destinationArray, toIndex), ArrayAddressOfElementAt(array, fromIndex), count);
 }
 
 // Arrays.kt
@@ -310,6 +354,30 @@ KDouble Kotlin_ByteArray_getDoubleAt(KConstRef thiz, KInt index) {
 #endif  // KONAN_NO_UNALIGNED_ACCESS
 }
 
+void Kotlin_ByteArray_getShortsAt(KConstRef thiz, KInt index, KRef destination, KInt destinationOffset, KInt count) {
+  getValuesAt<KShort>(thiz, index, destination, destinationOffset, count);
+}
+
+void Kotlin_ByteArray_getCharsAt(KConstRef thiz, KInt index, KRef destination, KInt destinationOffset, KInt count) {
+  getValuesAt<KChar>(thiz, index, destination, destinationOffset, count);
+}
+
+void Kotlin_ByteArray_getIntsAt(KConstRef thiz, KInt index, KRef destination, KInt destinationOffset, KInt count) {
+  getValuesAt<KInt>(thiz, index, destination, destinationOffset, count);
+}
+
+void Kotlin_ByteArray_getLongsAt(KConstRef thiz, KInt index, KRef destination, KInt destinationOffset, KInt count) {
+  getValuesAt<KLong>(thiz, index, destination, destinationOffset, count);
+}
+
+void Kotlin_ByteArray_getFloatsAt(KConstRef thiz, KInt index, KRef destination, KInt destinationOffset, KInt count) {
+  getValuesAt<KFloat>(thiz, index, destination, destinationOffset, count);
+}
+
+void Kotlin_ByteArray_getDoublesAt(KConstRef thiz, KInt index, KRef destination, KInt destinationOffset, KInt count) {
+  getValuesAt<KDouble>(thiz, index, destination, destinationOffset, count);
+}
+
 void Kotlin_ByteArray_setCharAt(KRef thiz, KInt index, KChar value) {
   ArrayHeader* array = thiz->array();
   if (index < 0 || static_cast<uint32_t>(index) + 1 >= array->count_) {
@@ -451,12 +519,13 @@ OBJ_GETTER(Kotlin_CharArray_copyOf, KConstRef thiz, KInt newSize) {
   if (newSize < 0) {
     ThrowIllegalArgumentException();
   }
-  ArrayHeader* result = AllocArrayInstance(array->type_info(), newSize, OBJ_RESULT)->array();
+  ArrayHeader* result = AllocUninitializedArrayInstance(array->type_info(), newSize, OBJ_RESULT)->array();
   KInt toCopy = array->count_ < static_cast<uint32_t>(newSize) ?  array->count_ : newSize;
   memcpy(
       PrimitiveArrayAddressOfElementAt<KChar>(result, 0),
       PrimitiveArrayAddressOfElementAt<KChar>(array, 0),
       toCopy * sizeof(KChar));
+  memset(PrimitiveArrayAddressOfElementAt<KChar>(result, toCopy), 0, (newSize - toCopy) * sizeof(KChar));
   RETURN_OBJ(result->obj());
 }
 
@@ -563,6 +632,134 @@ void Kotlin_BooleanArray_copyImpl(KConstRef thiz, KInt fromIndex,
   copyImpl<KBoolean>(thiz, fromIndex, destination, toIndex, count);
 }
 
+KBoolean Kotlin_ByteArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KByte>(thiz, other);
+}
+
+KBoolean Kotlin_ShortArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KShort>(thiz, other);
+}
+
+KBoolean Kotlin_CharArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KChar>(thiz, other);
+}
+
+KBoolean Kotlin_IntArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KInt>(thiz, other);
+}
+
+KBoolean Kotlin_LongArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KLong>(thiz, other);
+}
+
+KBoolean Kotlin_FloatArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KFloat>(thiz, other);
+}
+
+KBoolean Kotlin_DoubleArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KDouble>(thiz, other);
+}
+
+KBoolean Kotlin_BooleanArray_contentEquals(KConstRef thiz, KConstRef other) {
+  return contentEqualsImpl<KBoolean>(thiz, other);
+}
+
+KInt Kotlin_ByteArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KByte>(thiz);
+}
+
+KInt Kotlin_ShortArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KShort>(thiz);
+}
+
+KInt Kotlin_CharArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KChar>(thiz);
+}
+
+KInt Kotlin_IntArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KInt>(thiz);
+}
+
+KInt Kotlin_LongArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KLong>(thiz);
+}
+
+KInt Kotlin_FloatArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KFloat>(thiz);
+}
+
+KInt Kotlin_DoubleArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KDouble>(thiz);
+}
+
+KInt Kotlin_BooleanArray_contentHashCode(KConstRef thiz) {
+  return contentHashCodeImpl<KBoolean>(thiz);
+}
+
+KInt Kotlin_ByteArray_indexOf(KConstRef thiz, KByte element) {
+  return indexOfImpl<KByte>(thiz, element);
+}
+
+KInt Kotlin_ShortArray_indexOf(KConstRef thiz, KShort element) {
+  return indexOfImpl<KShort>(thiz, element);
+}
+
+KInt Kotlin_CharArray_indexOf(KConstRef thiz, KChar element) {
+  return indexOfImpl<KChar>(thiz, element);
+}
+
+KInt Kotlin_IntArray_indexOf(KConstRef thiz, KInt element) {
+  return indexOfImpl<KInt>(thiz, element);
+}
+
+KInt Kotlin_LongArray_indexOf(KConstRef thiz, KLong element) {
+  return indexOfImpl<KLong>(thiz, element);
+}
+
+KInt Kotlin_FloatArray_indexOf(KConstRef thiz, KFloat element) {
+  return indexOfImpl<KFloat>(thiz, element);
+}
+
+KInt Kotlin_DoubleArray_indexOf(KConstRef thiz, KDouble element) {
+  return indexOfImpl<KDouble>(thiz, element);
+}
+
+KInt Kotlin_BooleanArray_indexOf(KConstRef thiz, KBoolean element) {
+  return indexOfImpl<KBoolean>(thiz, element);
+}
+
+KInt Kotlin_ByteArray_lastIndexOf(KConstRef thiz, KByte element) {
+  return lastIndexOfImpl<KByte>(thiz, element);
+}
+
+KInt Kotlin_ShortArray_lastIndexOf(KConstRef thiz, KShort element) {
+  return lastIndexOfImpl<KShort>(thiz, element);
+}
+
+KInt Kotlin_CharArray_lastIndexOf(KConstRef thiz, KChar element) {
+  return lastIndexOfImpl<KChar>(thiz, element);
+}
+
+KInt Kotlin_IntArray_lastIndexOf(KConstRef thiz, KInt element) {
+  return lastIndexOfImpl<KInt>(thiz, element);
+}
+
+KInt Kotlin_LongArray_lastIndexOf(KConstRef thiz, KLong element) {
+  return lastIndexOfImpl<KLong>(thiz, element);
+}
+
+KInt Kotlin_FloatArray_lastIndexOf(KConstRef thiz, KFloat element) {
+  return lastIndexOfImpl<KFloat>(thiz, element);
+}
+
+KInt Kotlin_DoubleArray_lastIndexOf(KConstRef thiz, KDouble element) {
+  return lastIndexOfImpl<KDouble>(thiz, element);
+}
+
+KInt Kotlin_BooleanArray_lastIndexOf(KConstRef thiz, KBoolean element) {
+  return lastIndexOfImpl<KBoolean>(thiz, element);
+}
+
 KLong Kotlin_LongArray_get(KConstRef thiz, KInt index) {
   return PrimitiveArrayGet<KLong>(thiz, index);
 }
@@ -634,7 +831,7 @@ OBJ_GETTER(Kotlin_ImmutableBlob_toByteArray, KConstRef thiz, KInt startIndex, KI
     ThrowArrayIndexOutOfBoundsException();
   }
   KInt count = endIndex - startIndex;
-  ArrayHeader* result = AllocArrayInstance(theByteArrayTypeInfo, count, OBJ_RESULT)->array();
+  ArrayHeader* result = AllocUninitializedArrayInstance(theByteArrayTypeInfo, count, OBJ_RESULT)->array();
   memcpy(PrimitiveArrayAddressOfElementAt<KByte>(result, 0),
          PrimitiveArrayAddressOfElementAt<KByte>(array, startIndex),
          count);
@@ -667,6 +864,10 @@ KNativePtr Kotlin_Arrays_getCharArrayAddressOfElement (KRef thiz, KInt index) {
 }
 
 KNativePtr Kotlin_Arrays_getStringAddressOfElement (KRef thiz, KInt index) {
+  // Native code expects UTF-16 chars, which compact strings do not have.
+  if (IsLatin1String(thiz->array())) {
+    ThrowIllegalStateException();
+  }
   return Kotlin_Arrays_getCharArrayAddressOfElement(thiz, index);
 }
 
@@ -5,6 +5,7 @@
 
 #include "Cleaner.h"
 
+#include "Alloc.h"
 #include "Memory.h"
 #include "Runtime.h"
 #include "Worker.h"
@@ -24,27 +25,90 @@ constexpr KInt kCleanerWorkerUninitialized = 0;
 constexpr KInt kCleanerWorkerInitializing = -1;
 constexpr KInt kCleanerWorkerShutdown = -2;
 
-KInt globalCleanerWorker = kCleanerWorkerUninitialized;
+// Cleaners disposed inside a `CleanerBatchScope` are scheduled with a single job per this many cleaners.
+constexpr KInt kCleanerBatchCapacity = 256;
 
-void disposeCleaner(CleanerImpl* thiz) {
+// The first worker of the pool. Also serves as the state of the pool initialization.
+KInt globalCleanerWorker = kCleanerWorkerUninitialized;
+// Pool size to use for the initialization.
+KInt requestedCleanerWorkerCount = 1;
+// Filled before `globalCleanerWorker` gets its value, immutable after that.
+KInt globalCleanerWorkers[kMaxCleanerWorkerCount] = {};
+KInt globalCleanerWorkerCount = 0;
+// Used to distribute jobs between workers of the pool.
+KInt globalCleanerWorkerCounter = 0;
+
+THREAD_LOCAL_VARIABLE int cleanerBatchDepth = 0;
+THREAD_LOCAL_VARIABLE KNativePtr* cleanerBatch = nullptr;
+THREAD_LOCAL_VARIABLE KInt cleanerBatchSize = 0;
+
+// Schedules a batch of cleaners on a worker, replaced in tests.
+CleanerBatchScheduler scheduleCleanerBatch = WorkerScheduleBatch;
+
+bool cleanerWorkersShutdown() {
     auto worker = atomicGet(&globalCleanerWorker);
     RuntimeAssert(
             worker != kCleanerWorkerUninitialized && worker != kCleanerWorkerInitializing,
             "Cleaner worker must've been initialized by now");
-    if (worker == kCleanerWorkerShutdown) {
-        if (Kotlin_cleanersLeakCheckerEnabled()) {
-            konan::consoleErrorf(
-                    "Cleaner %p was disposed during program exit\n"
-                    "Use `Platform.isCleanersLeakCheckerActive = false` to avoid this check.\n",
-                    thiz);
-            RuntimeCheck(false, "Terminating now");
-        }
-        return;
+    return worker == kCleanerWorkerShutdown;
+}
+
+// Called for cleaners disposed after the workers were shut down. `cleaner` is nullptr for a batch of `count` cleaners.
+void reportCleanersDisposedDuringShutdown(const CleanerImpl* cleaner, KInt count) {
+    if (!Kotlin_cleanersLeakCheckerEnabled()) return;
+    if (cleaner != nullptr) {
+        konan::consoleErrorf("Cleaner %p was disposed during program exit\n", cleaner);
+    } else {
+        konan::consoleErrorf("%d cleaners were disposed during program exit\n", count);
     }
+    konan::consoleErrorf("Use `Platform.isCleanersLeakCheckerActive = false` to avoid this check.\n");
+    RuntimeCheck(false, "Terminating now");
+}
 
+// Returns the worker to schedule cleaners on. The workers must not be shut down.
+KInt nextCleanerWorker() {
+    auto worker = atomicGet(&globalCleanerWorker);
     RuntimeAssert(worker > 0, "Cleaner worker must be fully initialized here");
 
-    bool result = WorkerSchedule(worker, thiz->cleanerStablePtr);
+    if (globalCleanerWorkerCount == 1) return worker;
+    KInt index = static_cast<KInt>(static_cast<uint32_t>(atomicAdd(&globalCleanerWorkerCounter, 1)) % globalCleanerWorkerCount);
+    return globalCleanerWorkers[index];
+}
+
+void flushCleanerBatch() {
+    KNativePtr* batch = cleanerBatch;
+    KInt size = cleanerBatchSize;
+    cleanerBatch = nullptr;
+    cleanerBatchSize = 0;
+    if (batch == nullptr) return;
+
+    if (cleanerWorkersShutdown()) {
+        konanFreeMemory(batch);
+        reportCleanersDisposedDuringShutdown(nullptr, size);
+        return;
+    }
+    // The worker takes ownership of `batch`.
+    bool result = scheduleCleanerBatch(nextCleanerWorker(), batch, size);
+    RuntimeAssert(result, "Couldn't find Cleaner worker");
+}
+
+void disposeCleaner(CleanerImpl* thiz) {
+    if (cleanerWorkersShutdown()) {
+        reportCleanersDisposedDuringShutdown(thiz, 1);
+        return;
+    }
+
+    if (cleanerBatchDepth > 0) {
+        if (cleanerBatch == nullptr) {
+            cleanerBatch = konanAllocArray<KNativePtr>(kCleanerBatchCapacity);
+            RuntimeCheck(cleanerBatch != nullptr, "Cannot allocate cleaner batch");
+        }
+        cleanerBatch[cleanerBatchSize++] = thiz->cleanerStablePtr;
+        if (cleanerBatchSize == kCleanerBatchCapacity) flushCleanerBatch();
+        return;
+    }
+
+    bool result = WorkerSchedule(nextCleanerWorker(), thiz->cleanerStablePtr);
     RuntimeAssert(result, "Couldn't find Cleaner worker");
 }
 
@@ -64,6 +128,15 @@ RUNTIME_NOTHROW void DisposeCleaner(KRef thiz) {
 #endif
 }
 
+void BeginCleanerBatch() {
+    ++cleanerBatchDepth;
+}
+
+void EndCleanerBatch() {
+    RuntimeAssert(cleanerBatchDepth > 0, "Unbalanced cleaner batch");
+    if (--cleanerBatchDepth == 0) flushCleanerBatch();
+}
+
 void ShutdownCleaners(bool executeScheduledCleaners) {
     KInt worker = 0;
     do {
@@ -90,8 +163,12 @@ void ShutdownCleaners(bool executeScheduledCleaners) {
     RuntimeAssert(worker > 0, "Cleaner worker must be fully initialized here");
 
     atomicSet(&globalCleanerWorker, kCleanerWorkerShutdown);
-    Kotlin_CleanerImpl_shutdownCleanerWorker(worker, executeScheduledCleaners);
-    WaitNativeWorkerTermination(worker);
+    for (KInt index = 0; index < globalCleanerWorkerCount; ++index) {
+        Kotlin_CleanerImpl_shutdownCleanerWorker(globalCleanerWorkers[index], executeScheduledCleaners);
+    }
+    for (KInt index = 0; index < globalCleanerWorkerCount; ++index) {
+        WaitNativeWorkerTermination(globalCleanerWorkers[index]);
+    }
 }
 
 extern "C" KInt Kotlin_CleanerImpl_getCleanerWorker() {
@@ -104,7 +181,12 @@ extern "C" KInt Kotlin_CleanerImpl_getCleanerWorker() {
                 // Someone else is trying to initialize the worker. Try again.
                 continue;
             }
-            worker = Kotlin_CleanerImpl_createCleanerWorker();
+            KInt count = atomicGet(&requestedCleanerWorkerCount);
+            for (KInt index = 0; index < count; ++index) {
+                globalCleanerWorkers[index] = Kotlin_CleanerImpl_createCleanerWorker();
+            }
+            globalCleanerWorkerCount = count;
+            worker = globalCleanerWorkers[0];
             if (!compareAndSet(&globalCleanerWorker, kCleanerWorkerInitializing, worker)) {
                 RuntimeCheck(false, "Someone interrupted worker initializing");
             }
@@ -125,6 +207,37 @@ extern "C" KInt Kotlin_CleanerImpl_getCleanerWorker() {
     return worker;
 }
 
+extern "C" KInt Kotlin_CleanerImpl_getCleanerWorkerCount() {
+    // Doesn't start the workers: the requested count is immutable once they are started.
+    return atomicGet(&requestedCleanerWorkerCount);
+}
+
+extern "C" KInt Kotlin_CleanerImpl_getCleanerWorkerAt(KInt index) {
+    Kotlin_CleanerImpl_getCleanerWorker();
+    RuntimeAssert(index >= 0 && index < globalCleanerWorkerCount, "Cleaner worker index is out of bounds");
+    return globalCleanerWorkers[index];
+}
+
+extern "C" KBoolean Kotlin_CleanerImpl_setCleanerWorkerCount(KInt count) {
+    RuntimeAssert(count > 0 && count <= kMaxCleanerWorkerCount, "Invalid cleaner worker count %d", count);
+    // Holds off the initialization and the shutdown while the count is being changed.
+    if (!compareAndSet(&globalCleanerWorker, kCleanerWorkerUninitialized, kCleanerWorkerInitializing)) return false;
+    atomicSet(&requestedCleanerWorkerCount, count);
+    if (!compareAndSet(&globalCleanerWorker, kCleanerWorkerInitializing, kCleanerWorkerUninitialized)) {
+        RuntimeCheck(false, "Someone interrupted changing the cleaner worker count");
+    }
+    return true;
+}
+
 void ResetCleanerWorkerForTests() {
     atomicSet(&globalCleanerWorker, kCleanerWorkerUninitialized);
+    atomicSet(&requestedCleanerWorkerCount, 1);
+    globalCleanerWorkerCount = 0;
+    globalCleanerWorkerCounter = 0;
+}
+
+CleanerBatchScheduler SetCleanerBatchSchedulerForTests(CleanerBatchScheduler scheduler) {
+    auto previous = scheduleCleanerBatch;
+    scheduleCleanerBatch = scheduler != nullptr ? scheduler : WorkerScheduleBatch;
+    return previous;
 }
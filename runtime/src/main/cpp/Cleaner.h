@@ -8,13 +8,38 @@
 
 #include "Common.h"
 #include "Types.h"
+#include "Utils.hpp"
+
+// Maximum size of the pool of workers executing cleaners.
+constexpr KInt kMaxCleanerWorkerCount = 16;
 
 RUNTIME_NOTHROW void DisposeCleaner(KRef thiz);
 
+// Cleaners disposed on the current thread between `BeginCleanerBatch` and `EndCleanerBatch` are scheduled
+// in batches instead of one job per cleaner. The last batch is scheduled when the outermost scope ends.
+void BeginCleanerBatch();
+void EndCleanerBatch();
+
+class CleanerBatchScope : private kotlin::Pinned {
+public:
+    CleanerBatchScope() { BeginCleanerBatch(); }
+    ~CleanerBatchScope() { EndCleanerBatch(); }
+};
+
 void ShutdownCleaners(bool executeScheduledCleaners);
 
 extern "C" KInt Kotlin_CleanerImpl_getCleanerWorker();
+// Returns the configured number of workers, doesn't start them.
+extern "C" KInt Kotlin_CleanerImpl_getCleanerWorkerCount();
+extern "C" KInt Kotlin_CleanerImpl_getCleanerWorkerAt(KInt index);
+// Returns `false` if the cleaner workers are already started.
+extern "C" KBoolean Kotlin_CleanerImpl_setCleanerWorkerCount(KInt count);
 
 void ResetCleanerWorkerForTests();
 
+// Same contract as `WorkerScheduleBatch`.
+using CleanerBatchScheduler = bool (*)(KInt worker, KNativePtr* cleaners, KInt count);
+// Replaces scheduling of cleaner batches, `nullptr` restores the default. Returns the previous scheduler.
+CleanerBatchScheduler SetCleanerBatchSchedulerForTests(CleanerBatchScheduler scheduler);
+
 #endif // RUNTIME_CLEANER_H
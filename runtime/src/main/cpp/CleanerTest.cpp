@@ -10,14 +10,39 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "Alloc.h"
 #include "Atomic.h"
+#include "Memory.h"
 #include "TestSupport.hpp"
 #include "TestSupportCompilerGenerated.hpp"
 #include "Types.h"
 
 using testing::_;
 
-// TODO: Also test disposal. (This requires extracting Worker interface)
+namespace {
+
+// Mirrors the layout of `CleanerImpl`.
+struct FakeCleaner {
+    ObjHeader header;
+    KNativePtr cleanerStablePtr;
+};
+
+struct ScheduledBatch {
+    KInt worker;
+    KStdVector<KNativePtr> cleaners;
+};
+
+KStdVector<ScheduledBatch> scheduledBatches;
+
+bool RecordCleanerBatch(KInt worker, KNativePtr* cleaners, KInt count) {
+    scheduledBatches.push_back(ScheduledBatch{worker, KStdVector<KNativePtr>(cleaners, cleaners + count)});
+    konanFreeMemory(cleaners);
+    return true;
+}
+
+} // namespace
+
+// TODO: Also test disposal outside of batches. (This requires extracting Worker interface)
 
 TEST(CleanerTest, ConcurrentCreation) {
     ResetCleanerWorkerForTests();
@@ -79,3 +104,108 @@ TEST(CleanerTest, ShutdownWithCreation) {
     EXPECT_CALL(*shutdownCleanerWorkerMock, Call(workerId, executeScheduledCleaners));
     ShutdownCleaners(executeScheduledCleaners);
 }
+
+TEST(CleanerTest, PoolCreation) {
+    ResetCleanerWorkerForTests();
+
+    auto createCleanerWorkerMock = ScopedCreateCleanerWorkerMock();
+
+    EXPECT_CALL(*createCleanerWorkerMock, Call())
+            .WillOnce(testing::Return(42))
+            .WillOnce(testing::Return(43))
+            .WillOnce(testing::Return(44));
+    EXPECT_TRUE(Kotlin_CleanerImpl_setCleanerWorkerCount(3));
+
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorker(), 42);
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkerCount(), 3);
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkerAt(0), 42);
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkerAt(1), 43);
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkerAt(2), 44);
+
+    // Too late to change the pool size.
+    EXPECT_FALSE(Kotlin_CleanerImpl_setCleanerWorkerCount(2));
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkerCount(), 3);
+}
+
+TEST(CleanerTest, PoolShutdown) {
+    ResetCleanerWorkerForTests();
+
+    constexpr bool executeScheduledCleaners = false;
+
+    auto createCleanerWorkerMock = ScopedCreateCleanerWorkerMock();
+    auto shutdownCleanerWorkerMock = ScopedShutdownCleanerWorkerMock();
+
+    EXPECT_CALL(*createCleanerWorkerMock, Call()).WillOnce(testing::Return(42)).WillOnce(testing::Return(43));
+    EXPECT_TRUE(Kotlin_CleanerImpl_setCleanerWorkerCount(2));
+    Kotlin_CleanerImpl_getCleanerWorker();
+
+    EXPECT_CALL(*shutdownCleanerWorkerMock, Call(42, executeScheduledCleaners));
+    EXPECT_CALL(*shutdownCleanerWorkerMock, Call(43, executeScheduledCleaners));
+    ShutdownCleaners(executeScheduledCleaners);
+}
+
+TEST(CleanerTest, PoolCountWithoutCreation) {
+    ResetCleanerWorkerForTests();
+
+    auto createCleanerWorkerMock = ScopedCreateCleanerWorkerMock();
+
+    EXPECT_CALL(*createCleanerWorkerMock, Call()).Times(0);
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkerCount(), 1);
+    EXPECT_TRUE(Kotlin_CleanerImpl_setCleanerWorkerCount(3));
+    EXPECT_THAT(Kotlin_CleanerImpl_getCleanerWorkerCount(), 3);
+}
+
+TEST(CleanerTest, BatchDistribution) {
+    ResetCleanerWorkerForTests();
+    scheduledBatches.clear();
+    auto previousScheduler = SetCleanerBatchSchedulerForTests(RecordCleanerBatch);
+
+    constexpr int cleanerCount = 600;
+
+    auto createCleanerWorkerMock = ScopedCreateCleanerWorkerMock();
+
+    EXPECT_CALL(*createCleanerWorkerMock, Call()).WillOnce(testing::Return(42)).WillOnce(testing::Return(43));
+    EXPECT_TRUE(Kotlin_CleanerImpl_setCleanerWorkerCount(2));
+    Kotlin_CleanerImpl_getCleanerWorker();
+
+    KStdVector<FakeCleaner> cleaners(cleanerCount);
+    for (int i = 0; i < cleanerCount; ++i) {
+        cleaners[i].cleanerStablePtr = reinterpret_cast<KNativePtr>(static_cast<uintptr_t>(i + 1));
+    }
+    {
+        CleanerBatchScope outer;
+        {
+            // Nested scopes don't flush.
+            CleanerBatchScope inner;
+            for (int i = 0; i < cleanerCount / 2; ++i) {
+                DisposeCleaner(&cleaners[i].header);
+            }
+        }
+        for (int i = cleanerCount / 2; i < cleanerCount; ++i) {
+            DisposeCleaner(&cleaners[i].header);
+        }
+        // Only full batches are scheduled until the outermost scope ends.
+        EXPECT_THAT(scheduledBatches.size(), 2);
+    }
+
+    ASSERT_THAT(scheduledBatches.size(), 3);
+    // Round-robin between the workers.
+    EXPECT_THAT(scheduledBatches[0].worker, testing::AnyOf(42, 43));
+    EXPECT_THAT(scheduledBatches[1].worker, testing::Ne(scheduledBatches[0].worker));
+    EXPECT_THAT(scheduledBatches[2].worker, scheduledBatches[0].worker);
+    EXPECT_THAT(scheduledBatches[0].cleaners.size(), 256);
+    EXPECT_THAT(scheduledBatches[1].cleaners.size(), 256);
+    EXPECT_THAT(scheduledBatches[2].cleaners.size(), cleanerCount - 512);
+    KStdVector<KNativePtr> scheduled;
+    for (auto& batch : scheduledBatches) {
+        scheduled.insert(scheduled.end(), batch.cleaners.begin(), batch.cleaners.end());
+    }
+    KStdVector<KNativePtr> expected;
+    for (auto& cleaner : cleaners) {
+        expected.push_back(cleaner.cleanerStablePtr);
+    }
+    EXPECT_THAT(scheduled, testing::ElementsAreArray(expected));
+
+    SetCleanerBatchSchedulerForTests(previousScheduler);
+    scheduledBatches.clear();
+}
@@ -31,11 +31,16 @@ void Kotlin_io_Console_print(KString message) {
     ThrowClassCastException(message->obj(), theStringTypeInfo);
   }
   // TODO: system stdout must be aware about UTF-8.
-  const KChar* utf16 = CharArrayAddressOfElementAt(message, 0);
+  uint32_t length = StringLength(message);
   KStdString utf8;
-  utf8.reserve(message->count_);
-  // Replace incorrect sequences with a default codepoint (see utf8::with_replacement::default_replacement)
-  utf8::with_replacement::utf16to8(utf16, utf16 + message->count_, back_inserter(utf8));
+  utf8.reserve(length);
+  if (IsLatin1String(message)) {
+    Latin1ToUtf8(Latin1StringAddressOfElementAt(message, 0), length, &utf8);
+  } else {
+    const KChar* utf16 = CharArrayAddressOfElementAt(message, 0);
+    // Replace incorrect sequences with a default codepoint (see utf8::with_replacement::default_replacement)
+    utf8::with_replacement::utf16to8(utf16, utf16 + length, back_inserter(utf8));
+  }
   konan::consoleWriteUtf8(utf8.c_str(), utf8.size());
 }
 
@@ -0,0 +1,24 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_DECIMAL_PARSER_H
+#define RUNTIME_DECIMAL_PARSER_H
+
+#include "Types.h"
+
+namespace kotlin {
+
+// Fast paths of `String.toDouble()` and `String.toFloat()` for plain decimal numbers, like "-3.14" or "6.02e23",
+// surrounded by optional whitespace. Parse UTF-16 directly and round correctly.
+//
+// Return false if the string is not such a number, or is too hard to parse without big integers (more than 19
+// significant digits or a rare ambiguous rounding case). The caller must use the full parser then, which is
+// also responsible for reporting errors.
+bool TryParseDouble(const KChar* begin, const KChar* end, double* result) noexcept;
+bool TryParseFloat(const KChar* begin, const KChar* end, float* result) noexcept;
+
+} // namespace kotlin
+
+#endif // RUNTIME_DECIMAL_PARSER_H
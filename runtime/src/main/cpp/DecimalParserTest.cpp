@@ -0,0 +1,188 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "DecimalParser.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+std::basic_string<KChar> ToKChars(const std::string& string) {
+    return std::basic_string<KChar>(string.begin(), string.end());
+}
+
+bool ParseDouble(const std::string& string, double* result) {
+    auto chars = ToKChars(string);
+    return TryParseDouble(chars.data(), chars.data() + chars.size(), result);
+}
+
+bool ParseFloat(const std::string& string, float* result) {
+    auto chars = ToKChars(string);
+    return TryParseFloat(chars.data(), chars.data() + chars.size(), result);
+}
+
+uint64_t DoubleToBits(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+uint32_t FloatToBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Parses with both `TryParseDouble` and `strtod` and checks that the results are bitwise equal.
+void ExpectSameAsStrtod(const std::string& string) {
+    double actual;
+    ASSERT_TRUE(ParseDouble(string, &actual)) << string;
+    EXPECT_THAT(DoubleToBits(actual), DoubleToBits(strtod(string.c_str(), nullptr))) << string;
+    float actualFloat;
+    ASSERT_TRUE(ParseFloat(string, &actualFloat)) << string;
+    EXPECT_THAT(FloatToBits(actualFloat), FloatToBits(strtof(string.c_str(), nullptr))) << string;
+}
+
+} // namespace
+
+TEST(DecimalParserTest, Simple) {
+    double result;
+    ASSERT_TRUE(ParseDouble("0", &result));
+    EXPECT_THAT(DoubleToBits(result), DoubleToBits(0.0));
+    ASSERT_TRUE(ParseDouble("-0.0", &result));
+    EXPECT_THAT(DoubleToBits(result), DoubleToBits(-0.0));
+    ASSERT_TRUE(ParseDouble("1.5", &result));
+    EXPECT_THAT(result, 1.5);
+    ASSERT_TRUE(ParseDouble("+.25", &result));
+    EXPECT_THAT(result, 0.25);
+    ASSERT_TRUE(ParseDouble("7.", &result));
+    EXPECT_THAT(result, 7.0);
+    ASSERT_TRUE(ParseDouble("-6.02e23", &result));
+    EXPECT_THAT(result, -6.02e23);
+    ASSERT_TRUE(ParseDouble("1E-5", &result));
+    EXPECT_THAT(result, 1e-5);
+    ASSERT_TRUE(ParseDouble("1e+5", &result));
+    EXPECT_THAT(result, 1e5);
+    ASSERT_TRUE(ParseDouble("0.000000000000000000000000000001", &result));
+    EXPECT_THAT(result, 1e-30);
+}
+
+TEST(DecimalParserTest, WhitespaceAndSuffix) {
+    double result;
+    ASSERT_TRUE(ParseDouble(" \t\n 42 \r\n", &result));
+    EXPECT_THAT(result, 42.0);
+    ASSERT_TRUE(ParseDouble("1.5f", &result));
+    EXPECT_THAT(result, 1.5);
+    ASSERT_TRUE(ParseDouble("1.5D", &result));
+    EXPECT_THAT(result, 1.5);
+    ASSERT_TRUE(ParseDouble("  2e3d  ", &result));
+    EXPECT_THAT(result, 2e3);
+}
+
+TEST(DecimalParserTest, OutOfRange) {
+    double result;
+    ASSERT_TRUE(ParseDouble("1e400", &result));
+    EXPECT_THAT(result, std::numeric_limits<double>::infinity());
+    ASSERT_TRUE(ParseDouble("-1e99999999999", &result));
+    EXPECT_THAT(result, -std::numeric_limits<double>::infinity());
+    ASSERT_TRUE(ParseDouble("1e-400", &result));
+    EXPECT_THAT(DoubleToBits(result), DoubleToBits(0.0));
+    ASSERT_TRUE(ParseDouble("4.9e-324", &result));
+    EXPECT_THAT(result, std::numeric_limits<double>::denorm_min());
+    ASSERT_TRUE(ParseDouble("1.7976931348623157e308", &result));
+    EXPECT_THAT(result, std::numeric_limits<double>::max());
+    ASSERT_TRUE(ParseDouble("1.7976931348623159e308", &result));
+    EXPECT_THAT(result, std::numeric_limits<double>::infinity());
+
+    float floatResult;
+    ASSERT_TRUE(ParseFloat("3.4028235e38", &floatResult));
+    EXPECT_THAT(floatResult, std::numeric_limits<float>::max());
+    ASSERT_TRUE(ParseFloat("1e39", &floatResult));
+    EXPECT_THAT(floatResult, std::numeric_limits<float>::infinity());
+    ASSERT_TRUE(ParseFloat("1.4e-45", &floatResult));
+    EXPECT_THAT(floatResult, std::numeric_limits<float>::denorm_min());
+    ASSERT_TRUE(ParseFloat("1e-46", &floatResult));
+    EXPECT_THAT(floatResult, 0.0f);
+}
+
+TEST(DecimalParserTest, Rounding) {
+    // Halfway between 2^53 and 2^53 + 2, rounds to even.
+    ExpectSameAsStrtod("9007199254740993");
+    ExpectSameAsStrtod("9007199254740995");
+    // Halfway between two floats.
+    ExpectSameAsStrtod("16777217");
+    ExpectSameAsStrtod("33554435");
+    // Just below and above the halfway point of the smallest subnormal.
+    ExpectSameAsStrtod("2.4703282292062327e-324");
+    ExpectSameAsStrtod("2.4703282292062328e-324");
+    ExpectSameAsStrtod("2.2250738585072011e-308");
+    ExpectSameAsStrtod("2.2250738585072012e-308");
+    ExpectSameAsStrtod("1.000000059604644775");
+    ExpectSameAsStrtod("0.1");
+    ExpectSameAsStrtod("0.3");
+    ExpectSameAsStrtod("123456789012345678e-5");
+}
+
+TEST(DecimalParserTest, Unsupported) {
+    double result;
+    for (auto string : {"", "   ", ".", "-", "+", "e5", ".e5", "1e", "1e+", "1e-", "--1", "+-1", "1.2.3", "1e5.5", "0x10", "1_000",
+                        "NaN", "Infinity", "1 2", "1f5", "12345678901234567890", "1.0000000000000000000"}) {
+        EXPECT_FALSE(ParseDouble(string, &result)) << string;
+    }
+    float floatResult;
+    EXPECT_FALSE(ParseFloat("12345678901234567890", &floatResult));
+}
+
+TEST(DecimalParserTest, NonAscii) {
+    std::basic_string<KChar> string = {'1', 0x0661, '2'};
+    double result;
+    EXPECT_FALSE(TryParseDouble(string.data(), string.data() + string.size(), &result));
+}
+
+TEST(DecimalParserTest, Random) {
+    std::mt19937_64 random(42);
+    char buffer[64];
+    for (int i = 0; i < 200000; ++i) {
+        std::string string;
+        switch (i % 3) {
+            case 0: {
+                uint64_t bits = random();
+                double value;
+                memcpy(&value, &bits, sizeof(value));
+                if (!std::isfinite(value)) continue;
+                snprintf(buffer, sizeof(buffer), "%.*g", static_cast<int>(random() % 17 + 1), value);
+                string = buffer;
+                break;
+            }
+            case 1: {
+                int digits = random() % 19 + 1;
+                for (int digit = 0; digit < digits; ++digit) {
+                    string += static_cast<char>('0' + random() % 10);
+                }
+                string.insert(random() % (digits + 1), ".");
+                string += "e" + std::to_string(static_cast<int>(random() % 700) - 350);
+                break;
+            }
+            default:
+                snprintf(buffer, sizeof(buffer), "%d.%02d", static_cast<int>(random() % 100000), static_cast<int>(random() % 100));
+                string = buffer;
+                break;
+        }
+        ExpectSameAsStrtod(string);
+    }
+}
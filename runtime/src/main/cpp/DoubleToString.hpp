@@ -0,0 +1,30 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_DOUBLE_TO_STRING_H
+#define RUNTIME_DOUBLE_TO_STRING_H
+
+#include <cstddef>
+
+#include "Types.h"
+
+namespace kotlin {
+
+// Enough for any result of `DoubleToString` and `FloatToString`, e.g. "-2.2250738585072014E-308".
+constexpr size_t kDoubleToStringMaxLength = 32;
+
+// Writes `value` to `buffer` in the format of `Double.toString` and returns the number of written characters.
+//
+// The digits are the shortest decimal that rounds back to `value` (the closest one if there are several),
+// but no shorter than 2 digits. Implements the Schubfach algorithm by Raffaello Giulietti, which needs
+// neither big integers nor a fallback.
+size_t DoubleToString(double value, KChar* buffer) noexcept;
+
+// Same as `DoubleToString`, but for the format of `Float.toString`.
+size_t FloatToString(float value, KChar* buffer) noexcept;
+
+} // namespace kotlin
+
+#endif // RUNTIME_DOUBLE_TO_STRING_H
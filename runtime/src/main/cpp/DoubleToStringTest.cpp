@@ -0,0 +1,178 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "DoubleToString.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+std::string ToString(double value) {
+    KChar buffer[kDoubleToStringMaxLength];
+    size_t length = DoubleToString(value, buffer);
+    return std::string(buffer, buffer + length);
+}
+
+std::string ToString(float value) {
+    KChar buffer[kDoubleToStringMaxLength];
+    size_t length = FloatToString(value, buffer);
+    return std::string(buffer, buffer + length);
+}
+
+double DoubleFromBits(uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+float FloatFromBits(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Checks that every float with bits in [begin, end) is printed so that it's parsed back to itself,
+// and returns the number of failures.
+uint64_t CheckFloatRoundTrip(uint64_t begin, uint64_t end, uint64_t stride) {
+    uint64_t failures = 0;
+    KChar buffer[kDoubleToStringMaxLength];
+    char string[kDoubleToStringMaxLength + 1];
+    for (uint64_t bits = begin; bits < end; bits += stride) {
+        float value = FloatFromBits(static_cast<uint32_t>(bits));
+        if (std::isnan(value)) continue;
+        size_t length = FloatToString(value, buffer);
+        for (size_t i = 0; i < length; ++i) {
+            string[i] = static_cast<char>(buffer[i]);
+        }
+        string[length] = '\0';
+        float parsed = strtof(string, nullptr);
+        if (memcmp(&parsed, &value, sizeof(value)) != 0 && failures++ == 0) {
+            ADD_FAILURE() << "Float with bits " << std::hex << bits << " is printed as " << string;
+        }
+    }
+    return failures;
+}
+
+} // namespace
+
+TEST(DoubleToStringTest, SpecialValues) {
+    EXPECT_THAT(ToString(0.0), "0.0");
+    EXPECT_THAT(ToString(-0.0), "-0.0");
+    EXPECT_THAT(ToString(std::numeric_limits<double>::quiet_NaN()), "NaN");
+    EXPECT_THAT(ToString(std::numeric_limits<double>::infinity()), "Infinity");
+    EXPECT_THAT(ToString(-std::numeric_limits<double>::infinity()), "-Infinity");
+    EXPECT_THAT(ToString(std::numeric_limits<double>::max()), "1.7976931348623157E308");
+    EXPECT_THAT(ToString(std::numeric_limits<double>::min()), "2.2250738585072014E-308");
+    EXPECT_THAT(ToString(std::numeric_limits<double>::denorm_min()), "4.9E-324");
+    EXPECT_THAT(ToString(2 * std::numeric_limits<double>::denorm_min()), "9.9E-324");
+}
+
+TEST(DoubleToStringTest, Format) {
+    EXPECT_THAT(ToString(1.0), "1.0");
+    EXPECT_THAT(ToString(-1.5), "-1.5");
+    EXPECT_THAT(ToString(100.0), "100.0");
+    EXPECT_THAT(ToString(123456.789), "123456.789");
+    EXPECT_THAT(ToString(9999999.0), "9999999.0");
+    EXPECT_THAT(ToString(1e7), "1.0E7");
+    EXPECT_THAT(ToString(12345678.9), "1.23456789E7");
+    EXPECT_THAT(ToString(0.001), "0.001");
+    EXPECT_THAT(ToString(0.0123), "0.0123");
+    EXPECT_THAT(ToString(1e-4), "1.0E-4");
+    EXPECT_THAT(ToString(-1.25e-5), "-1.25E-5");
+    EXPECT_THAT(ToString(1e23), "1.0E23");
+    EXPECT_THAT(ToString(1e100), "1.0E100");
+}
+
+TEST(DoubleToStringTest, Shortest) {
+    EXPECT_THAT(ToString(0.1), "0.1");
+    EXPECT_THAT(ToString(0.1 + 0.2), "0.30000000000000004");
+    EXPECT_THAT(ToString(1.0 / 3), "0.3333333333333333");
+    EXPECT_THAT(ToString(2.0 / 3), "0.6666666666666666");
+    EXPECT_THAT(ToString(5e-324 * 3), "1.5E-323");
+    EXPECT_THAT(ToString(9007199254740993.0), "9.007199254740992E15");
+    EXPECT_THAT(ToString(4.35), "4.35");
+}
+
+TEST(DoubleToStringTest, RandomRoundTrip) {
+    std::mt19937_64 random(42);
+    KChar buffer[kDoubleToStringMaxLength];
+    char string[kDoubleToStringMaxLength + 1];
+    for (int i = 0; i < 1000000; ++i) {
+        double value = DoubleFromBits(random());
+        if (std::isnan(value)) continue;
+        size_t length = DoubleToString(value, buffer);
+        for (size_t j = 0; j < length; ++j) {
+            string[j] = static_cast<char>(buffer[j]);
+        }
+        string[length] = '\0';
+        double parsed = strtod(string, nullptr);
+        ASSERT_THAT(memcmp(&parsed, &value, sizeof(value)), 0) << string;
+    }
+}
+
+TEST(FloatToStringTest, SpecialValues) {
+    EXPECT_THAT(ToString(0.0f), "0.0");
+    EXPECT_THAT(ToString(-0.0f), "-0.0");
+    EXPECT_THAT(ToString(std::numeric_limits<float>::quiet_NaN()), "NaN");
+    EXPECT_THAT(ToString(std::numeric_limits<float>::infinity()), "Infinity");
+    EXPECT_THAT(ToString(-std::numeric_limits<float>::infinity()), "-Infinity");
+    EXPECT_THAT(ToString(std::numeric_limits<float>::max()), "3.4028235E38");
+    EXPECT_THAT(ToString(std::numeric_limits<float>::min()), "1.1754944E-38");
+    EXPECT_THAT(ToString(std::numeric_limits<float>::denorm_min()), "1.4E-45");
+}
+
+TEST(FloatToStringTest, Format) {
+    EXPECT_THAT(ToString(1.0f), "1.0");
+    EXPECT_THAT(ToString(0.1f), "0.1");
+    EXPECT_THAT(ToString(1.0f / 3), "0.33333334");
+    EXPECT_THAT(ToString(16777216.0f), "1.6777216E7");
+    EXPECT_THAT(ToString(1e10f), "1.0E10");
+    EXPECT_THAT(ToString(-0.001f), "-0.001");
+}
+
+TEST(FloatToStringTest, SampledRoundTrip) {
+    // Negative floats differ only in the sign, so checking the positive ones is enough.
+    constexpr uint64_t kEnd = uint64_t(1) << 31;
+    // A prime stride hits every exponent with varying mantissas.
+    uint64_t failures = CheckFloatRoundTrip(0, kEnd, 1021);
+    // Values around each power of two, where the spacing of floats changes.
+    for (uint64_t exponent = 0; exponent < 255; ++exponent) {
+        uint64_t powerOfTwo = exponent << 23;
+        failures += CheckFloatRoundTrip(powerOfTwo > 16 ? powerOfTwo - 16 : 0, powerOfTwo + 16, 1);
+    }
+    EXPECT_THAT(failures, 0);
+}
+
+// Takes minutes, run with `--gtest_also_run_disabled_tests` after changing the float formatting.
+TEST(FloatToStringTest, DISABLED_ExhaustiveRoundTrip) {
+    // Negative floats differ only in the sign, so checking the positive ones is enough.
+    constexpr uint64_t kEnd = uint64_t(1) << 31;
+    unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+    KStdVector<std::future<uint64_t>> futures;
+    for (unsigned i = 0; i < threadCount; ++i) {
+        uint64_t begin = kEnd / threadCount * i;
+        uint64_t end = i + 1 == threadCount ? kEnd : kEnd / threadCount * (i + 1);
+        futures.push_back(std::async(std::launch::async, CheckFloatRoundTrip, begin, end, 1));
+    }
+    uint64_t failures = 0;
+    for (auto& future : futures) {
+        failures += future.get();
+    }
+    EXPECT_THAT(failures, 0);
+}
@@ -18,7 +18,9 @@
 #include <string.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <exception>
+#include <limits>
 #include <unistd.h>
 
 #if KONAN_NO_EXCEPTIONS
@@ -34,6 +36,8 @@
 #endif
 #endif // OMIT_BACKTRACE
 
+#include "Alloc.h"
+#include "Atomic.h"
 #include "KAssert.h"
 #include "Exceptions.h"
 #include "ExecFormat.h"
@@ -41,6 +45,7 @@
 #include "Mutex.hpp"
 #include "Natives.h"
 #include "KString.h"
+#include "Porting.h"
 #include "SourceInfo.h"
 #include "Types.h"
 #include "Utils.hpp"
@@ -56,36 +61,62 @@ KRef currentUnhandledExceptionHook = nullptr;
 int32_t currentUnhandledExceptionHookLock = 0;
 int32_t currentUnhandledExceptionHookCookie = 0;
 
-#if USE_GCC_UNWIND
-struct Backtrace {
-  Backtrace(int count, int skip) : index(0), skipCount(skip) {
-    uint32_t size = count - skipCount;
-    if (size < 0) {
-      size = 0;
-    }
-    auto result = AllocArrayInstance(theNativePtrArrayTypeInfo, size, arrayHolder.slot());
-    // TODO: throw cached OOME?
-    RuntimeCheck(result != nullptr, "Cannot create backtrace array");
-  }
+// Limits the number of frames captured on `Throwable` creation, unlimited by default. Zero disables capturing altogether.
+KInt stackTraceDepthLimit = std::numeric_limits<KInt>::max();
 
-  void setNextElement(_Unwind_Ptr element) {
-    Kotlin_NativePtrArray_set(obj(), index++, (KNativePtr) element);
-  }
+#if !OMIT_BACKTRACE
+// Skips first 2 elements as irrelevant: `Kotlin_Throwable_captureStackTrace` and primary Throwable constructor.
+constexpr int kSkipFrames = 2;
+// Number of frames captured at first, doubled while the stack is deeper and the depth limit allows.
+constexpr int kInitialCaptureDepth = 128;
 
-  ObjHeader* obj() { return arrayHolder.obj(); }
+// Raw frames of a `Throwable`, owned by its meta object. The `NativePtrArray` is only created when requested.
+struct CapturedStackTrace {
+  size_t size;
 
-  int index;
-  int skipCount;
-  ObjHolder arrayHolder;
+  KNativePtr* frames() { return reinterpret_cast<KNativePtr*>(this + 1); }
 };
 
-_Unwind_Reason_Code depthCountCallback(
-    struct _Unwind_Context * context, void* arg) {
-  int* result = reinterpret_cast<int*>(arg);
-  (*result)++;
-  return _URC_NO_REASON;
+// Per-thread scratch space for capturing a stack trace, so that only the result array is allocated
+// on the Kotlin heap, and only once.
+struct StackTraceBuffer {
+  KNativePtr* frames = nullptr;
+  int capacity = 0;
+};
+
+THREAD_LOCAL_VARIABLE StackTraceBuffer* stackTraceBuffer = nullptr;
+
+void destroyStackTraceBuffer(void* argument) {
+  auto* buffer = reinterpret_cast<StackTraceBuffer*>(argument);
+  if (buffer->frames != nullptr) konanFreeMemory(buffer->frames);
+  konanDestructInstance(buffer);
 }
 
+// Returns the buffer of at least `capacity` frames, or nullptr if it cannot be allocated.
+KNativePtr* getStackTraceBuffer(int capacity) {
+  auto* buffer = stackTraceBuffer;
+  if (buffer == nullptr) {
+    buffer = konanConstructInstance<StackTraceBuffer>();
+    if (buffer == nullptr) return nullptr;
+    stackTraceBuffer = buffer;
+    konan::onThreadExit(destroyStackTraceBuffer, buffer);
+  }
+  if (buffer->capacity < capacity) {
+    if (buffer->frames != nullptr) konanFreeMemory(buffer->frames);
+    buffer->frames = konanAllocArray<KNativePtr>(capacity);
+    buffer->capacity = buffer->frames != nullptr ? capacity : 0;
+  }
+  return buffer->frames;
+}
+
+#if USE_GCC_UNWIND
+struct Backtrace {
+  KNativePtr* frames;
+  int size;
+  int capacity;
+  int skipCount;
+};
+
 _Unwind_Reason_Code unwindCallback(
     struct _Unwind_Context* context, void* arg) {
   Backtrace* backtrace = reinterpret_cast<Backtrace*>(arg);
@@ -93,17 +124,21 @@ _Unwind_Reason_Code unwindCallback(
     backtrace->skipCount--;
     return _URC_NO_REASON;
   }
+  if (backtrace->size == backtrace->capacity) {
+    return _URC_NORMAL_STOP;
+  }
 
 #if (__MINGW32__ || __MINGW64__)
   _Unwind_Ptr address = _Unwind_GetRegionStart(context);
 #else
   _Unwind_Ptr address = _Unwind_GetIP(context);
 #endif
-  backtrace->setNextElement(address);
+  backtrace->frames[backtrace->size++] = reinterpret_cast<KNativePtr>(address);
 
   return _URC_NO_REASON;
 }
-#endif
+#endif  // USE_GCC_UNWIND
+#endif  // !OMIT_BACKTRACE
 
 THREAD_LOCAL_VARIABLE bool disallowSourceInfo = false;
 
@@ -117,40 +152,89 @@ SourceInfo getSourceInfo(KConstRef stackTrace, int index) {
 
 }  // namespace
 
-// TODO: this implementation is just a hack, e.g. the result is inexact;
-// however it is better to have an inexact stacktrace than not to have any.
-NO_INLINE OBJ_GETTER0(Kotlin_getCurrentStackTrace) {
+NO_INLINE int GetCurrentStackTraceAddresses(KNativePtr* frames, int capacity, int skipFrames) {
 #if OMIT_BACKTRACE
-  return AllocArrayInstance(theNativePtrArrayTypeInfo, 0, OBJ_RESULT);
+  return 0;
 #else
-  // Skips first 2 elements as irrelevant: this function and primary Throwable constructor.
-  constexpr int kSkipFrames = 2;
+  // Skip this function too.
+  skipFrames++;
 #if USE_GCC_UNWIND
-  int depth = 0;
-  _Unwind_Backtrace(depthCountCallback, &depth);
-  Backtrace result(depth, kSkipFrames);
-  if (result.obj()->array()->count_ > 0) {
-    _Unwind_Backtrace(unwindCallback, &result);
-  }
-  RETURN_OBJ(result.obj());
+  Backtrace backtrace = { frames, 0, capacity - skipFrames, skipFrames };
+  _Unwind_Backtrace(unwindCallback, &backtrace);
+  return backtrace.size;
 #else
-  const int maxSize = 32;
-  void* buffer[maxSize];
-
-  int size = backtrace(buffer, maxSize);
-  if (size < kSkipFrames)
-    return AllocArrayInstance(theNativePtrArrayTypeInfo, 0, OBJ_RESULT);
+  int size = backtrace(frames, capacity) - skipFrames;
+  if (size <= 0) return 0;
+  memmove(frames, frames + skipFrames, size * sizeof(KNativePtr));
+  return size;
+#endif
+#endif  // !OMIT_BACKTRACE
+}
 
-  ObjHolder resultHolder;
-  ObjHeader* result = AllocArrayInstance(theNativePtrArrayTypeInfo, size - kSkipFrames, resultHolder.slot());
-  for (int index = kSkipFrames; index < size; ++index) {
-    Kotlin_NativePtrArray_set(result, index - kSkipFrames, buffer[index]);
+// TODO: this implementation is just a hack, e.g. the result is inexact;
+// however it is better to have an inexact stacktrace than not to have any.
+extern "C" NO_INLINE void Kotlin_Throwable_captureStackTrace(KRef throwable) {
+#if !OMIT_BACKTRACE
+  // The buffer also holds the skipped frames and `GetCurrentStackTraceAddresses` itself.
+  int limit = std::min(atomicGet(&stackTraceDepthLimit), std::numeric_limits<int>::max() - kSkipFrames - 1);
+  if (limit == 0) return;
+
+  // Capture into the thread local buffer, and again into a twice larger one while it gets filled below the limit.
+  int depth = std::min(limit, kInitialCaptureDepth);
+  KNativePtr* frames = nullptr;
+  int size = 0;
+  while (true) {
+    int capacity = depth + kSkipFrames + 1;
+    frames = getStackTraceBuffer(capacity);
+    if (frames == nullptr) return;
+    size = GetCurrentStackTraceAddresses(frames, capacity, kSkipFrames);
+    if (size < depth || depth == limit) break;
+    depth = depth <= limit / 2 ? depth * 2 : limit;
   }
-  RETURN_OBJ(result);
-#endif
+  if (size == 0) return;
+
+  auto* stackTrace = reinterpret_cast<CapturedStackTrace*>(
+      konanAllocMemory(sizeof(CapturedStackTrace) + size * sizeof(KNativePtr)));
+  // Without the frames the stack trace is empty, like when the limit is zero.
+  if (stackTrace == nullptr) return;
+  stackTrace->size = size;
+  memcpy(stackTrace->frames(), frames, size * sizeof(KNativePtr));
+  *throwable->GetStackTraceLocation() = stackTrace;
+#endif  // !OMIT_BACKTRACE
+}
+
+extern "C" OBJ_GETTER(Kotlin_Throwable_getStackTraceAddresses, KRef throwable) {
+#if OMIT_BACKTRACE
+  return AllocArrayInstance(theNativePtrArrayTypeInfo, 0, OBJ_RESULT);
+#else
+  // Throwables without a meta object have no frames, don't create one.
+  auto* stackTrace = throwable->has_meta_object()
+      ? reinterpret_cast<CapturedStackTrace*>(*throwable->GetStackTraceLocation())
+      : nullptr;
+  if (stackTrace == nullptr)
+    return AllocArrayInstance(theNativePtrArrayTypeInfo, 0, OBJ_RESULT);
+  ObjHeader* result = AllocArrayInstance(theNativePtrArrayTypeInfo, stackTrace->size, OBJ_RESULT);
+  // TODO: throw cached OOME?
+  RuntimeCheck(result != nullptr, "Cannot create backtrace array");
+  memcpy(PrimitiveArrayAddressOfElementAt<KNativePtr>(result->array(), 0), stackTrace->frames(),
+         stackTrace->size * sizeof(KNativePtr));
+  return result;
 #endif  // !OMIT_BACKTRACE
 }
 
+void DestroyCapturedStackTrace(void* stackTrace) {
+  if (stackTrace != nullptr) konanFreeMemory(stackTrace);
+}
+
+extern "C" KInt Kotlin_Debugging_getStackTraceDepthLimit() {
+  return atomicGet(&stackTraceDepthLimit);
+}
+
+extern "C" void Kotlin_Debugging_setStackTraceDepthLimit(KInt value) {
+  if (value < 0) ThrowIllegalArgumentException();
+  atomicSet(&stackTraceDepthLimit, value);
+}
+
 OBJ_GETTER(GetStackTraceStrings, KConstRef stackTrace) {
 #if OMIT_BACKTRACE
   ObjHeader* result = AllocArrayInstance(theArrayTypeInfo, 1, OBJ_RESULT);
@@ -23,8 +23,19 @@
 extern "C" {
 #endif
 
-// Returns current stacktrace as Array<String>.
-OBJ_GETTER0(Kotlin_getCurrentStackTrace);
+// Keeps the current stack trace in the meta object of `throwable`, unless capturing is disabled.
+void Kotlin_Throwable_captureStackTrace(KRef throwable);
+
+// Returns the stack trace kept by `Kotlin_Throwable_captureStackTrace` as a NativePtrArray.
+OBJ_GETTER(Kotlin_Throwable_getStackTraceAddresses, KRef throwable);
+
+// Frees the stack trace kept in a meta object, called when the meta object is destroyed.
+void DestroyCapturedStackTrace(void* stackTrace);
+
+// Stores return addresses of the current stack into `frames`, skipping `skipFrames` innermost frames of the caller
+// and keeping at most `capacity - skipFrames` of the rest. `frames` must be able to hold `capacity` addresses.
+// Returns the number of stored addresses.
+int GetCurrentStackTraceAddresses(KNativePtr* frames, int capacity, int skipFrames);
 
 OBJ_GETTER(GetStackTraceStrings, KConstRef stackTrace);
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "HeapSnapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "KString.h"
+#include "ObjectTraversal.hpp"
+#include "Porting.h"
+#include "TypeInfo.h"
+
+using namespace kotlin;
+
+namespace {
+
+constexpr char kMagic[] = {'K', 'N', 'H', 'S'};
+
+uint64_t idOf(const void* pointer) noexcept {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer));
+}
+
+// Field names are only available with the extended type info, which lists all the fields, not just references.
+const char* fieldName(const TypeInfo* typeInfo, int32_t offset) noexcept {
+    const ExtendedTypeInfo* extendedInfo = typeInfo->extendedInfo_;
+    if (extendedInfo == nullptr || extendedInfo->fieldNames_ == nullptr) return "";
+    for (int32_t i = 0; i < extendedInfo->fieldsCount_; ++i) {
+        if (extendedInfo->fieldOffsets_[i] == offset) return extendedInfo->fieldNames_[i];
+    }
+    return "";
+}
+
+} // namespace
+
+HeapSnapshotWriter::HeapSnapshotWriter(const char* path) noexcept : file_(konan::fileOpenForWrite(path)) {
+    if (file_ == nullptr) return;
+    buffer_.reserve(kBufferSize);
+    WriteBytes(kMagic, sizeof(kMagic));
+    Write<uint32_t>(kVersion);
+}
+
+HeapSnapshotWriter::~HeapSnapshotWriter() {
+    if (file_ != nullptr) konan::fileClose(file_);
+}
+
+void HeapSnapshotWriter::WriteRoot(RootKind kind, const ObjHeader* object) noexcept {
+    if (object == nullptr) return;
+    Write<uint8_t>(static_cast<uint8_t>(Record::kRoot));
+    Write<uint8_t>(static_cast<uint8_t>(kind));
+    Write<uint64_t>(idOf(object));
+}
+
+void HeapSnapshotWriter::WriteObject(const ObjHeader* object) noexcept {
+    const TypeInfo* typeInfo = object->type_info();
+    if (types_.insert(typeInfo).second) {
+        WriteType(typeInfo);
+    }
+    uint32_t referenceCount = 0;
+    TraverseReferenceFields(object, [&referenceCount](uint32_t, ObjHeader* const* location) {
+        if (*location != nullptr) ++referenceCount;
+    });
+    Write<uint8_t>(static_cast<uint8_t>(Record::kObject));
+    Write<uint64_t>(idOf(object));
+    Write<uint64_t>(idOf(typeInfo));
+    Write<uint32_t>(ObjectSize(object));
+    Write<uint32_t>(referenceCount);
+    TraverseReferenceFields(object, [this](uint32_t index, ObjHeader* const* location) {
+        if (*location == nullptr) return;
+        Write<uint32_t>(index);
+        Write<uint64_t>(idOf(*location));
+    });
+}
+
+bool HeapSnapshotWriter::Finish() noexcept {
+    if (file_ == nullptr) return false;
+    Write<uint8_t>(static_cast<uint8_t>(Record::kEnd));
+    Flush();
+    bool closed = konan::fileClose(file_);
+    file_ = nullptr;
+    return closed && !failed_;
+}
+
+// static
+uint32_t HeapSnapshotWriter::ObjectSize(const ObjHeader* object) noexcept {
+    const TypeInfo* typeInfo = object->type_info();
+    if (!typeInfo->IsArray()) return static_cast<uint32_t>(typeInfo->instanceSize_);
+    const ArrayHeader* array = object->array();
+    uint32_t count = typeInfo == theStringTypeInfo ? StringStorageLength(array) : array->count_;
+    return static_cast<uint32_t>(sizeof(ArrayHeader)) + static_cast<uint32_t>(-typeInfo->instanceSize_) * count;
+}
+
+void HeapSnapshotWriter::WriteType(const TypeInfo* typeInfo) noexcept {
+    KStdString name = QualifiedTypeName(typeInfo);
+    Write<uint8_t>(static_cast<uint8_t>(Record::kType));
+    Write<uint64_t>(idOf(typeInfo));
+    WriteString(name.data(), name.size());
+    Write<int32_t>(typeInfo->instanceSize_);
+    uint32_t fieldCount = typeInfo->IsArray() ? 0 : static_cast<uint32_t>(typeInfo->objOffsetsCount_);
+    Write<uint32_t>(fieldCount);
+    for (uint32_t i = 0; i < fieldCount; ++i) {
+        const char* field = fieldName(typeInfo, typeInfo->objOffsets_[i]);
+        WriteString(field, strlen(field));
+    }
+}
+
+void HeapSnapshotWriter::WriteString(const char* data, size_t size) noexcept {
+    Write<uint32_t>(static_cast<uint32_t>(size));
+    WriteBytes(data, size);
+}
+
+void HeapSnapshotWriter::WriteBytes(const void* data, size_t size) noexcept {
+    if (file_ == nullptr || failed_) return;
+    auto* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        size_t chunk = std::min(size, kBufferSize - buffer_.size());
+        buffer_.insert(buffer_.end(), bytes, bytes + chunk);
+        bytes += chunk;
+        size -= chunk;
+        if (buffer_.size() == kBufferSize) Flush();
+    }
+}
+
+void HeapSnapshotWriter::Flush() noexcept {
+    if (buffer_.empty() || failed_) return;
+    if (!konan::fileWrite(file_, buffer_.data(), buffer_.size())) failed_ = true;
+    buffer_.clear();
+}
+
+extern "C" {
+
+KBoolean Kotlin_HeapSnapshot_dump(KConstRef path) {
+    auto utf8Path = CreateCStringFromString(path);
+    bool result = DumpHeapSnapshot(utf8Path);
+    DisposeCString(utf8Path);
+    return result;
+}
+
+} // extern "C"
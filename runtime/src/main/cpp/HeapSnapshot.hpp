@@ -0,0 +1,93 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_HEAP_SNAPSHOT_H
+#define RUNTIME_HEAP_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Memory.h"
+#include "Types.h"
+#include "Utils.hpp"
+
+namespace kotlin {
+
+// Streams a heap snapshot into a file, buffering at most `kBufferSize` bytes plus the set of the types written so far.
+//
+// The format is read by tools/heapSnapshotAnalyzer. All integers are little-endian; strings are a `u32` length followed
+// by that many bytes of UTF-8; objects and types are identified by their addresses.
+//
+//     file    := "KNHS" version:u32 record* END
+//     record  := TYPE id:u64 name:string instanceSize:i32 fieldCount:u32 (fieldName:string)*
+//              | OBJECT id:u64 typeId:u64 size:u32 referenceCount:u32 (index:u32 target:u64)*
+//              | ROOT kind:u8 target:u64
+//
+// TYPE lists the names of the reference fields of a class in the order of `TypeInfo::objOffsets_`, empty if unknown;
+// `instanceSize` is the negated element size for arrays.
+// OBJECT lists non-null references only: `index` is the reference field index for objects and the element index for arrays.
+// A TYPE record always precedes the first OBJECT record of the type.
+class HeapSnapshotWriter : private Pinned {
+public:
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kBufferSize = 64 * 1024;
+
+    enum class Record : uint8_t {
+        kEnd = 0,
+        kType = 1,
+        kObject = 2,
+        kRoot = 3,
+    };
+
+    enum class RootKind : uint8_t {
+        kStack = 1,
+        kGlobal = 2,
+        kStableRef = 3,
+        kThreadLocal = 4,
+    };
+
+    // Opens the file at `path`; `ok()` is false if it couldn't be opened.
+    explicit HeapSnapshotWriter(const char* path) noexcept;
+    ~HeapSnapshotWriter();
+
+    bool ok() const noexcept { return file_ != nullptr && !failed_; }
+
+    void WriteRoot(RootKind kind, const ObjHeader* object) noexcept;
+    // Writes `object` with its references, preceded by its type if that's not written yet.
+    void WriteObject(const ObjHeader* object) noexcept;
+
+    // Writes the end of the snapshot and closes the file. Returns false if anything couldn't be written.
+    bool Finish() noexcept;
+
+    // Size of `object` on the heap, without the memory manager headers.
+    static uint32_t ObjectSize(const ObjHeader* object) noexcept;
+
+private:
+    void WriteType(const TypeInfo* typeInfo) noexcept;
+    void WriteBytes(const void* data, size_t size) noexcept;
+    void WriteString(const char* data, size_t size) noexcept;
+    void Flush() noexcept;
+
+    template <typename T>
+    void Write(T value) noexcept {
+        static_assert(std::is_integral<T>::value, "Only integers are written as is");
+        // Little-endian byte by byte, regardless of the host.
+        uint8_t bytes[sizeof(T)];
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            bytes[i] = static_cast<uint8_t>(static_cast<typename std::make_unsigned<T>::type>(value) >> (8 * i));
+        }
+        WriteBytes(bytes, sizeof(T));
+    }
+
+    void* file_;
+    bool failed_ = false;
+    KStdVector<uint8_t> buffer_;
+    KStdUnorderedSet<const TypeInfo*> types_;
+};
+
+} // namespace kotlin
+
+#endif // RUNTIME_HEAP_SNAPSHOT_H
@@ -0,0 +1,249 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "HeapSnapshot.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "TypeInfo.h"
+
+using namespace kotlin;
+
+namespace {
+
+struct TestObject {
+    ObjHeader header;
+    ObjHeader* first;
+    KInt value;
+    ObjHeader* second;
+};
+
+const int32_t kTestObjectOffsets[] = {offsetof(TestObject, first), offsetof(TestObject, second)};
+
+struct Reference {
+    uint32_t index;
+    uint64_t target;
+
+    bool operator==(const Reference& rhs) const { return index == rhs.index && target == rhs.target; }
+};
+
+struct Type {
+    std::string name;
+    int32_t instanceSize;
+    std::vector<std::string> fields;
+};
+
+struct Object {
+    uint64_t type;
+    uint32_t size;
+    std::vector<Reference> references;
+};
+
+struct Snapshot {
+    uint32_t version = 0;
+    std::map<uint64_t, Type> types;
+    std::map<uint64_t, Object> objects;
+    std::vector<std::pair<HeapSnapshotWriter::RootKind, uint64_t>> roots;
+};
+
+class Reader {
+public:
+    explicit Reader(std::string data) : data_(std::move(data)) {}
+
+    template <typename T>
+    T Read() {
+        uint64_t result = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            result |= static_cast<uint64_t>(static_cast<uint8_t>(data_.at(position_++))) << (8 * i);
+        }
+        return static_cast<T>(result);
+    }
+
+    std::string ReadString() {
+        auto size = Read<uint32_t>();
+        auto result = data_.substr(position_, size);
+        position_ += size;
+        return result;
+    }
+
+    bool AtEnd() const { return position_ == data_.size(); }
+
+private:
+    std::string data_;
+    size_t position_ = 0;
+};
+
+Snapshot Parse(const std::string& data) {
+    Snapshot snapshot;
+    EXPECT_THAT(data.substr(0, 4), "KNHS");
+    Reader reader(data.substr(4));
+    snapshot.version = reader.Read<uint32_t>();
+    while (true) {
+        auto record = static_cast<HeapSnapshotWriter::Record>(reader.Read<uint8_t>());
+        switch (record) {
+            case HeapSnapshotWriter::Record::kEnd:
+                EXPECT_TRUE(reader.AtEnd());
+                return snapshot;
+            case HeapSnapshotWriter::Record::kType: {
+                auto id = reader.Read<uint64_t>();
+                EXPECT_THAT(snapshot.types.count(id), 0);
+                Type type;
+                type.name = reader.ReadString();
+                type.instanceSize = reader.Read<int32_t>();
+                auto fieldCount = reader.Read<uint32_t>();
+                for (uint32_t i = 0; i < fieldCount; ++i) {
+                    type.fields.push_back(reader.ReadString());
+                }
+                snapshot.types[id] = type;
+                break;
+            }
+            case HeapSnapshotWriter::Record::kObject: {
+                auto id = reader.Read<uint64_t>();
+                Object object;
+                object.type = reader.Read<uint64_t>();
+                EXPECT_THAT(snapshot.types.count(object.type), 1);
+                object.size = reader.Read<uint32_t>();
+                auto referenceCount = reader.Read<uint32_t>();
+                for (uint32_t i = 0; i < referenceCount; ++i) {
+                    auto index = reader.Read<uint32_t>();
+                    object.references.push_back({index, reader.Read<uint64_t>()});
+                }
+                snapshot.objects[id] = object;
+                break;
+            }
+            case HeapSnapshotWriter::Record::kRoot: {
+                auto kind = static_cast<HeapSnapshotWriter::RootKind>(reader.Read<uint8_t>());
+                snapshot.roots.emplace_back(kind, reader.Read<uint64_t>());
+                break;
+            }
+            default:
+                ADD_FAILURE() << "Unexpected record " << static_cast<int>(record);
+                return snapshot;
+        }
+    }
+}
+
+uint64_t IdOf(const void* pointer) {
+    return reinterpret_cast<uintptr_t>(pointer);
+}
+
+class HeapSnapshotTest : public testing::Test {
+public:
+    HeapSnapshotTest() {
+        type_.typeInfo_ = &type_;
+        type_.instanceSize_ = sizeof(TestObject);
+        type_.objOffsets_ = kTestObjectOffsets;
+        type_.objOffsetsCount_ = 2;
+    }
+
+    ~HeapSnapshotTest() override { std::remove(path_.c_str()); }
+
+    const char* path() const { return path_.c_str(); }
+
+    TestObject& NewObject() {
+        objects_.emplace_back(new TestObject());
+        auto& object = *objects_.back();
+        object.header.typeInfoOrMeta_ = &type_;
+        return object;
+    }
+
+    Snapshot ReadSnapshot() {
+        std::ifstream file(path_, std::ios::binary);
+        return Parse(std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+    }
+
+protected:
+    TypeInfo type_{};
+
+private:
+    std::string path_ = testing::TempDir() + "heap_snapshot_test.knhs";
+    std::vector<std::unique_ptr<TestObject>> objects_;
+};
+
+} // namespace
+
+TEST_F(HeapSnapshotTest, Empty) {
+    HeapSnapshotWriter writer(path());
+    ASSERT_TRUE(writer.ok());
+    EXPECT_TRUE(writer.Finish());
+
+    auto snapshot = ReadSnapshot();
+    EXPECT_THAT(snapshot.version, HeapSnapshotWriter::kVersion);
+    EXPECT_THAT(snapshot.types, testing::IsEmpty());
+    EXPECT_THAT(snapshot.objects, testing::IsEmpty());
+    EXPECT_THAT(snapshot.roots, testing::IsEmpty());
+}
+
+TEST_F(HeapSnapshotTest, ObjectsAndRoots) {
+    auto& object1 = NewObject();
+    auto& object2 = NewObject();
+    auto& object3 = NewObject();
+    object1.first = &object2.header;
+    object1.second = &object3.header;
+    object2.second = &object3.header;
+
+    HeapSnapshotWriter writer(path());
+    writer.WriteRoot(HeapSnapshotWriter::RootKind::kStack, &object1.header);
+    writer.WriteRoot(HeapSnapshotWriter::RootKind::kGlobal, nullptr);
+    writer.WriteRoot(HeapSnapshotWriter::RootKind::kStableRef, &object2.header);
+    writer.WriteObject(&object1.header);
+    writer.WriteObject(&object2.header);
+    writer.WriteObject(&object3.header);
+    EXPECT_TRUE(writer.Finish());
+
+    auto snapshot = ReadSnapshot();
+    ASSERT_THAT(snapshot.types, testing::SizeIs(1));
+    auto& type = snapshot.types[IdOf(&type_)];
+    EXPECT_THAT(type.name, "<anonymous>");
+    EXPECT_THAT(type.instanceSize, static_cast<int32_t>(sizeof(TestObject)));
+    EXPECT_THAT(type.fields, testing::ElementsAre("", ""));
+
+    ASSERT_THAT(snapshot.objects, testing::SizeIs(3));
+    auto& actual1 = snapshot.objects[IdOf(&object1)];
+    EXPECT_THAT(actual1.type, IdOf(&type_));
+    EXPECT_THAT(actual1.size, sizeof(TestObject));
+    EXPECT_THAT(actual1.references, testing::ElementsAre(Reference{0, IdOf(&object2)}, Reference{1, IdOf(&object3)}));
+    EXPECT_THAT(snapshot.objects[IdOf(&object2)].references, testing::ElementsAre(Reference{1, IdOf(&object3)}));
+    EXPECT_THAT(snapshot.objects[IdOf(&object3)].references, testing::IsEmpty());
+
+    EXPECT_THAT(
+            snapshot.roots,
+            testing::ElementsAre(
+                    std::make_pair(HeapSnapshotWriter::RootKind::kStack, IdOf(&object1)),
+                    std::make_pair(HeapSnapshotWriter::RootKind::kStableRef, IdOf(&object2))));
+}
+
+TEST_F(HeapSnapshotTest, LargerThanBuffer) {
+    auto& object = NewObject();
+    object.first = &object.header;
+    constexpr int kRootCount = HeapSnapshotWriter::kBufferSize / 8;
+
+    HeapSnapshotWriter writer(path());
+    for (int i = 0; i < kRootCount; ++i) {
+        writer.WriteRoot(HeapSnapshotWriter::RootKind::kThreadLocal, &object.header);
+    }
+    writer.WriteObject(&object.header);
+    EXPECT_TRUE(writer.Finish());
+
+    auto snapshot = ReadSnapshot();
+    EXPECT_THAT(snapshot.roots, testing::SizeIs(kRootCount));
+    EXPECT_THAT(snapshot.objects, testing::SizeIs(1));
+}
+
+TEST_F(HeapSnapshotTest, CannotOpen) {
+    HeapSnapshotWriter writer("/nonexistent/directory/snapshot.knhs");
+    EXPECT_FALSE(writer.ok());
+    writer.WriteRoot(HeapSnapshotWriter::RootKind::kStack, &NewObject().header);
+    EXPECT_FALSE(writer.Finish());
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "IdentityHash.hpp"
+
+using namespace kotlin;
+
+int32_t kotlin::IdentityHashCode(ObjHeader* object) noexcept {
+    if (object == nullptr) return 0;
+    auto address = reinterpret_cast<uintptr_t>(object);
+    if (object->permanent()) return MixIdentityHash(address);
+
+    int32_t* location = object->GetIdentityHashLocation();
+    int32_t hash = __atomic_load_n(location, __ATOMIC_RELAXED);
+    if (hash == 0) {
+        // Racing threads compute the same value, as the object can't be moved while it's being used.
+        hash = MixIdentityHash(address);
+        __atomic_store_n(location, hash, __ATOMIC_RELAXED);
+    }
+    return hash;
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_IDENTITY_HASH_H
+#define RUNTIME_IDENTITY_HASH_H
+
+#include <cstdint>
+
+#include "Common.h"
+#include "Memory.h"
+
+namespace kotlin {
+
+// Mixes the address bits with the MurmurHash3 finalizer. Addresses are aligned and allocated next to each other,
+// so without mixing their low bits are constant and a hash table bucket index depends on a few middle bits only.
+// Never returns 0, which marks a hash that is not computed yet.
+ALWAYS_INLINE inline int32_t MixIdentityHash(uintptr_t address) noexcept {
+    uint64_t hash = static_cast<uint64_t>(address);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    auto result = static_cast<int32_t>(hash);
+    return result != 0 ? result : 1;
+}
+
+// Identity hash of `object`, or 0 for `nullptr`. It's derived from the address when first requested and then kept
+// in the meta object, so it stays the same if the object is moved. Permanent and stack objects are never moved and
+// can't have a meta object, so their hash is derived from the address every time.
+int32_t IdentityHashCode(ObjHeader* object) noexcept;
+
+} // namespace kotlin
+
+#endif // RUNTIME_IDENTITY_HASH_H
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "IdentityHash.hpp"
+
+#include <set>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace kotlin;
+
+TEST(IdentityHashTest, Deterministic) {
+    EXPECT_THAT(MixIdentityHash(0x1000), MixIdentityHash(0x1000));
+    EXPECT_NE(MixIdentityHash(0x1000), MixIdentityHash(0x1010));
+}
+
+TEST(IdentityHashTest, NeverZero) {
+    EXPECT_NE(MixIdentityHash(0), 0);
+}
+
+TEST(IdentityHashTest, LowBitsOfAlignedAddresses) {
+    // 16-byte aligned objects allocated one after another fill the buckets of a 256-bucket table evenly.
+    constexpr int kBucketCount = 256;
+    constexpr int kObjectCount = kBucketCount * 64;
+    int buckets[kBucketCount] = {};
+    for (uintptr_t i = 0; i < kObjectCount; ++i) {
+        ++buckets[MixIdentityHash(0x7f0000001000 + i * 16) & (kBucketCount - 1)];
+    }
+    for (int count : buckets) {
+        EXPECT_GT(count, 16);
+        EXPECT_LT(count, 128);
+    }
+}
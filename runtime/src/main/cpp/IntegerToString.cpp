@@ -0,0 +1,166 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "IntegerToString.hpp"
+
+#include "KAssert.h"
+
+using namespace kotlin;
+
+namespace {
+
+// "00", "01", ..., "99": two digits are written per division.
+constexpr char kDigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+constexpr uint64_t kPowersOfTen[] = {
+        1ull,
+        10ull,
+        100ull,
+        1000ull,
+        10000ull,
+        100000ull,
+        1000000ull,
+        10000000ull,
+        100000000ull,
+        1000000000ull,
+        10000000000ull,
+        100000000000ull,
+        1000000000000ull,
+        10000000000000ull,
+        100000000000000ull,
+        1000000000000000ull,
+        10000000000000000ull,
+        100000000000000000ull,
+        1000000000000000000ull,
+        10000000000000000000ull,
+};
+
+constexpr char kDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+size_t DigitCount(uint64_t value) noexcept {
+    if (value < 10) return 1;
+    // log10(2) ~ 1233 / 4096, which gives either the exact digit count or one less.
+    size_t bits = 64 - __builtin_clzll(value);
+    size_t approximation = (bits * 1233) >> 12;
+    return approximation + (value >= kPowersOfTen[approximation] ? 1 : 0);
+}
+
+// Writes the digits of `value` backwards, ending right before `end`.
+void WriteDigits(uint32_t value, KChar* end) noexcept {
+    while (value >= 100) {
+        uint32_t pair = (value % 100) * 2;
+        value /= 100;
+        *--end = kDigitPairs[pair + 1];
+        *--end = kDigitPairs[pair];
+    }
+    if (value >= 10) {
+        *--end = kDigitPairs[value * 2 + 1];
+        *--end = kDigitPairs[value * 2];
+    } else {
+        *--end = static_cast<KChar>('0' + value);
+    }
+}
+
+void WriteDigits(uint64_t value, KChar* end) noexcept {
+    // 64-bit divisions are slow on 32-bit targets, so split off the lowest 8 digits until 32 bits are enough.
+    while (value > UINT32_MAX) {
+        uint32_t low = static_cast<uint32_t>(value % 100000000);
+        value /= 100000000;
+        for (int i = 0; i < 4; ++i) {
+            uint32_t pair = (low % 100) * 2;
+            low /= 100;
+            *--end = kDigitPairs[pair + 1];
+            *--end = kDigitPairs[pair];
+        }
+    }
+    WriteDigits(static_cast<uint32_t>(value), end);
+}
+
+// Avoids the overflow of `-value` for the minimal value.
+inline uint32_t Magnitude(int32_t value) noexcept {
+    return value < 0 ? 0u - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+}
+
+inline uint64_t Magnitude(int64_t value) noexcept {
+    return value < 0 ? 0ull - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+}
+
+} // namespace
+
+size_t kotlin::DecimalLength(int32_t value) noexcept {
+    return DigitCount(Magnitude(value)) + (value < 0 ? 1 : 0);
+}
+
+size_t kotlin::DecimalLength(int64_t value) noexcept {
+    return DigitCount(Magnitude(value)) + (value < 0 ? 1 : 0);
+}
+
+void kotlin::WriteDecimal(int32_t value, KChar* buffer, size_t length) noexcept {
+    RuntimeAssert(length == DecimalLength(value), "Wrong length %zu for %d", length, value);
+    if (value < 0) buffer[0] = '-';
+    WriteDigits(Magnitude(value), buffer + length);
+}
+
+void kotlin::WriteDecimal(int64_t value, KChar* buffer, size_t length) noexcept {
+    RuntimeAssert(length == DecimalLength(value), "Wrong length %zu", length);
+    if (value < 0) buffer[0] = '-';
+    uint64_t magnitude = Magnitude(value);
+    if (magnitude <= UINT32_MAX) {
+        WriteDigits(static_cast<uint32_t>(magnitude), buffer + length);
+    } else {
+        WriteDigits(magnitude, buffer + length);
+    }
+}
+
+size_t kotlin::RadixLength(int64_t value, int radix) noexcept {
+    RuntimeAssert(radix >= 2 && radix <= 36, "Unsupported radix %d", radix);
+    if (radix == 10) return DecimalLength(value);
+    uint64_t magnitude = Magnitude(value);
+    size_t length = value < 0 ? 2 : 1;
+    if ((radix & (radix - 1)) == 0) {
+        size_t bitsPerDigit = __builtin_ctz(radix);
+        size_t bits = magnitude == 0 ? 1 : 64 - __builtin_clzll(magnitude);
+        return length - 1 + (bits + bitsPerDigit - 1) / bitsPerDigit;
+    }
+    while (magnitude >= static_cast<uint64_t>(radix)) {
+        magnitude /= radix;
+        ++length;
+    }
+    return length;
+}
+
+void kotlin::WriteRadix(int64_t value, int radix, KChar* buffer, size_t length) noexcept {
+    RuntimeAssert(length == RadixLength(value, radix), "Wrong length %zu for radix %d", length, radix);
+    if (radix == 10) {
+        WriteDecimal(value, buffer, length);
+        return;
+    }
+    if (value < 0) buffer[0] = '-';
+    uint64_t magnitude = Magnitude(value);
+    KChar* end = buffer + length;
+    if ((radix & (radix - 1)) == 0) {
+        size_t bitsPerDigit = __builtin_ctz(radix);
+        uint64_t mask = radix - 1;
+        do {
+            *--end = kDigits[magnitude & mask];
+            magnitude >>= bitsPerDigit;
+        } while (magnitude != 0);
+        return;
+    }
+    do {
+        *--end = kDigits[magnitude % radix];
+        magnitude /= radix;
+    } while (magnitude != 0);
+}
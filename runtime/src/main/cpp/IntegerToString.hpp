@@ -0,0 +1,33 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_INTEGER_TO_STRING_H
+#define RUNTIME_INTEGER_TO_STRING_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Types.h"
+
+namespace kotlin {
+
+// Length of "-9223372036854775808".
+constexpr size_t kLongToStringMaxLength = 20;
+
+// Number of characters in the decimal representation of `value`, including the minus sign.
+size_t DecimalLength(int32_t value) noexcept;
+size_t DecimalLength(int64_t value) noexcept;
+
+// Writes exactly `DecimalLength(value)` characters of the decimal representation of `value` to `buffer`.
+void WriteDecimal(int32_t value, KChar* buffer, size_t length) noexcept;
+void WriteDecimal(int64_t value, KChar* buffer, size_t length) noexcept;
+
+// Same as above for `radix` in [2, 36] with lowercase letters for digits above 9.
+size_t RadixLength(int64_t value, int radix) noexcept;
+void WriteRadix(int64_t value, int radix, KChar* buffer, size_t length) noexcept;
+
+} // namespace kotlin
+
+#endif // RUNTIME_INTEGER_TO_STRING_H
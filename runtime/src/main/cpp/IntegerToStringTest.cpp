@@ -0,0 +1,125 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "IntegerToString.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+template <typename T>
+std::string ToString(T value) {
+    KChar buffer[kLongToStringMaxLength];
+    size_t length = DecimalLength(value);
+    EXPECT_LE(length, kLongToStringMaxLength);
+    WriteDecimal(value, buffer, length);
+    return std::string(buffer, buffer + length);
+}
+
+std::string ToString(int64_t value, int radix) {
+    // Binary representation with sign.
+    KChar buffer[65];
+    size_t length = RadixLength(value, radix);
+    EXPECT_LE(length, sizeof(buffer) / sizeof(buffer[0]));
+    WriteRadix(value, radix, buffer, length);
+    return std::string(buffer, buffer + length);
+}
+
+std::string Printf(int64_t value) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%" PRId64, value);
+    return buffer;
+}
+
+// Reference implementation for the radix conversion.
+std::string NaiveToString(int64_t value, int radix) {
+    if (value == 0) return "0";
+    uint64_t magnitude = value < 0 ? 0ull - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    std::string result;
+    while (magnitude != 0) {
+        result.insert(result.begin(), "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % radix]);
+        magnitude /= radix;
+    }
+    if (value < 0) result.insert(result.begin(), '-');
+    return result;
+}
+
+} // namespace
+
+TEST(IntegerToStringTest, Int) {
+    EXPECT_THAT(ToString(int32_t(0)), "0");
+    EXPECT_THAT(ToString(int32_t(7)), "7");
+    EXPECT_THAT(ToString(int32_t(-7)), "-7");
+    EXPECT_THAT(ToString(int32_t(42)), "42");
+    EXPECT_THAT(ToString(int32_t(100)), "100");
+    EXPECT_THAT(ToString(int32_t(-1000)), "-1000");
+    EXPECT_THAT(ToString(std::numeric_limits<int32_t>::max()), "2147483647");
+    EXPECT_THAT(ToString(std::numeric_limits<int32_t>::min()), "-2147483648");
+}
+
+TEST(IntegerToStringTest, Long) {
+    EXPECT_THAT(ToString(int64_t(0)), "0");
+    EXPECT_THAT(ToString(int64_t(-1)), "-1");
+    EXPECT_THAT(ToString(int64_t(4294967295)), "4294967295");
+    EXPECT_THAT(ToString(int64_t(4294967296)), "4294967296");
+    EXPECT_THAT(ToString(int64_t(100000000000000000)), "100000000000000000");
+    EXPECT_THAT(ToString(std::numeric_limits<int64_t>::max()), "9223372036854775807");
+    EXPECT_THAT(ToString(std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+}
+
+TEST(IntegerToStringTest, PowersOfTen) {
+    int64_t power = 1;
+    for (int i = 0; i <= 18; ++i) {
+        EXPECT_THAT(ToString(power), Printf(power));
+        EXPECT_THAT(ToString(power - 1), Printf(power - 1));
+        EXPECT_THAT(ToString(-power), Printf(-power));
+        EXPECT_THAT(ToString(1 - power), Printf(1 - power));
+        if (power <= std::numeric_limits<int32_t>::max()) {
+            EXPECT_THAT(ToString(static_cast<int32_t>(power)), Printf(power));
+            EXPECT_THAT(ToString(static_cast<int32_t>(power - 1)), Printf(power - 1));
+        }
+        power *= 10;
+    }
+}
+
+TEST(IntegerToStringTest, Random) {
+    std::mt19937_64 random(42);
+    for (int i = 0; i < 100000; ++i) {
+        // Spread values over all lengths.
+        int64_t value = static_cast<int64_t>(random()) >> (random() % 64);
+        EXPECT_THAT(ToString(value), Printf(value));
+        EXPECT_THAT(ToString(static_cast<int32_t>(value)), Printf(static_cast<int32_t>(value)));
+    }
+}
+
+TEST(IntegerToStringTest, Radix) {
+    EXPECT_THAT(ToString(0, 2), "0");
+    EXPECT_THAT(ToString(255, 16), "ff");
+    EXPECT_THAT(ToString(-255, 16), "-ff");
+    EXPECT_THAT(ToString(35, 36), "z");
+    EXPECT_THAT(ToString(std::numeric_limits<int64_t>::min(), 2), "-1" + std::string(63, '0'));
+    EXPECT_THAT(ToString(std::numeric_limits<int64_t>::max(), 8), "777777777777777777777");
+
+    std::mt19937_64 random(42);
+    for (int radix = 2; radix <= 36; ++radix) {
+        for (int i = 0; i < 1000; ++i) {
+            int64_t value = static_cast<int64_t>(random()) >> (random() % 64);
+            EXPECT_THAT(ToString(value, radix), NaiveToString(value, radix)) << "radix " << radix;
+        }
+        EXPECT_THAT(ToString(std::numeric_limits<int64_t>::min(), radix), NaiveToString(std::numeric_limits<int64_t>::min(), radix));
+        EXPECT_THAT(ToString(std::numeric_limits<int64_t>::max(), radix), NaiveToString(std::numeric_limits<int64_t>::max(), radix));
+    }
+}
@@ -19,8 +19,10 @@
 #include <stdint.h>
 
 #include "Alloc.h"
+#include "KAssert.h"
 #include "Memory.h"
 #include "MemorySharedRefs.hpp"
+#include "Natives.h"
 #include "Types.h"
 
 extern "C" {
@@ -37,6 +39,26 @@ void Kotlin_Interop_disposeStablePointer(KNativePtr pointer) {
   konanDestructInstance(holder);
 }
 
+// Holders are allocated one by one, so that each of them can also be disposed alone,
+// but the references they hold are created and disposed in batches.
+void Kotlin_Interop_createStablePointers(KConstRef objects, KNativePtr pointers) {
+  const ArrayHeader* array = objects->array();
+  KRefSharedHolder** holders = reinterpret_cast<KRefSharedHolder**>(pointers);
+  for (uint32_t index = 0; index < array->count_; ++index) {
+    holders[index] = konanConstructInstance<KRefSharedHolder>();
+  }
+  KRefSharedHolder::initAll(holders, ArrayAddressOfElementAt(array, 0), array->count_);
+}
+
+void Kotlin_Interop_disposeStablePointers(KNativePtr pointers, KInt count) {
+  RuntimeAssert(count >= 0, "Count must not be negative: %d", count);
+  KRefSharedHolder* const* holders = reinterpret_cast<KRefSharedHolder* const*>(pointers);
+  KRefSharedHolder::disposeAll(holders, count);
+  for (KInt index = 0; index < count; ++index) {
+    konanDestructInstance(holders[index]);
+  }
+}
+
 OBJ_GETTER(Kotlin_Interop_derefStablePointer, KNativePtr pointer) {
   KRefSharedHolder* holder = reinterpret_cast<KRefSharedHolder*>(pointer);
   RETURN_OBJ(holder->ref<ErrorPolicy::kThrow>());
@@ -19,6 +19,7 @@
 
 #include "Common.h"
 #include "Memory.h"
+#include "Natives.h"
 #include "Types.h"
 #include "TypeInfo.h"
 
@@ -28,13 +29,54 @@ extern "C" {
 
 OBJ_GETTER(CreateStringFromCString, const char* cstring);
 OBJ_GETTER(CreateStringFromUtf8, const char* utf8, uint32_t lengthBytes);
+OBJ_GETTER(CreateStringFromUtf16, const KChar* utf16, uint32_t length);
 char* CreateCStringFromString(KConstRef kstring);
 void DisposeCString(char* cstring);
 
+// Whether the runtime creates Latin-1 strings, see `kStringLatin1Flag`. Set with `-Xcompact-strings`.
+bool Kotlin_compactStringsEnabled();
+
 #ifdef __cplusplus
 }
 #endif
 
+// In the compact strings mode strings whose chars all fit into one byte are stored one byte per char
+// and have this flag set in `count_`. The body of such a string is allocated as `(length + 1) / 2` UTF-16
+// chars. Strings emitted by the compiler are always UTF-16, so both coders can meet in any operation.
+constexpr uint32_t kStringLatin1Flag = 1u << 31;
+
+inline bool IsLatin1String(const ArrayHeader* string) {
+  return (string->count_ & kStringLatin1Flag) != 0;
+}
+
+inline uint32_t StringLength(const ArrayHeader* string) {
+  return string->count_ & ~kStringLatin1Flag;
+}
+
+// The number of UTF-16 chars the string body was allocated for.
+inline uint32_t StringStorageLength(const ArrayHeader* string) {
+  return IsLatin1String(string) ? (StringLength(string) + 1) / 2 : string->count_;
+}
+
+inline uint8_t* Latin1StringAddressOfElementAt(ArrayHeader* string, KInt index) {
+  return AddressOfElementAt<uint8_t>(string, index);
+}
+
+inline const uint8_t* Latin1StringAddressOfElementAt(const ArrayHeader* string, KInt index) {
+  return AddressOfElementAt<uint8_t>(string, index);
+}
+
+// Appends the UTF-8 form of Latin-1 chars, which are always valid code points.
+void Latin1ToUtf8(const uint8_t* latin1, size_t length, KStdString* utf8);
+
+// Fully qualified name of the type, `<anonymous>` if the type has no name.
+KStdString QualifiedTypeName(const TypeInfo* typeInfo);
+
+inline KChar StringCharAt(const ArrayHeader* string, KInt index) {
+  return IsLatin1String(string) ?
+      *Latin1StringAddressOfElementAt(string, index) : *CharArrayAddressOfElementAt(string, index);
+}
+
 template <typename T>
 int binarySearchRange(const T* array, int arrayLength, T needle) {
   int bottom = 0;
@@ -17,6 +17,8 @@
 #ifndef RUNTIME_MEMORY_H
 #define RUNTIME_MEMORY_H
 
+#include <cstddef>
+
 #include "KAssert.h"
 #include "Common.h"
 #include "TypeInfo.h"
@@ -65,6 +67,12 @@ struct ObjHeader {
 
   ALWAYS_INLINE ObjHeader** GetWeakCounterLocation();
 
+  // See IdentityHash.hpp.
+  int32_t* GetIdentityHashLocation();
+
+  // See `Kotlin_Throwable_captureStackTrace`.
+  void** GetStackTraceLocation();
+
 #ifdef KONAN_OBJC_INTEROP
   ALWAYS_INLINE void* GetAssociatedObject();
   ALWAYS_INLINE void** GetAssociatedObjectLocation();
@@ -108,6 +116,10 @@ ALWAYS_INLINE bool isFrozen(const ObjHeader* obj);
 ALWAYS_INLINE bool isPermanentOrFrozen(const ObjHeader* obj);
 ALWAYS_INLINE bool isShareable(const ObjHeader* obj);
 
+// Incremented every time an object subgraph gets frozen. Freezing is the only way for a mutable object
+// to become immutable, so a successful mutability check of an object stays valid while this counter doesn't change.
+extern int32_t freezeCount;
+
 class ForeignRefManager;
 typedef ForeignRefManager* ForeignRefContext;
 
@@ -152,6 +164,11 @@ OBJ_GETTER(AllocInstance, const TypeInfo* type_info) RUNTIME_NOTHROW;
 
 OBJ_GETTER(AllocArrayInstance, const TypeInfo* type_info, int32_t elements);
 
+// Same as `AllocArrayInstance`, but the elements are left uninitialized, so that the runtime doesn't
+// zero the memory it's about to overwrite. Only for arrays of primitive elements and strings, and
+// all the elements must be written before the array can be observed by anyone else.
+OBJ_GETTER(AllocUninitializedArrayInstance, const TypeInfo* type_info, int32_t elements);
+
 OBJ_GETTER(InitThreadLocalSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (*ctor)(ObjHeader*));
 
 OBJ_GETTER(InitSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (*ctor)(ObjHeader*));
@@ -207,6 +224,11 @@ void ZeroStackRef(ObjHeader** location) RUNTIME_NOTHROW;
 void UpdateStackRef(ObjHeader** location, const ObjHeader* object) RUNTIME_NOTHROW;
 // Updates heap/static data location.
 void UpdateHeapRef(ObjHeader** location, const ObjHeader* object) RUNTIME_NOTHROW;
+// Copies `count` references from `source` to `destination`, the ranges may overlap.
+// Updates reference counts in bulk.
+void CopyHeapRefs(ObjHeader** destination, ObjHeader* const* source, uint32_t count) RUNTIME_NOTHROW;
+// Updates `count` heap locations starting from `location` to `object`.
+void FillHeapRefs(ObjHeader** location, const ObjHeader* object, uint32_t count) RUNTIME_NOTHROW;
 // Updates location if it is null, atomically.
 void UpdateHeapRefIfNull(ObjHeader** location, const ObjHeader* object) RUNTIME_NOTHROW;
 // Updates reference in return slot.
@@ -220,6 +242,8 @@ void SetHeapRefLocked(ObjHeader** location, ObjHeader* newValue, int32_t* spinlo
     int32_t* cookie) RUNTIME_NOTHROW;
 // Reads reference with taken lock.
 OBJ_GETTER(ReadHeapRefLocked, ObjHeader** location, int32_t* spinlock, int32_t* cookie) RUNTIME_NOTHROW;
+// Reads reference without a lock. The caller must guarantee that the referred object is not freed concurrently.
+OBJ_GETTER(ReadHeapRefUnlocked, ObjHeader** location, int32_t* cookie) RUNTIME_NOTHROW;
 // Called on frame enter, if it has object slots.
 void EnterFrame(ObjHeader** start, int parameters, int count) RUNTIME_NOTHROW;
 // Called on frame leave, if it has object slots.
@@ -232,6 +256,10 @@ bool ClearSubgraphReferences(ObjHeader* root, bool checked) RUNTIME_NOTHROW;
 void* CreateStablePointer(ObjHeader* obj) RUNTIME_NOTHROW;
 // Disposes stable pointer to the object.
 void DisposeStablePointer(void* pointer) RUNTIME_NOTHROW;
+// Creates stable pointers out of `count` objects at once, storing them into `pointers`.
+void CreateStablePointers(ObjHeader* const* objects, void** pointers, size_t count) RUNTIME_NOTHROW;
+// Disposes `count` stable pointers at once.
+void DisposeStablePointers(void* const* pointers, size_t count) RUNTIME_NOTHROW;
 // Translate stable pointer to object reference.
 OBJ_GETTER(DerefStablePointer, void*) RUNTIME_NOTHROW;
 // Move stable pointer ownership.
@@ -260,6 +288,10 @@ void GC_CollectorCallback(void* worker) RUNTIME_NOTHROW;
 bool Kotlin_Any_isShareable(ObjHeader* thiz);
 void PerformFullGC(MemoryState* memory) RUNTIME_NOTHROW;
 
+// Writes the objects reachable from the roots into the file at `path` in the format described in HeapSnapshot.hpp.
+// Returns false if the file couldn't be written.
+bool DumpHeapSnapshot(const char* path) RUNTIME_NOTHROW;
+
 bool TryAddHeapRef(const ObjHeader* object);
 
 void ReleaseHeapRef(const ObjHeader* object) RUNTIME_NOTHROW;
@@ -269,6 +301,9 @@ ForeignRefContext InitLocalForeignRef(ObjHeader* object);
 
 ForeignRefContext InitForeignRef(ObjHeader* object);
 void DeinitForeignRef(ObjHeader* object, ForeignRefContext context);
+// Batch versions of `InitForeignRef` and `DeinitForeignRef`, `contexts[i]` is for `objects[i]`.
+void InitForeignRefs(ObjHeader* const* objects, ForeignRefContext* contexts, size_t count);
+void DeinitForeignRefs(ObjHeader* const* objects, const ForeignRefContext* contexts, size_t count);
 
 bool IsForeignRefAccessible(ObjHeader* object, ForeignRefContext context);
 
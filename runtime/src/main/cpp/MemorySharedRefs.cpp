@@ -3,6 +3,8 @@
  * that can be found in the LICENSE file.
  */
 
+#include <algorithm>
+
 #include "Exceptions.h"
 #include "MemorySharedRefs.hpp"
 #include "Runtime.h"
@@ -105,6 +107,38 @@ void KRefSharedHolder::dispose() const {
   DeinitForeignRef(obj_, context_);
 }
 
+// static
+void KRefSharedHolder::initAll(KRefSharedHolder* const* holders, ObjHeader* const* objects, size_t count) {
+  ForeignRefContext contexts[kBatchChunkSize];
+  for (size_t start = 0; start < count; start += kBatchChunkSize) {
+    size_t chunk = std::min(count - start, kBatchChunkSize);
+    InitForeignRefs(objects + start, contexts, chunk);
+    for (size_t i = 0; i < chunk; ++i) {
+      RuntimeAssert(objects[start + i] != nullptr, "must not be null");
+      holders[start + i]->obj_ = objects[start + i];
+      holders[start + i]->context_ = contexts[i];
+    }
+  }
+}
+
+// static
+void KRefSharedHolder::disposeAll(KRefSharedHolder* const* holders, size_t count) {
+  ObjHeader* objects[kBatchChunkSize];
+  ForeignRefContext contexts[kBatchChunkSize];
+  size_t chunk = 0;
+  for (size_t i = 0; i < count; ++i) {
+    // Not initialized, like in `dispose`.
+    if (holders[i]->obj_ == nullptr) continue;
+    objects[chunk] = holders[i]->obj_;
+    contexts[chunk] = holders[i]->context_;
+    if (++chunk == kBatchChunkSize) {
+      DeinitForeignRefs(objects, contexts, chunk);
+      chunk = 0;
+    }
+  }
+  DeinitForeignRefs(objects, contexts, chunk);
+}
+
 OBJ_GETTER0(KRefSharedHolder::describe) const {
   // Note: retrieving 'type_info()' is supposed to be correct even for unowned object.
   RETURN_RESULT_OF(DescribeObjectForDebugging, obj_->type_info(), obj_);
@@ -30,9 +30,16 @@ class KRefSharedHolder {
 
   void dispose() const;
 
+  // Batch versions of `init` and `dispose`, `holders[i]` holds `objects[i]`.
+  static void initAll(KRefSharedHolder* const* holders, ObjHeader* const* objects, size_t count);
+  static void disposeAll(KRefSharedHolder* const* holders, size_t count);
+
   OBJ_GETTER0(describe) const;
 
  private:
+  // Batches are processed in chunks of this size, to keep the contexts on the stack.
+  static constexpr size_t kBatchChunkSize = 64;
+
   ObjHeader* obj_;
   ForeignRefContext context_;
 };
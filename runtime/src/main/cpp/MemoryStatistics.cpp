@@ -0,0 +1,362 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "MemoryStatistics.hpp"
+
+#include <cstring>
+#include <mutex>
+
+#include "Alloc.h"
+#include "KAssert.h"
+#include "KString.h"
+#include "Memory.h"
+#include "Porting.h"
+
+using namespace kotlin;
+
+namespace {
+
+void appendNumber(KStdString& out, uint64_t value) {
+    char buffer[24];
+    konan::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value));
+    out += buffer;
+}
+
+void appendNumber(KStdString& out, int64_t value) {
+    char buffer[24];
+    konan::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value));
+    out += buffer;
+}
+
+void appendField(KStdString& out, const char* name, uint64_t value) {
+    out += '"';
+    out += name;
+    out += "\":";
+    appendNumber(out, value);
+}
+
+void updateMax(std::atomic<uint64_t>& max, uint64_t value) {
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+// static
+MemoryStatistics MemoryStatistics::instance_;
+
+// static
+THREAD_LOCAL_VARIABLE MemoryStatistics::ThreadAllocations* MemoryStatistics::currentAllocations_ = nullptr;
+
+// static
+THREAD_LOCAL_VARIABLE bool MemoryStatistics::threadExited_ = false;
+
+bool MemoryStatistics::ThreadAllocations::TryAcquire() noexcept {
+    bool expected = false;
+    return !owned_.load(std::memory_order_relaxed) && owned_.compare_exchange_strong(expected, true, std::memory_order_acquire);
+}
+
+void MemoryStatistics::ThreadAllocations::Reset() noexcept {
+    for (auto& counters : sizeClasses_) {
+        counters.count = 0;
+        counters.bytes = 0;
+    }
+}
+
+// static
+size_t MemoryStatistics::SizeClass(size_t size) noexcept {
+    size_t sizeClass = 0;
+    for (size_t limit = 16; size > limit && sizeClass < kSizeClassCount - 1; limit <<= 1) {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+// static
+size_t MemoryStatistics::PauseBucket(uint64_t microseconds) noexcept {
+    size_t bucket = 0;
+    while (bucket < kPauseBucketCount - 1 && microseconds >= (uint64_t(1) << bucket)) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+void MemoryStatistics::RecordAllocationSlowPath(size_t sizeClass, size_t size) noexcept {
+    if (!threadExited_) {
+        ThreadAllocations* allocations = nullptr;
+        for (auto* candidate = threadAllocations_.load(std::memory_order_acquire); candidate != nullptr; candidate = candidate->next()) {
+            if (candidate->TryAcquire()) {
+                allocations = candidate;
+                break;
+            }
+        }
+        if (allocations == nullptr) {
+            allocations = konanConstructInstance<ThreadAllocations>();
+            if (allocations != nullptr) {
+                auto* head = threadAllocations_.load(std::memory_order_relaxed);
+                do {
+                    allocations->setNext(head);
+                } while (!threadAllocations_.compare_exchange_weak(head, allocations, std::memory_order_release, std::memory_order_relaxed));
+            }
+        }
+        if (allocations != nullptr) {
+            currentAllocations_ = allocations;
+            konan::onThreadExit(ReleaseThreadAllocations, allocations);
+            allocations->Add(sizeClass, size);
+            return;
+        }
+    }
+    exitedThreadAllocations_[sizeClass].count.fetch_add(1, std::memory_order_relaxed);
+    exitedThreadAllocations_[sizeClass].bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+// static
+void MemoryStatistics::ReleaseThreadAllocations(void* allocations) noexcept {
+    currentAllocations_ = nullptr;
+    threadExited_ = true;
+    static_cast<ThreadAllocations*>(allocations)->Release();
+}
+
+uint64_t MemoryStatistics::allocationCount(size_t sizeClass) const noexcept {
+    uint64_t result = exitedThreadAllocations_[sizeClass].count.load(std::memory_order_relaxed);
+    for (auto* allocations = threadAllocations_.load(std::memory_order_acquire); allocations != nullptr; allocations = allocations->next()) {
+        result += (*allocations)[sizeClass].count.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+uint64_t MemoryStatistics::allocatedBytes(size_t sizeClass) const noexcept {
+    uint64_t result = exitedThreadAllocations_[sizeClass].bytes.load(std::memory_order_relaxed);
+    for (auto* allocations = threadAllocations_.load(std::memory_order_acquire); allocations != nullptr; allocations = allocations->next()) {
+        result += (*allocations)[sizeClass].bytes.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void MemoryStatistics::RecordGc(uint64_t pauseMicroseconds) noexcept {
+    gcCount_.fetch_add(1, std::memory_order_relaxed);
+    gcPauseMicroseconds_.fetch_add(pauseMicroseconds, std::memory_order_relaxed);
+    gcPauses_[PauseBucket(pauseMicroseconds)].fetch_add(1, std::memory_order_relaxed);
+    updateMax(gcMaxPauseMicroseconds_, pauseMicroseconds);
+}
+
+void MemoryStatistics::RecordMinorGc(uint64_t pauseMicroseconds, uint64_t freedBytes, uint64_t promotedBytes) noexcept {
+    minorGcCount_.fetch_add(1, std::memory_order_relaxed);
+    minorGcPauseMicroseconds_.fetch_add(pauseMicroseconds, std::memory_order_relaxed);
+    updateMax(minorGcMaxPauseMicroseconds_, pauseMicroseconds);
+    minorGcFreedBytes_.fetch_add(freedBytes, std::memory_order_relaxed);
+    minorGcPromotedBytes_.fetch_add(promotedBytes, std::memory_order_relaxed);
+}
+
+void MemoryStatistics::RecordFinalizerQueueLength(uint64_t length) noexcept {
+    finalizerQueueLength_.store(length, std::memory_order_relaxed);
+    updateMax(finalizerQueueMaxLength_, length);
+}
+
+void MemoryStatistics::WriteJson(KStdString& out) const noexcept {
+    out += "{\"allocations\":[";
+    for (size_t i = 0; i < kSizeClassCount; ++i) {
+        if (i != 0) out += ',';
+        out += "{\"maxSize\":";
+        if (i == kSizeClassCount - 1) {
+            out += "null";
+        } else {
+            appendNumber(out, uint64_t(16) << i);
+        }
+        out += ',';
+        appendField(out, "count", allocationCount(i));
+        out += ',';
+        appendField(out, "bytes", allocatedBytes(i));
+        out += '}';
+    }
+    out += "],\"gc\":{";
+    appendField(out, "count", gcCount());
+    out += ',';
+    appendField(out, "pauseMicroseconds", gcPauseMicroseconds());
+    out += ',';
+    appendField(out, "maxPauseMicroseconds", gcMaxPauseMicroseconds());
+    out += ",\"pauses\":[";
+    for (size_t i = 0; i < kPauseBucketCount; ++i) {
+        if (i != 0) out += ',';
+        out += "{\"lessThanMicroseconds\":";
+        if (i == kPauseBucketCount - 1) {
+            out += "null";
+        } else {
+            appendNumber(out, uint64_t(1) << i);
+        }
+        out += ',';
+        appendField(out, "count", gcPauseCount(i));
+        out += '}';
+    }
+    out += "]},\"minorGc\":{";
+    appendField(out, "count", minorGcCount());
+    out += ',';
+    appendField(out, "pauseMicroseconds", minorGcPauseMicroseconds());
+    out += ',';
+    appendField(out, "maxPauseMicroseconds", minorGcMaxPauseMicroseconds());
+    out += ',';
+    appendField(out, "freedBytes", minorGcFreedBytes());
+    out += ',';
+    appendField(out, "promotedBytes", minorGcPromotedBytes());
+    out += "},";
+    appendField(out, "collectedCycles", collectedCycles());
+    out += ",\"finalizerQueue\":{";
+    appendField(out, "length", finalizerQueueLength());
+    out += ',';
+    appendField(out, "maxLength", finalizerQueueMaxLength());
+    out += "},\"stableRefs\":";
+    appendNumber(out, stableRefs());
+    out += ',';
+    appendField(out, "frozenBytes", frozenBytes());
+    out += '}';
+}
+
+bool MemoryStatistics::DumpJson(const char* path) const noexcept {
+    KStdString json;
+    WriteJson(json);
+    return konan::writeFile(path, json.data(), json.size());
+}
+
+void MemoryStatistics::SetDumpOnExitPath(const char* path) noexcept {
+    char* copy = nullptr;
+    if (path != nullptr) {
+        size_t length = strlen(path);
+        copy = konanAllocArray<char>(length + 1);
+        memcpy(copy, path, length + 1);
+    }
+    std::lock_guard<SpinLock> guard(dumpOnExitPathLock_);
+    if (dumpOnExitPath_ != nullptr) konanFreeMemory(dumpOnExitPath_);
+    dumpOnExitPath_ = copy;
+}
+
+void MemoryStatistics::DumpOnExitIfRequested() noexcept {
+    std::lock_guard<SpinLock> guard(dumpOnExitPathLock_);
+    if (dumpOnExitPath_ == nullptr) return;
+    if (!DumpJson(dumpOnExitPath_)) {
+        konan::consoleErrorf("Cannot write memory statistics to %s\n", dumpOnExitPath_);
+    }
+}
+
+void MemoryStatistics::ResetForTests() noexcept {
+    for (auto& sizeClass : exitedThreadAllocations_) {
+        sizeClass.count = 0;
+        sizeClass.bytes = 0;
+    }
+    for (auto* allocations = threadAllocations_.load(std::memory_order_acquire); allocations != nullptr; allocations = allocations->next()) {
+        allocations->Reset();
+    }
+    gcCount_ = 0;
+    gcPauseMicroseconds_ = 0;
+    gcMaxPauseMicroseconds_ = 0;
+    for (auto& bucket : gcPauses_) {
+        bucket = 0;
+    }
+    minorGcCount_ = 0;
+    minorGcPauseMicroseconds_ = 0;
+    minorGcMaxPauseMicroseconds_ = 0;
+    minorGcFreedBytes_ = 0;
+    minorGcPromotedBytes_ = 0;
+    collectedCycles_ = 0;
+    finalizerQueueLength_ = 0;
+    finalizerQueueMaxLength_ = 0;
+    stableRefs_ = 0;
+    frozenBytes_ = 0;
+    SetDumpOnExitPath(nullptr);
+}
+
+extern "C" {
+
+KLong Kotlin_MemoryStatistics_getAllocationCount(KInt sizeClass) {
+    RuntimeAssert(sizeClass >= 0 && sizeClass < static_cast<KInt>(MemoryStatistics::kSizeClassCount), "Invalid size class %d", sizeClass);
+    return MemoryStatistics::Instance().allocationCount(sizeClass);
+}
+
+KLong Kotlin_MemoryStatistics_getAllocatedBytes(KInt sizeClass) {
+    RuntimeAssert(sizeClass >= 0 && sizeClass < static_cast<KInt>(MemoryStatistics::kSizeClassCount), "Invalid size class %d", sizeClass);
+    return MemoryStatistics::Instance().allocatedBytes(sizeClass);
+}
+
+KLong Kotlin_MemoryStatistics_getGcCount() {
+    return MemoryStatistics::Instance().gcCount();
+}
+
+KLong Kotlin_MemoryStatistics_getGcPauseMicroseconds() {
+    return MemoryStatistics::Instance().gcPauseMicroseconds();
+}
+
+KLong Kotlin_MemoryStatistics_getGcMaxPauseMicroseconds() {
+    return MemoryStatistics::Instance().gcMaxPauseMicroseconds();
+}
+
+KLong Kotlin_MemoryStatistics_getGcPauseCount(KInt bucket) {
+    RuntimeAssert(bucket >= 0 && bucket < static_cast<KInt>(MemoryStatistics::kPauseBucketCount), "Invalid pause bucket %d", bucket);
+    return MemoryStatistics::Instance().gcPauseCount(bucket);
+}
+
+KLong Kotlin_MemoryStatistics_getMinorGcCount() {
+    return MemoryStatistics::Instance().minorGcCount();
+}
+
+KLong Kotlin_MemoryStatistics_getMinorGcPauseMicroseconds() {
+    return MemoryStatistics::Instance().minorGcPauseMicroseconds();
+}
+
+KLong Kotlin_MemoryStatistics_getMinorGcMaxPauseMicroseconds() {
+    return MemoryStatistics::Instance().minorGcMaxPauseMicroseconds();
+}
+
+KLong Kotlin_MemoryStatistics_getMinorGcFreedBytes() {
+    return MemoryStatistics::Instance().minorGcFreedBytes();
+}
+
+KLong Kotlin_MemoryStatistics_getMinorGcPromotedBytes() {
+    return MemoryStatistics::Instance().minorGcPromotedBytes();
+}
+
+KLong Kotlin_MemoryStatistics_getCollectedCycles() {
+    return MemoryStatistics::Instance().collectedCycles();
+}
+
+KLong Kotlin_MemoryStatistics_getFinalizerQueueLength() {
+    return MemoryStatistics::Instance().finalizerQueueLength();
+}
+
+KLong Kotlin_MemoryStatistics_getFinalizerQueueMaxLength() {
+    return MemoryStatistics::Instance().finalizerQueueMaxLength();
+}
+
+KLong Kotlin_MemoryStatistics_getStableRefs() {
+    return MemoryStatistics::Instance().stableRefs();
+}
+
+KLong Kotlin_MemoryStatistics_getFrozenBytes() {
+    return MemoryStatistics::Instance().frozenBytes();
+}
+
+OBJ_GETTER0(Kotlin_MemoryStatistics_toJson) {
+    KStdString json;
+    MemoryStatistics::Instance().WriteJson(json);
+    RETURN_RESULT_OF(CreateStringFromCString, json.c_str());
+}
+
+KBoolean Kotlin_MemoryStatistics_dumpJson(KConstRef path) {
+    auto utf8Path = CreateCStringFromString(path);
+    bool result = MemoryStatistics::Instance().DumpJson(utf8Path);
+    DisposeCString(utf8Path);
+    return result;
+}
+
+void Kotlin_MemoryStatistics_setDumpOnExitPath(KConstRef path) {
+    if (path == nullptr) {
+        MemoryStatistics::Instance().SetDumpOnExitPath(nullptr);
+        return;
+    }
+    auto utf8Path = CreateCStringFromString(path);
+    MemoryStatistics::Instance().SetDumpOnExitPath(utf8Path);
+    DisposeCString(utf8Path);
+}
+
+} // extern "C"
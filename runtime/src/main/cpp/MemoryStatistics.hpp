@@ -0,0 +1,149 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_MEMORY_STATISTICS_H
+#define RUNTIME_MEMORY_STATISTICS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Common.h"
+#include "Mutex.hpp"
+#include "Types.h"
+#include "Utils.hpp"
+
+namespace kotlin {
+
+// Process-wide counters of the memory manager. Always collected: every update is a relaxed atomic
+// operation, so the counters can be read from any thread at any time, but are not a consistent snapshot.
+// Allocations are counted per thread, so that allocating threads don't contend, and summed up on reading.
+class MemoryStatistics : private Pinned {
+public:
+    // Keep in sync with MemoryStatistics.kt.
+    // Size class `i` counts allocations of up to `16 << i` bytes, the last one counts all the bigger ones.
+    static constexpr size_t kSizeClassCount = 18;
+    // Bucket `i` counts GC pauses shorter than `1 << i` microseconds, the last one counts all the longer ones.
+    static constexpr size_t kPauseBucketCount = 24;
+
+    static MemoryStatistics& Instance() noexcept { return instance_; }
+
+    static size_t SizeClass(size_t size) noexcept;
+    static size_t PauseBucket(uint64_t microseconds) noexcept;
+
+    ALWAYS_INLINE void RecordAllocation(size_t size) noexcept {
+        size_t sizeClass = SizeClass(size);
+        if (currentAllocations_ != nullptr) {
+            currentAllocations_->Add(sizeClass, size);
+        } else {
+            RecordAllocationSlowPath(sizeClass, size);
+        }
+    }
+
+    void RecordGc(uint64_t pauseMicroseconds) noexcept;
+    // Minor collections of the generational mode are not counted as GCs.
+    void RecordMinorGc(uint64_t pauseMicroseconds, uint64_t freedBytes, uint64_t promotedBytes) noexcept;
+    void RecordCollectedCycles(uint64_t count) noexcept { collectedCycles_.fetch_add(count, std::memory_order_relaxed); }
+    // The finalizer queue is per thread: the length seen by the last GC and the maximum one are kept.
+    void RecordFinalizerQueueLength(uint64_t length) noexcept;
+    void RecordStableRefCreated(uint64_t count = 1) noexcept { stableRefs_.fetch_add(count, std::memory_order_relaxed); }
+    void RecordStableRefDisposed(uint64_t count = 1) noexcept { stableRefs_.fetch_sub(count, std::memory_order_relaxed); }
+    // Frozen bytes are cumulative: freeing frozen objects doesn't decrease them.
+    void RecordFrozen(uint64_t bytes) noexcept { frozenBytes_.fetch_add(bytes, std::memory_order_relaxed); }
+
+    uint64_t allocationCount(size_t sizeClass) const noexcept;
+    uint64_t allocatedBytes(size_t sizeClass) const noexcept;
+    uint64_t gcCount() const noexcept { return gcCount_.load(std::memory_order_relaxed); }
+    uint64_t gcPauseMicroseconds() const noexcept { return gcPauseMicroseconds_.load(std::memory_order_relaxed); }
+    uint64_t gcMaxPauseMicroseconds() const noexcept { return gcMaxPauseMicroseconds_.load(std::memory_order_relaxed); }
+    uint64_t gcPauseCount(size_t bucket) const noexcept { return gcPauses_[bucket].load(std::memory_order_relaxed); }
+    uint64_t minorGcCount() const noexcept { return minorGcCount_.load(std::memory_order_relaxed); }
+    uint64_t minorGcPauseMicroseconds() const noexcept { return minorGcPauseMicroseconds_.load(std::memory_order_relaxed); }
+    uint64_t minorGcMaxPauseMicroseconds() const noexcept { return minorGcMaxPauseMicroseconds_.load(std::memory_order_relaxed); }
+    uint64_t minorGcFreedBytes() const noexcept { return minorGcFreedBytes_.load(std::memory_order_relaxed); }
+    uint64_t minorGcPromotedBytes() const noexcept { return minorGcPromotedBytes_.load(std::memory_order_relaxed); }
+    uint64_t collectedCycles() const noexcept { return collectedCycles_.load(std::memory_order_relaxed); }
+    uint64_t finalizerQueueLength() const noexcept { return finalizerQueueLength_.load(std::memory_order_relaxed); }
+    uint64_t finalizerQueueMaxLength() const noexcept { return finalizerQueueMaxLength_.load(std::memory_order_relaxed); }
+    int64_t stableRefs() const noexcept { return stableRefs_.load(std::memory_order_relaxed); }
+    uint64_t frozenBytes() const noexcept { return frozenBytes_.load(std::memory_order_relaxed); }
+
+    // Appends all the counters as a JSON object.
+    void WriteJson(KStdString& out) const noexcept;
+    // Writes `WriteJson` output into the file at `path`. Returns false if the file couldn't be written.
+    bool DumpJson(const char* path) const noexcept;
+
+    // The file to dump the statistics into on runtime shutdown. `nullptr`, the default, disables the dump.
+    void SetDumpOnExitPath(const char* path) noexcept;
+    void DumpOnExitIfRequested() noexcept;
+
+    // Only for tests.
+    void ResetForTests() noexcept;
+
+private:
+    struct SizeClassCounters {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> bytes{0};
+    };
+
+    // Allocation counters of a thread. Only written by the owner thread, so updates need no read-modify-write.
+    // Never freed: a new thread takes over the counters of an exited one, keeping their values.
+    class ThreadAllocations : private Pinned {
+    public:
+        ALWAYS_INLINE void Add(size_t sizeClass, size_t size) noexcept {
+            auto& counters = sizeClasses_[sizeClass];
+            counters.count.store(counters.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            counters.bytes.store(counters.bytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        }
+
+        bool TryAcquire() noexcept;
+        void Release() noexcept { owned_.store(false, std::memory_order_release); }
+
+        const SizeClassCounters& operator[](size_t sizeClass) const noexcept { return sizeClasses_[sizeClass]; }
+        void Reset() noexcept;
+
+        ThreadAllocations* next() const noexcept { return next_; }
+        void setNext(ThreadAllocations* next) noexcept { next_ = next; }
+
+    private:
+        SizeClassCounters sizeClasses_[kSizeClassCount];
+        std::atomic<bool> owned_{true};
+        // Only written before the counters are published.
+        ThreadAllocations* next_ = nullptr;
+    };
+
+    constexpr MemoryStatistics() noexcept = default;
+
+    void RecordAllocationSlowPath(size_t sizeClass, size_t size) noexcept;
+    static void ReleaseThreadAllocations(void* allocations) noexcept;
+
+    static MemoryStatistics instance_;
+    static THREAD_LOCAL_VARIABLE ThreadAllocations* currentAllocations_;
+    static THREAD_LOCAL_VARIABLE bool threadExited_;
+
+    std::atomic<ThreadAllocations*> threadAllocations_{nullptr};
+    // Allocations of the threads after their thread exit callbacks.
+    SizeClassCounters exitedThreadAllocations_[kSizeClassCount];
+    std::atomic<uint64_t> gcCount_{0};
+    std::atomic<uint64_t> gcPauseMicroseconds_{0};
+    std::atomic<uint64_t> gcMaxPauseMicroseconds_{0};
+    std::atomic<uint64_t> gcPauses_[kPauseBucketCount] = {};
+    std::atomic<uint64_t> minorGcCount_{0};
+    std::atomic<uint64_t> minorGcPauseMicroseconds_{0};
+    std::atomic<uint64_t> minorGcMaxPauseMicroseconds_{0};
+    std::atomic<uint64_t> minorGcFreedBytes_{0};
+    std::atomic<uint64_t> minorGcPromotedBytes_{0};
+    std::atomic<uint64_t> collectedCycles_{0};
+    std::atomic<uint64_t> finalizerQueueLength_{0};
+    std::atomic<uint64_t> finalizerQueueMaxLength_{0};
+    std::atomic<int64_t> stableRefs_{0};
+    std::atomic<uint64_t> frozenBytes_{0};
+    SpinLock dumpOnExitPathLock_;
+    char* dumpOnExitPath_ = nullptr;
+};
+
+} // namespace kotlin
+
+#endif // RUNTIME_MEMORY_STATISTICS_H
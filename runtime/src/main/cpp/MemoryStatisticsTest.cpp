@@ -0,0 +1,129 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "MemoryStatistics.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "TestSupport.hpp"
+
+using namespace kotlin;
+
+TEST(MemoryStatisticsTest, SizeClass) {
+    EXPECT_THAT(MemoryStatistics::SizeClass(0), 0);
+    EXPECT_THAT(MemoryStatistics::SizeClass(16), 0);
+    EXPECT_THAT(MemoryStatistics::SizeClass(17), 1);
+    EXPECT_THAT(MemoryStatistics::SizeClass(32), 1);
+    EXPECT_THAT(MemoryStatistics::SizeClass(1024), 6);
+    EXPECT_THAT(MemoryStatistics::SizeClass(1024 * 1024), MemoryStatistics::kSizeClassCount - 2);
+    EXPECT_THAT(MemoryStatistics::SizeClass(1024 * 1024 + 1), MemoryStatistics::kSizeClassCount - 1);
+    EXPECT_THAT(MemoryStatistics::SizeClass(static_cast<size_t>(-1)), MemoryStatistics::kSizeClassCount - 1);
+}
+
+TEST(MemoryStatisticsTest, PauseBucket) {
+    EXPECT_THAT(MemoryStatistics::PauseBucket(0), 0);
+    EXPECT_THAT(MemoryStatistics::PauseBucket(1), 1);
+    EXPECT_THAT(MemoryStatistics::PauseBucket(3), 2);
+    EXPECT_THAT(MemoryStatistics::PauseBucket(4), 3);
+    EXPECT_THAT(MemoryStatistics::PauseBucket(static_cast<uint64_t>(-1)), MemoryStatistics::kPauseBucketCount - 1);
+}
+
+TEST(MemoryStatisticsTest, Counters) {
+    auto& statistics = MemoryStatistics::Instance();
+    statistics.ResetForTests();
+
+    statistics.RecordAllocation(8);
+    statistics.RecordAllocation(24);
+    statistics.RecordAllocation(32);
+    statistics.RecordGc(10);
+    statistics.RecordGc(1000);
+    statistics.RecordMinorGc(20, 300, 40);
+    statistics.RecordMinorGc(5, 100, 0);
+    statistics.RecordCollectedCycles(3);
+    statistics.RecordFinalizerQueueLength(5);
+    statistics.RecordFinalizerQueueLength(2);
+    statistics.RecordStableRefCreated();
+    statistics.RecordStableRefCreated();
+    statistics.RecordStableRefDisposed();
+    statistics.RecordFrozen(100);
+
+    EXPECT_THAT(statistics.allocationCount(0), 1);
+    EXPECT_THAT(statistics.allocatedBytes(0), 8);
+    EXPECT_THAT(statistics.allocationCount(1), 2);
+    EXPECT_THAT(statistics.allocatedBytes(1), 56);
+    EXPECT_THAT(statistics.gcCount(), 2);
+    EXPECT_THAT(statistics.gcPauseMicroseconds(), 1010);
+    EXPECT_THAT(statistics.gcMaxPauseMicroseconds(), 1000);
+    EXPECT_THAT(statistics.gcPauseCount(MemoryStatistics::PauseBucket(10)), 1);
+    EXPECT_THAT(statistics.gcPauseCount(MemoryStatistics::PauseBucket(1000)), 1);
+    EXPECT_THAT(statistics.minorGcCount(), 2);
+    EXPECT_THAT(statistics.minorGcPauseMicroseconds(), 25);
+    EXPECT_THAT(statistics.minorGcMaxPauseMicroseconds(), 20);
+    EXPECT_THAT(statistics.minorGcFreedBytes(), 400);
+    EXPECT_THAT(statistics.minorGcPromotedBytes(), 40);
+    EXPECT_THAT(statistics.collectedCycles(), 3);
+    EXPECT_THAT(statistics.finalizerQueueLength(), 2);
+    EXPECT_THAT(statistics.finalizerQueueMaxLength(), 5);
+    EXPECT_THAT(statistics.stableRefs(), 1);
+    EXPECT_THAT(statistics.frozenBytes(), 100);
+
+    statistics.ResetForTests();
+}
+
+TEST(MemoryStatisticsTest, Json) {
+    auto& statistics = MemoryStatistics::Instance();
+    statistics.ResetForTests();
+    statistics.RecordAllocation(2 * 1024 * 1024);
+    statistics.RecordGc(0);
+    statistics.RecordStableRefDisposed();
+
+    KStdString out;
+    statistics.WriteJson(out);
+    std::string json(out.begin(), out.end());
+
+    EXPECT_THAT(json, testing::StartsWith("{\"allocations\":[{\"maxSize\":16,\"count\":0,\"bytes\":0},"));
+    EXPECT_THAT(json, testing::HasSubstr("{\"maxSize\":null,\"count\":1,\"bytes\":2097152}]"));
+    EXPECT_THAT(json, testing::HasSubstr("\"gc\":{\"count\":1,\"pauseMicroseconds\":0,\"maxPauseMicroseconds\":0,"
+                                         "\"pauses\":[{\"lessThanMicroseconds\":1,\"count\":1},"));
+    EXPECT_THAT(json, testing::HasSubstr("{\"lessThanMicroseconds\":null,\"count\":0}]},\"minorGc\":{\"count\":0,"
+                                         "\"pauseMicroseconds\":0,\"maxPauseMicroseconds\":0,\"freedBytes\":0,\"promotedBytes\":0},"));
+    EXPECT_THAT(json, testing::EndsWith(
+            "\"collectedCycles\":0,\"finalizerQueue\":{\"length\":0,\"maxLength\":0},\"stableRefs\":-1,\"frozenBytes\":0}"));
+
+    statistics.ResetForTests();
+}
+
+TEST(MemoryStatisticsTest, AllocationsOnThreads) {
+    constexpr int kThreadCount = kDefaultThreadCount;
+    constexpr int kAllocationCount = 1000;
+    auto& statistics = MemoryStatistics::Instance();
+    statistics.ResetForTests();
+
+    // Twice, so that the second threads reuse the counters of the exited ones.
+    for (int round = 0; round < 2; ++round) {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < kThreadCount; ++i) {
+            threads.emplace_back([&statistics]() {
+                for (int j = 0; j < kAllocationCount; ++j) {
+                    statistics.RecordAllocation(8);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    statistics.RecordAllocation(8);
+
+    EXPECT_THAT(statistics.allocationCount(0), 2 * kThreadCount * kAllocationCount + 1);
+    EXPECT_THAT(statistics.allocatedBytes(0), 8 * (2 * kThreadCount * kAllocationCount + 1));
+
+    statistics.ResetForTests();
+}
@@ -60,6 +60,34 @@ public:
             deletionQueue_.push_back(node);
         }
 
+        // Inserts `count` values, storing their nodes into `nodes`. The nodes are built aside and spliced into the
+        // queue at once.
+        void Insert(const T* values, size_t count, Node** nodes) noexcept {
+            KStdList<Node> batch;
+            for (size_t i = 0; i < count; ++i) {
+                batch.emplace_back(values[i], this);
+                auto& node = batch.back();
+                // Stays valid after the splice.
+                node.position_ = std::prev(batch.end());
+                nodes[i] = &node;
+            }
+            queue_.splice(queue_.end(), batch);
+        }
+
+        // Erases `count` nodes, queueing the ones owned elsewhere for deletion at once.
+        void Erase(Node* const* nodes, size_t count) noexcept {
+            KStdList<Node*> deletions;
+            for (size_t i = 0; i < count; ++i) {
+                Node* node = nodes[i];
+                if (node->owner_ == this) {
+                    queue_.erase(node->position_);
+                } else {
+                    deletions.push_back(node);
+                }
+            }
+            deletionQueue_.splice(deletionQueue_.end(), deletions);
+        }
+
         // Merge `this` queue with owning `MultiSourceQueue`. `this` will have empty queue after the call.
         // This call is performed without heap allocations. TODO: Test that no allocations are happening.
         void Publish() noexcept {
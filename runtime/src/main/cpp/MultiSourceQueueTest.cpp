@@ -115,6 +115,47 @@ TEST(MultiSourceQueueTest, EraseFromOtherProducer) {
     EXPECT_THAT(actual4, testing::ElementsAre(kFirst));
 }
 
+TEST(MultiSourceQueueTest, InsertSeveral) {
+    IntQueue queue;
+    IntQueue::Producer producer(queue);
+
+    constexpr int kValues[] = {1, 2, 3};
+    IntQueue::Node* nodes[3];
+
+    producer.Insert(kValues, 3, nodes);
+    producer.Publish();
+
+    EXPECT_THAT(**nodes[0], 1);
+    EXPECT_THAT(**nodes[2], 3);
+    auto actual = Collect(queue);
+    EXPECT_THAT(actual, testing::ElementsAre(1, 2, 3));
+}
+
+TEST(MultiSourceQueueTest, EraseSeveral) {
+    IntQueue queue;
+    IntQueue::Producer producer1(queue);
+    IntQueue::Producer producer2(queue);
+
+    constexpr int kValues[] = {1, 2, 3, 4};
+    IntQueue::Node* nodes[4];
+
+    producer1.Insert(kValues, 2, nodes);
+    producer1.Publish();
+    producer2.Insert(kValues + 2, 2, nodes + 2);
+    // The first two are owned by the global queue, the last two by `producer2` itself.
+    IntQueue::Node* erased[] = {nodes[0], nodes[2], nodes[3]};
+    producer2.Erase(erased, 3);
+    producer2.Publish();
+
+    auto actual1 = Collect(queue);
+    EXPECT_THAT(actual1, testing::ElementsAre(1, 2));
+
+    queue.ApplyDeletions();
+
+    auto actual2 = Collect(queue);
+    EXPECT_THAT(actual2, testing::ElementsAre(2));
+}
+
 TEST(MultiSourceQueueTest, Empty) {
     IntQueue queue;
 
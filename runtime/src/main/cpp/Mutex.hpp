@@ -18,17 +18,49 @@
 #define RUNTIME_MUTEX_H
 
 #include <cstdint>
+#if !KONAN_NO_THREADS
+#include <sched.h>
+#endif
 
 #include "KAssert.h"
 #include "Utils.hpp"
 
 namespace kotlin {
 
+// Backs off between the iterations of a spin loop: pauses the CPU for the first ones and then yields the thread.
+class SpinBackoff : private Pinned {
+public:
+    void Wait() noexcept {
+        if (iteration_ < kPauseIterations) {
+            ++iteration_;
+            Pause();
+        } else {
+#if !KONAN_NO_THREADS
+            sched_yield();
+#endif
+        }
+    }
+
+private:
+    static constexpr uint32_t kPauseIterations = 64;
+
+    static void Pause() noexcept {
+#if defined(__i386__) || defined(__x86_64__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    uint32_t iteration_ = 0;
+};
+
 class SpinLock : private Pinned {
 public:
     void lock() noexcept {
+        SpinBackoff backoff;
         while (!__sync_bool_compare_and_swap(&atomicInt, 0, 1)) {
-            // TODO: yield.
+            backoff.Wait();
         }
     }
 
@@ -23,6 +23,7 @@
 
 #include "KAssert.h"
 #include "Exceptions.h"
+#include "IdentityHash.hpp"
 #include "Memory.h"
 #include "Natives.h"
 #include "Types.h"
@@ -35,9 +36,7 @@ KBoolean Kotlin_Any_equals(KConstRef thiz, KConstRef other) {
 }
 
 KInt Kotlin_Any_hashCode(KConstRef thiz) {
-  // Here we will use different mechanism for stable hashcode, using meta-objects
-  // if moving collector will be used.
-  return reinterpret_cast<uintptr_t>(thiz);
+  return kotlin::IdentityHashCode(const_cast<ObjHeader*>(thiz));
 }
 
 OBJ_GETTER(Kotlin_getStackTraceStrings, KConstRef stackTrace) {
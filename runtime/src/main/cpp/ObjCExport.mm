@@ -16,6 +16,7 @@
 
 #import "Types.h"
 #import "Memory.h"
+#include "KString.h"
 #include "Natives.h"
 #include "ObjCInterop.h"
 
@@ -155,9 +156,14 @@ extern "C" id Kotlin_ObjCExport_CreateNSStringFromKString(ObjHeader* str) {
         freeWhenDone:NO] autorelease];
   } else {
     // TODO: consider making NSString subclass to avoid copying here.
-    NSString* candidate = [[NSString alloc] initWithBytes:utf16Chars
-      length:numBytes
-      encoding:NSUTF16LittleEndianStringEncoding];
+    // Compact strings are never permanent, so they only take this branch.
+    NSString* candidate = IsLatin1String(str->array()) ?
+      [[NSString alloc] initWithBytes:Latin1StringAddressOfElementAt(str->array(), 0)
+        length:StringLength(str->array())
+        encoding:NSISOLatin1StringEncoding] :
+      [[NSString alloc] initWithBytes:utf16Chars
+        length:numBytes
+        encoding:NSUTF16LittleEndianStringEncoding];
 
     if (!isShareable(str)) {
       SetAssociatedObject(str, candidate);
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_OBJECT_TRAVERSAL_H
+#define RUNTIME_OBJECT_TRAVERSAL_H
+
+#include <cstdint>
+
+#include "Memory.h"
+#include "Natives.h"
+#include "Types.h"
+
+namespace kotlin {
+
+// Calls `process(index, location)` for each reference field of `object`: `index` is the index in `TypeInfo::objOffsets_`
+// for objects and the element index for arrays of references. Arrays of primitives have no reference fields.
+template <typename F>
+void TraverseReferenceFields(const ObjHeader* object, F process) noexcept {
+    const TypeInfo* typeInfo = object->type_info();
+    if (typeInfo == theArrayTypeInfo) {
+        const ArrayHeader* array = object->array();
+        for (uint32_t index = 0; index < array->count_; ++index) {
+            process(index, ArrayAddressOfElementAt(array, index));
+        }
+    } else {
+        for (int32_t index = 0; index < typeInfo->objOffsetsCount_; ++index) {
+            auto* location = reinterpret_cast<ObjHeader* const*>(reinterpret_cast<uintptr_t>(object) + typeInfo->objOffsets_[index]);
+            process(static_cast<uint32_t>(index), location);
+        }
+    }
+}
+
+} // namespace kotlin
+
+#endif // RUNTIME_OBJECT_TRAVERSAL_H
@@ -176,6 +176,38 @@ void consoleFlush() {
   ::fflush(stderr);
 }
 
+// File operations.
+void* fileOpenForWrite(const char* path) {
+#if KONAN_WASM || KONAN_ZEPHYR
+  return nullptr;
+#else
+  return ::fopen(path, "wb");
+#endif
+}
+
+bool fileWrite(void* file, const void* data, size_t size) {
+#if KONAN_WASM || KONAN_ZEPHYR
+  return false;
+#else
+  return ::fwrite(data, 1, size, reinterpret_cast<FILE*>(file)) == size;
+#endif
+}
+
+bool fileClose(void* file) {
+#if KONAN_WASM || KONAN_ZEPHYR
+  return false;
+#else
+  return ::fclose(reinterpret_cast<FILE*>(file)) == 0;
+#endif
+}
+
+bool writeFile(const char* path, const void* data, size_t size) {
+  void* file = fileOpenForWrite(path);
+  if (file == nullptr) return false;
+  bool written = fileWrite(file, data, size);
+  return fileClose(file) && written;
+}
+
 // Thread execution.
 #if !KONAN_NO_THREADS
 
@@ -289,10 +321,17 @@ size_t strnlen(const char* buffer, size_t maxSize) {
 // Memory operations.
 #if KONAN_INTERNAL_DLMALLOC
 extern "C" void* dlcalloc(size_t, size_t);
+extern "C" void* dlmalloc(size_t);
 extern "C" void dlfree(void*);
 #define calloc_impl dlcalloc
 #define free_impl dlfree
 #define calloc_aligned_impl(count, size, alignment) dlcalloc(count, size)
+#define init_object_heap_impl()
+#define deinit_object_heap_impl()
+#define calloc_object_impl dlcalloc
+#define malloc_object_impl dlmalloc
+#define calloc_object_aligned_impl(count, size, alignment) dlcalloc(count, size)
+#define is_local_object_impl(pointer) true
 
 #else
 extern "C" void* konan_calloc_impl(size_t, size_t);
@@ -301,6 +340,18 @@ extern "C" void* konan_calloc_aligned_impl(size_t count, size_t size, size_t ali
 #define calloc_impl konan_calloc_impl
 #define free_impl konan_free_impl
 #define calloc_aligned_impl konan_calloc_aligned_impl
+extern "C" void konan_init_object_heap_impl();
+extern "C" void konan_deinit_object_heap_impl();
+extern "C" void* konan_calloc_object_impl(size_t count, size_t size);
+extern "C" void* konan_malloc_object_impl(size_t size);
+extern "C" void* konan_calloc_object_aligned_impl(size_t count, size_t size, size_t alignment);
+extern "C" bool konan_is_local_object_impl(void* pointer);
+#define init_object_heap_impl konan_init_object_heap_impl
+#define deinit_object_heap_impl konan_deinit_object_heap_impl
+#define calloc_object_impl konan_calloc_object_impl
+#define malloc_object_impl konan_malloc_object_impl
+#define calloc_object_aligned_impl konan_calloc_object_aligned_impl
+#define is_local_object_impl konan_is_local_object_impl
 #endif
 
 void* calloc(size_t count, size_t size) {
@@ -315,6 +366,30 @@ void free(void* pointer) {
   free_impl(pointer);
 }
 
+void init_object_heap() {
+  init_object_heap_impl();
+}
+
+void deinit_object_heap() {
+  deinit_object_heap_impl();
+}
+
+void* calloc_object(size_t count, size_t size) {
+  return calloc_object_impl(count, size);
+}
+
+void* malloc_object(size_t size) {
+  return malloc_object_impl(size);
+}
+
+void* calloc_object_aligned(size_t count, size_t size, size_t alignment) {
+  return calloc_object_aligned_impl(count, size, alignment);
+}
+
+bool is_local_object(void* pointer) {
+  return is_local_object_impl(pointer);
+}
+
 #if KONAN_INTERNAL_NOW
 
 #ifdef KONAN_ZEPHYR
@@ -35,6 +35,16 @@ void consoleErrorUtf8(const void* utf8, uint32_t sizeBytes);
 int32_t consoleReadUtf8(void* utf8, uint32_t maxSizeBytes);
 void consoleFlush();
 
+// File operations.
+// Opens the file at `path` for writing, replacing its content. Returns nullptr if the file couldn't be opened,
+// which is always the case on targets without a file system.
+void* fileOpenForWrite(const char* path);
+bool fileWrite(void* file, const void* data, size_t size);
+// Returns false if the buffered data couldn't be written.
+bool fileClose(void* file);
+// Replaces the content of the file at `path`. Returns false if the file couldn't be written.
+bool writeFile(const char* path, const void* data, size_t size);
+
 // Process control.
 RUNTIME_NORETURN void abort(void);
 RUNTIME_NORETURN void exit(int32_t status);
@@ -81,6 +91,17 @@ void *memset(void *b, int c, size_t len);
 void* calloc(size_t count, size_t size);
 void* calloc_aligned(size_t count, size_t size, size_t alignment);
 void free(void* ptr);
+// Kotlin objects of the current thread are allocated from a dedicated heap between `init_object_heap`
+// and `deinit_object_heap`, if the allocator supports it, and from the common heap otherwise.
+// They are freed with `free` from any thread.
+void init_object_heap();
+void deinit_object_heap();
+void* calloc_object(size_t count, size_t size);
+// Same as `calloc_object`, but the memory is not zeroed.
+void* malloc_object(size_t size);
+void* calloc_object_aligned(size_t count, size_t size, size_t alignment);
+// Whether `ptr` was allocated with `calloc_object` from the heap of the current thread.
+bool is_local_object(void* ptr);
 
 // Time operations.
 uint64_t getTimeMillis();
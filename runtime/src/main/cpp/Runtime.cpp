@@ -20,6 +20,7 @@
 #include "Exceptions.h"
 #include "KAssert.h"
 #include "Memory.h"
+#include "MemoryStatistics.hpp"
 #include "ObjCExportInit.h"
 #include "Porting.h"
 #include "Runtime.h"
@@ -202,6 +203,8 @@ void Kotlin_shutdownRuntime() {
     auto* runtime = ::runtimeState;
     RuntimeAssert(runtime != kInvalidRuntime, "Current thread must have Kotlin runtime initialized on it");
 
+    kotlin::MemoryStatistics::Instance().DumpOnExitIfRequested();
+
     bool needsFullShutdown = false;
     switch (Kotlin_getDestroyRuntimeMode()) {
         case DESTROY_RUNTIME_LEGACY:
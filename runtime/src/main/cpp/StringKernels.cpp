@@ -0,0 +1,245 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "StringKernels.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "UnicodeTables.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+// Compiles to SSE2 or NEON where available, and to scalar code elsewhere.
+typedef uint16_t __attribute__((__vector_size__(16))) CharVector;
+
+constexpr size_t kVectorLength = sizeof(CharVector) / sizeof(KChar);
+
+inline CharVector Load(const KChar* chars) noexcept {
+    CharVector result;
+    memcpy(&result, chars, sizeof(result));
+    return result;
+}
+
+inline void Store(KChar* chars, CharVector vector) noexcept {
+    memcpy(chars, &vector, sizeof(vector));
+}
+
+inline CharVector Splat(KChar ch) noexcept {
+    CharVector result = {ch, ch, ch, ch, ch, ch, ch, ch};
+    return result;
+}
+
+inline bool Any(CharVector vector) noexcept {
+    uint64_t words[2];
+    memcpy(words, &vector, sizeof(words));
+    return (words[0] | words[1]) != 0;
+}
+
+// Index of the first non-zero lane. `vector` must have one.
+inline size_t FirstNonZero(CharVector vector) noexcept {
+    KChar lanes[kVectorLength];
+    Store(lanes, vector);
+    size_t index = 0;
+    while (lanes[index] == 0) ++index;
+    return index;
+}
+
+inline bool IsAscii(CharVector vector) noexcept {
+    return !Any(vector & Splat(0xFF80));
+}
+
+// All ones in the lanes with chars in [first, last].
+inline CharVector InRange(CharVector vector, KChar first, KChar last) noexcept {
+    return reinterpret_cast<CharVector>(vector - Splat(first) <= Splat(last - first));
+}
+
+// Case conversion of ASCII lanes.
+inline CharVector AsciiToUpperCase(CharVector vector) noexcept {
+    return vector - (InRange(vector, 'a', 'z') & Splat('a' - 'A'));
+}
+
+inline CharVector AsciiToLowerCase(CharVector vector) noexcept {
+    return vector + (InRange(vector, 'A', 'Z') & Splat('a' - 'A'));
+}
+
+// `mask ? ifTrue : ifFalse` for each lane.
+inline CharVector Select(CharVector mask, CharVector ifTrue, CharVector ifFalse) noexcept {
+    return (mask & ifTrue) | (~mask & ifFalse);
+}
+
+template <KChar (*Convert)(KChar), CharVector (*AsciiConvert)(CharVector)>
+size_t FindCaseChange(const KChar* chars, size_t count) noexcept {
+    size_t index = 0;
+    for (; index + kVectorLength <= count; index += kVectorLength) {
+        CharVector vector = Load(chars + index);
+        if (!IsAscii(vector)) {
+            for (size_t i = index; i < index + kVectorLength; ++i) {
+                if (Convert(chars[i]) != chars[i]) return i;
+            }
+            continue;
+        }
+        CharVector changed = AsciiConvert(vector) ^ vector;
+        if (Any(changed)) return index + FirstNonZero(changed);
+    }
+    for (; index < count; ++index) {
+        if (Convert(chars[index]) != chars[index]) return index;
+    }
+    return count;
+}
+
+template <KChar (*Convert)(KChar), CharVector (*AsciiConvert)(CharVector)>
+void ConvertCase(const KChar* from, size_t count, KChar* to) noexcept {
+    size_t index = 0;
+    for (; index + kVectorLength <= count; index += kVectorLength) {
+        CharVector vector = Load(from + index);
+        if (IsAscii(vector)) {
+            Store(to + index, AsciiConvert(vector));
+        } else {
+            for (size_t i = index; i < index + kVectorLength; ++i) {
+                to[i] = Convert(from[i]);
+            }
+        }
+    }
+    for (; index < count; ++index) {
+        to[index] = Convert(from[index]);
+    }
+}
+
+} // namespace
+
+size_t kotlin::FindUpperCaseChange(const KChar* chars, size_t count) noexcept {
+    return FindCaseChange<GetUpperCase, AsciiToUpperCase>(chars, count);
+}
+
+size_t kotlin::FindLowerCaseChange(const KChar* chars, size_t count) noexcept {
+    return FindCaseChange<GetLowerCase, AsciiToLowerCase>(chars, count);
+}
+
+void kotlin::ToUpperCase(const KChar* from, size_t count, KChar* to) noexcept {
+    ConvertCase<GetUpperCase, AsciiToUpperCase>(from, count, to);
+}
+
+void kotlin::ToLowerCase(const KChar* from, size_t count, KChar* to) noexcept {
+    ConvertCase<GetLowerCase, AsciiToLowerCase>(from, count, to);
+}
+
+size_t kotlin::FindMismatchIgnoreCase(const KChar* first, const KChar* second, size_t count) noexcept {
+    size_t index = 0;
+    for (; index + kVectorLength <= count; index += kVectorLength) {
+        CharVector firstVector = Load(first + index);
+        CharVector secondVector = Load(second + index);
+        CharVector different = firstVector ^ secondVector;
+        if (!Any(different)) continue;
+        // Non-ASCII chars can be equal to ASCII ones after conversion, like KELVIN SIGN and 'k'.
+        if (!IsAscii(firstVector | secondVector)) {
+            for (size_t i = index; i < index + kVectorLength; ++i) {
+                if (first[i] != second[i] && GetLowerCase(first[i]) != GetLowerCase(second[i])) return i;
+            }
+            continue;
+        }
+        different = AsciiToLowerCase(firstVector) ^ AsciiToLowerCase(secondVector);
+        if (Any(different)) return index + FirstNonZero(different);
+    }
+    for (; index < count; ++index) {
+        if (first[index] != second[index] && GetLowerCase(first[index]) != GetLowerCase(second[index])) return index;
+    }
+    return count;
+}
+
+size_t kotlin::FindChar(const KChar* chars, size_t count, KChar ch, bool ignoreCase) noexcept {
+    size_t index = 0;
+    if (!ignoreCase) {
+        CharVector needle = Splat(ch);
+        for (; index + kVectorLength <= count; index += kVectorLength) {
+            CharVector found = reinterpret_cast<CharVector>(Load(chars + index) == needle);
+            if (Any(found)) return index + FirstNonZero(found);
+        }
+        for (; index < count; ++index) {
+            if (chars[index] == ch) return index;
+        }
+        return count;
+    }
+
+    KChar lowerCh = GetLowerCase(ch);
+    CharVector needle = Splat(lowerCh);
+    for (; index + kVectorLength <= count; index += kVectorLength) {
+        CharVector vector = Load(chars + index);
+        if (!IsAscii(vector)) {
+            for (size_t i = index; i < index + kVectorLength; ++i) {
+                if (GetLowerCase(chars[i]) == lowerCh) return i;
+            }
+            continue;
+        }
+        CharVector found = reinterpret_cast<CharVector>(AsciiToLowerCase(vector) == needle);
+        if (Any(found)) return index + FirstNonZero(found);
+    }
+    for (; index < count; ++index) {
+        if (GetLowerCase(chars[index]) == lowerCh) return index;
+    }
+    return count;
+}
+
+void kotlin::ReplaceChar(const KChar* from, size_t count, KChar* to, KChar oldChar, KChar newChar, bool ignoreCase) noexcept {
+    size_t index = 0;
+    CharVector replacement = Splat(newChar);
+    if (!ignoreCase) {
+        CharVector needle = Splat(oldChar);
+        for (; index + kVectorLength <= count; index += kVectorLength) {
+            CharVector vector = Load(from + index);
+            CharVector found = reinterpret_cast<CharVector>(vector == needle);
+            Store(to + index, Select(found, replacement, vector));
+        }
+        for (; index < count; ++index) {
+            to[index] = from[index] == oldChar ? newChar : from[index];
+        }
+        return;
+    }
+
+    KChar oldCharLower = GetLowerCase(oldChar);
+    CharVector needle = Splat(oldCharLower);
+    for (; index + kVectorLength <= count; index += kVectorLength) {
+        CharVector vector = Load(from + index);
+        if (IsAscii(vector)) {
+            CharVector found = reinterpret_cast<CharVector>(AsciiToLowerCase(vector) == needle);
+            Store(to + index, Select(found, replacement, vector));
+        } else {
+            for (size_t i = index; i < index + kVectorLength; ++i) {
+                to[i] = GetLowerCase(from[i]) == oldCharLower ? newChar : from[i];
+            }
+        }
+    }
+    for (; index < count; ++index) {
+        to[index] = GetLowerCase(from[index]) == oldCharLower ? newChar : from[index];
+    }
+}
+
+bool kotlin::IsLatin1(const KChar* chars, size_t count) noexcept {
+    size_t index = 0;
+    CharVector highBytes = Splat(0);
+    for (; index + kVectorLength <= count; index += kVectorLength) {
+        highBytes |= Load(chars + index) & Splat(0xFF00);
+    }
+    if (Any(highBytes)) return false;
+    for (; index < count; ++index) {
+        if (chars[index] > 0xFF) return false;
+    }
+    return true;
+}
+
+// Plain loops are vectorized by the compiler into pack and unpack instructions.
+void kotlin::CompressToLatin1(const KChar* from, size_t count, uint8_t* to) noexcept {
+    for (size_t index = 0; index < count; ++index) {
+        to[index] = static_cast<uint8_t>(from[index]);
+    }
+}
+
+void kotlin::InflateLatin1(const uint8_t* from, size_t count, KChar* to) noexcept {
+    for (size_t index = 0; index < count; ++index) {
+        to[index] = from[index];
+    }
+}
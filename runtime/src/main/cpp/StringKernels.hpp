@@ -0,0 +1,47 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_STRING_KERNELS_H
+#define RUNTIME_STRING_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Types.h"
+
+namespace kotlin {
+
+// Char-by-char string transformations. Blocks of ASCII chars are processed several chars per step,
+// other chars go through the Unicode tables.
+//
+// `Find*` functions return the index of the first matching char, or `count` if there is none, so that callers
+// can return the original string when nothing changes.
+
+// First char that is changed by upper (lower) case conversion.
+size_t FindUpperCaseChange(const KChar* chars, size_t count) noexcept;
+size_t FindLowerCaseChange(const KChar* chars, size_t count) noexcept;
+
+void ToUpperCase(const KChar* from, size_t count, KChar* to) noexcept;
+void ToLowerCase(const KChar* from, size_t count, KChar* to) noexcept;
+
+// First position at which the chars differ after lower case conversion.
+size_t FindMismatchIgnoreCase(const KChar* first, const KChar* second, size_t count) noexcept;
+
+// First occurrence of `ch`. With `ignoreCase` chars are compared after lower case conversion.
+size_t FindChar(const KChar* chars, size_t count, KChar ch, bool ignoreCase) noexcept;
+
+// Copies `from` to `to` replacing each occurrence of `oldChar` with `newChar`.
+void ReplaceChar(const KChar* from, size_t count, KChar* to, KChar oldChar, KChar newChar, bool ignoreCase) noexcept;
+
+// Whether all chars are in the Latin-1 range and so can be stored one byte per char.
+bool IsLatin1(const KChar* chars, size_t count) noexcept;
+
+// Conversions between UTF-16 and Latin-1. `CompressToLatin1` requires `IsLatin1(from, count)`.
+void CompressToLatin1(const KChar* from, size_t count, uint8_t* to) noexcept;
+void InflateLatin1(const uint8_t* from, size_t count, KChar* to) noexcept;
+
+} // namespace kotlin
+
+#endif // RUNTIME_STRING_KERNELS_H
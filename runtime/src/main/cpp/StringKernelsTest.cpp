@@ -0,0 +1,187 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "StringKernels.hpp"
+
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+#include "UnicodeTables.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+using KCharString = std::basic_string<KChar>;
+
+KCharString FromAscii(const char* ascii) {
+    return KCharString(ascii, ascii + strlen(ascii));
+}
+
+KCharString UpperCase(const KCharString& string) {
+    KCharString result(string.size(), 0);
+    ToUpperCase(string.data(), string.size(), &result[0]);
+    return result;
+}
+
+KCharString LowerCase(const KCharString& string) {
+    KCharString result(string.size(), 0);
+    ToLowerCase(string.data(), string.size(), &result[0]);
+    return result;
+}
+
+KCharString Replace(const KCharString& string, KChar oldChar, KChar newChar, bool ignoreCase) {
+    KCharString result(string.size(), 0);
+    ReplaceChar(string.data(), string.size(), &result[0], oldChar, newChar, ignoreCase);
+    return result;
+}
+
+// Mostly ASCII with occasional Latin-1, Cyrillic and special case chars, to hit all paths of the kernels.
+KCharString RandomString(std::mt19937& random, size_t length) {
+    static const KChar kSpecialChars[] = {0x00B5, 0x00DF, 0x00FF, 0x0130, 0x0131, 0x0410, 0x0436, 0x212A, 0x2126, 0xFF41};
+    KCharString result;
+    for (size_t i = 0; i < length; ++i) {
+        if (random() % 16 == 0) {
+            result.push_back(kSpecialChars[random() % (sizeof(kSpecialChars) / sizeof(kSpecialChars[0]))]);
+        } else {
+            result.push_back(static_cast<KChar>(random() % 128));
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(StringKernelsTest, CaseConversion) {
+    auto string = FromAscii("Hello, World! 0123456789 abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ @[`{");
+    EXPECT_THAT(UpperCase(string), FromAscii("HELLO, WORLD! 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ ABCDEFGHIJKLMNOPQRSTUVWXYZ @[`{"));
+    EXPECT_THAT(LowerCase(string), FromAscii("hello, world! 0123456789 abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz @[`{"));
+
+    KCharString cyrillic = {0x041F, 0x0440, 0x0438, 0x0432, 0x0435, 0x0442, ' ', 'm', 'i', 'r', 0x0451, 'x'};
+    EXPECT_THAT(UpperCase(cyrillic), (KCharString{0x041F, 0x0420, 0x0418, 0x0412, 0x0415, 0x0422, ' ', 'M', 'I', 'R', 0x0401, 'X'}));
+    EXPECT_THAT(LowerCase(cyrillic), (KCharString{0x043F, 0x0440, 0x0438, 0x0432, 0x0435, 0x0442, ' ', 'm', 'i', 'r', 0x0451, 'x'}));
+}
+
+TEST(StringKernelsTest, FindCaseChange) {
+    auto upper = FromAscii("ALREADY UPPER CASE, NOTHING TO DO");
+    EXPECT_THAT(FindUpperCaseChange(upper.data(), upper.size()), upper.size());
+    EXPECT_THAT(FindLowerCaseChange(upper.data(), upper.size()), 0);
+    auto lower = FromAscii("already lower case, nothing to do 123");
+    EXPECT_THAT(FindLowerCaseChange(lower.data(), lower.size()), lower.size());
+    EXPECT_THAT(FindUpperCaseChange(lower.data(), lower.size()), 0);
+    auto mixed = FromAscii("0123456789ABCDEFGHIj");
+    EXPECT_THAT(FindUpperCaseChange(mixed.data(), mixed.size()), 19);
+    EXPECT_THAT(FindLowerCaseChange(mixed.data(), mixed.size()), 10);
+    EXPECT_THAT(FindUpperCaseChange(mixed.data(), 0), 0);
+}
+
+TEST(StringKernelsTest, FindMismatchIgnoreCase) {
+    auto first = FromAscii("The Quick Brown Fox Jumps Over The Lazy Dog");
+    auto second = FromAscii("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG");
+    EXPECT_THAT(FindMismatchIgnoreCase(first.data(), second.data(), first.size()), first.size());
+    second[40] = 'X';
+    EXPECT_THAT(FindMismatchIgnoreCase(first.data(), second.data(), first.size()), 40);
+    // '@' and '`' differ from 'A' and 'a' by the case bit but are not letters.
+    auto at = FromAscii("0123456789@");
+    auto backtick = FromAscii("0123456789`");
+    EXPECT_THAT(FindMismatchIgnoreCase(at.data(), backtick.data(), at.size()), 10);
+
+    // KELVIN SIGN is 'k' in lower case.
+    KCharString kelvin = {'0', '1', '2', '3', '4', '5', '6', '7', 0x212A, 'm'};
+    auto k = FromAscii("01234567KM");
+    EXPECT_THAT(FindMismatchIgnoreCase(kelvin.data(), k.data(), k.size()), k.size());
+}
+
+TEST(StringKernelsTest, FindChar) {
+    auto string = FromAscii("abcdefghijklmnopqrstuvwxyzABC");
+    EXPECT_THAT(FindChar(string.data(), string.size(), 'z', false), 25);
+    EXPECT_THAT(FindChar(string.data(), string.size(), 'C', false), 28);
+    EXPECT_THAT(FindChar(string.data(), string.size(), 'C', true), 2);
+    EXPECT_THAT(FindChar(string.data(), string.size(), '!', true), string.size());
+
+    KCharString kelvin = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 0x212A};
+    EXPECT_THAT(FindChar(kelvin.data(), kelvin.size(), 'K', true), 8);
+    EXPECT_THAT(FindChar(kelvin.data(), kelvin.size(), 'K', false), kelvin.size());
+}
+
+TEST(StringKernelsTest, Replace) {
+    auto string = FromAscii("a-b-c-d-e-f-g-h-i-j-k-l");
+    EXPECT_THAT(Replace(string, '-', '+', false), FromAscii("a+b+c+d+e+f+g+h+i+j+k+l"));
+    EXPECT_THAT(Replace(string, 'K', '_', false), string);
+    EXPECT_THAT(Replace(string, 'K', '_', true), FromAscii("a-b-c-d-e-f-g-h-i-j-_-l"));
+
+    KCharString kelvin = {'k', 'K', 0x212A, 'k', 'K', 'k', 'K', 'k', 'x'};
+    EXPECT_THAT(Replace(kelvin, 'k', '_', true), FromAscii("________x"));
+}
+
+TEST(StringKernelsTest, RandomAgainstScalar) {
+    std::mt19937 random(42);
+    for (int i = 0; i < 10000; ++i) {
+        auto first = RandomString(random, random() % 40);
+        auto second = first;
+        for (auto& ch : second) {
+            if (random() % 4 == 0) ch = GetUpperCase(ch);
+            if (random() % 4 == 0) ch = GetLowerCase(ch);
+            if (random() % 64 == 0) ch = static_cast<KChar>(random() % 128);
+        }
+
+        KCharString expectedUpper, expectedLower;
+        size_t expectedUpperChange = first.size(), expectedLowerChange = first.size(), expectedMismatch = first.size();
+        for (size_t index = 0; index < first.size(); ++index) {
+            expectedUpper.push_back(GetUpperCase(first[index]));
+            expectedLower.push_back(GetLowerCase(first[index]));
+            if (expectedUpper[index] != first[index] && expectedUpperChange == first.size()) expectedUpperChange = index;
+            if (expectedLower[index] != first[index] && expectedLowerChange == first.size()) expectedLowerChange = index;
+            if (GetLowerCase(first[index]) != GetLowerCase(second[index]) && expectedMismatch == first.size()) expectedMismatch = index;
+        }
+        EXPECT_THAT(UpperCase(first), expectedUpper);
+        EXPECT_THAT(LowerCase(first), expectedLower);
+        EXPECT_THAT(FindUpperCaseChange(first.data(), first.size()), expectedUpperChange);
+        EXPECT_THAT(FindLowerCaseChange(first.data(), first.size()), expectedLowerChange);
+        EXPECT_THAT(FindMismatchIgnoreCase(first.data(), second.data(), first.size()), expectedMismatch);
+
+        KChar needle = static_cast<KChar>('a' + random() % 26);
+        KCharString expectedReplace, expectedReplaceIgnoreCase;
+        size_t expectedFind = first.size(), expectedFindIgnoreCase = first.size();
+        for (size_t index = 0; index < first.size(); ++index) {
+            bool found = first[index] == needle;
+            bool foundIgnoreCase = GetLowerCase(first[index]) == needle;
+            expectedReplace.push_back(found ? '#' : first[index]);
+            expectedReplaceIgnoreCase.push_back(foundIgnoreCase ? '#' : first[index]);
+            if (found && expectedFind == first.size()) expectedFind = index;
+            if (foundIgnoreCase && expectedFindIgnoreCase == first.size()) expectedFindIgnoreCase = index;
+        }
+        EXPECT_THAT(Replace(first, needle, '#', false), expectedReplace);
+        EXPECT_THAT(Replace(first, needle, '#', true), expectedReplaceIgnoreCase);
+        EXPECT_THAT(FindChar(first.data(), first.size(), needle, false), expectedFind);
+        EXPECT_THAT(FindChar(first.data(), first.size(), needle, true), expectedFindIgnoreCase);
+    }
+}
+
+TEST(StringKernelsTest, Latin1) {
+    const char16_t text[] = u"Grüße aus Köln, 100°C";
+    KCharString latin1(text, text + sizeof(text) / sizeof(text[0]) - 1);
+    for (size_t index = 0; index < latin1.size(); ++index) {
+        EXPECT_TRUE(IsLatin1(latin1.data() + index, latin1.size() - index));
+    }
+    KCharString notLatin1 = latin1;
+    notLatin1[17] = 0x0100;
+    EXPECT_FALSE(IsLatin1(notLatin1.data(), notLatin1.size()));
+    EXPECT_TRUE(IsLatin1(notLatin1.data(), 17));
+    notLatin1[17] = 0xFF00;
+    EXPECT_FALSE(IsLatin1(notLatin1.data(), notLatin1.size()));
+    EXPECT_TRUE(IsLatin1(notLatin1.data() + 18, notLatin1.size() - 18));
+
+    uint8_t compressed[32] = {};
+    CompressToLatin1(latin1.data(), latin1.size(), compressed);
+    KCharString inflated(latin1.size(), 0);
+    InflateLatin1(compressed, latin1.size(), &inflated[0]);
+    EXPECT_THAT(inflated, latin1);
+}
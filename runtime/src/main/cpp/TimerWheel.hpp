@@ -0,0 +1,212 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_TIMER_WHEEL_H
+#define RUNTIME_TIMER_WHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "Alloc.h"
+#include "KAssert.h"
+#include "Utils.hpp"
+
+namespace kotlin {
+
+// Hierarchical timer wheel: O(1) insertion and amortized O(1) expiration of values keyed by a deadline.
+//
+// Level `L` has `kSlotCount` slots, each covering `kSlotCount^L` ticks. A value is put into the level of the
+// most significant digit in which its deadline differs from the wheel's current time, so that all values in
+// level `L` precede all values in level `L + 1`, and within a level the slot index orders them. When the wheel
+// advances into a slot of a higher level, the slot is cascaded into the lower levels; a value is cascaded at
+// most once per level.
+//
+// Not thread safe. Time must be monotonic.
+template <typename Value>
+class TimerWheel : private Pinned {
+public:
+    using Time = uint64_t;
+
+    explicit TimerWheel(Time now) noexcept : now_(now) {}
+
+    ~TimerWheel() {
+        ForEachNode([](Node* node) { delete node; });
+        while (freeNodes_ != nullptr) {
+            Node* node = freeNodes_;
+            freeNodes_ = node->next_;
+            delete node;
+        }
+    }
+
+    size_t size() const noexcept { return size_; }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    // Current time of the wheel: the time of the last `Expire` call or of construction.
+    Time now() const noexcept { return now_; }
+
+    void Insert(Time deadline, const Value& value) noexcept {
+        Node* node = freeNodes_;
+        if (node != nullptr) {
+            freeNodes_ = node->next_;
+            node->deadline_ = deadline;
+            node->value_ = value;
+        } else {
+            node = new Node(deadline, value);
+        }
+        ++size_;
+        Place(node);
+    }
+
+    // Returns a lower bound on the earliest deadline in the wheel. The bound is exact if the earliest
+    // value is in the lowest level. Must not be called on an empty wheel.
+    Time NextDeadline() const noexcept {
+        RuntimeAssert(!empty(), "Timer wheel must not be empty");
+        if (due_.head != nullptr) return now_;
+        for (size_t level = 0; level < kLevelCount; ++level) {
+            if (occupied_[level] == 0) continue;
+            return SlotStart(level, __builtin_ctzll(occupied_[level]));
+        }
+        RuntimeCheck(false, "Non empty timer wheel without occupied slots");
+        return std::numeric_limits<Time>::max();
+    }
+
+    // Advances the wheel to `now` and calls `f(value)` for each value with deadline `<= now`,
+    // in deadline order.
+    template <typename F>
+    void Expire(Time now, F f) noexcept(noexcept(f(std::declval<Value&>()))) {
+        while (true) {
+            while (due_.head != nullptr) {
+                Node* node = due_.PopFront();
+                --size_;
+                Value value = std::move(node->value_);
+                Release(node);
+                f(value);
+            }
+            size_t level = 0;
+            while (level < kLevelCount && occupied_[level] == 0) ++level;
+            if (level == kLevelCount) {
+                if (now > now_) now_ = now;
+                return;
+            }
+            size_t slot = __builtin_ctzll(occupied_[level]);
+            Time start = SlotStart(level, slot);
+            if (start > now) {
+                // Nothing else is due. All remaining deadlines share the digits above `level` with `now`,
+                // so moving the cursor does not invalidate their placement.
+                if (now > now_) now_ = now;
+                return;
+            }
+            now_ = start;
+            occupied_[level] &= ~(uint64_t(1) << slot);
+            NodeList list = slots_[level][slot];
+            slots_[level][slot] = NodeList();
+            // Every value in the slot is either due exactly now (level 0) or moves to a lower level.
+            while (list.head != nullptr) {
+                Place(list.PopFront());
+            }
+        }
+    }
+
+    // Calls `f(value)` for each value in the wheel in no particular order.
+    template <typename F>
+    void ForEach(F f) noexcept(noexcept(f(std::declval<Value&>()))) {
+        ForEachNode([&f](Node* node) { f(node->value_); });
+    }
+
+private:
+    static constexpr size_t kSlotBits = 6;
+    static constexpr size_t kSlotCount = size_t(1) << kSlotBits;
+    static constexpr size_t kLevelCount = (std::numeric_limits<Time>::digits + kSlotBits - 1) / kSlotBits;
+
+    class Node : private Pinned, public KonanAllocatorAware {
+    public:
+        Node(Time deadline, const Value& value) noexcept : deadline_(deadline), value_(value) {}
+
+        Time deadline_;
+        Value value_;
+        Node* next_ = nullptr;
+    };
+
+    struct NodeList {
+        Node* head = nullptr;
+        Node* tail = nullptr;
+
+        void PushBack(Node* node) noexcept {
+            node->next_ = nullptr;
+            if (tail == nullptr) {
+                head = node;
+            } else {
+                tail->next_ = node;
+            }
+            tail = node;
+        }
+
+        Node* PopFront() noexcept {
+            Node* node = head;
+            head = node->next_;
+            if (head == nullptr) tail = nullptr;
+            return node;
+        }
+    };
+
+    Time SlotStart(size_t level, size_t slot) const noexcept {
+        // Keep the digits of `now_` above `level`, replace the digit at `level` and clear everything below.
+        size_t shift = level * kSlotBits;
+        size_t highShift = shift + kSlotBits;
+        Time high = highShift >= std::numeric_limits<Time>::digits ? 0 : (now_ >> highShift) << highShift;
+        return high | (Time(slot) << shift);
+    }
+
+    void Place(Node* node) noexcept {
+        if (node->deadline_ <= now_) {
+            due_.PushBack(node);
+            return;
+        }
+        size_t level = (std::numeric_limits<Time>::digits - 1 - __builtin_clzll(node->deadline_ ^ now_)) / kSlotBits;
+        size_t slot = (node->deadline_ >> (level * kSlotBits)) & (kSlotCount - 1);
+        slots_[level][slot].PushBack(node);
+        occupied_[level] |= uint64_t(1) << slot;
+    }
+
+    void Release(Node* node) noexcept {
+        node->next_ = freeNodes_;
+        freeNodes_ = node;
+    }
+
+    template <typename F>
+    void ForEachNode(F f) noexcept(noexcept(f(std::declval<Node*>()))) {
+        auto visit = [&f](NodeList& list) {
+            Node* node = list.head;
+            while (node != nullptr) {
+                Node* next = node->next_;
+                f(node);
+                node = next;
+            }
+        };
+        visit(due_);
+        for (size_t level = 0; level < kLevelCount; ++level) {
+            for (size_t slot = 0; slot < kSlotCount; ++slot) {
+                visit(slots_[level][slot]);
+            }
+        }
+    }
+
+    Time now_;
+    size_t size_ = 0;
+    // Values that were already due when placed.
+    NodeList due_;
+    NodeList slots_[kLevelCount][kSlotCount];
+    // Bit `i` of `occupied_[L]` is set iff `slots_[L][i]` is not empty.
+    uint64_t occupied_[kLevelCount] = {};
+    // Nodes of expired values are reused by subsequent insertions.
+    Node* freeNodes_ = nullptr;
+};
+
+} // namespace kotlin
+
+#endif // RUNTIME_TIMER_WHEEL_H
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "TimerWheel.hpp"
+
+#include <algorithm>
+#include <random>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+
+using namespace kotlin;
+
+namespace {
+
+using IntTimerWheel = TimerWheel<int>;
+
+KStdVector<int> Expire(IntTimerWheel& wheel, IntTimerWheel::Time now) {
+    KStdVector<int> result;
+    wheel.Expire(now, [&result](int value) { result.push_back(value); });
+    return result;
+}
+
+} // namespace
+
+TEST(TimerWheelTest, Empty) {
+    IntTimerWheel wheel(100);
+
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_THAT(Expire(wheel, 1000000), testing::IsEmpty());
+    EXPECT_THAT(wheel.now(), 1000000);
+}
+
+TEST(TimerWheelTest, ExpireInDeadlineOrder) {
+    IntTimerWheel wheel(0);
+    wheel.Insert(300, 3);
+    wheel.Insert(100, 1);
+    wheel.Insert(5000000, 5);
+    wheel.Insert(200, 2);
+    wheel.Insert(70000, 4);
+
+    EXPECT_THAT(wheel.size(), 5);
+    EXPECT_THAT(Expire(wheel, 99), testing::IsEmpty());
+    EXPECT_THAT(Expire(wheel, 250), testing::ElementsAre(1, 2));
+    EXPECT_THAT(Expire(wheel, 100000), testing::ElementsAre(3, 4));
+    EXPECT_THAT(wheel.size(), 1);
+    EXPECT_THAT(Expire(wheel, 5000000), testing::ElementsAre(5));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, EqualDeadlines) {
+    IntTimerWheel wheel(0);
+    wheel.Insert(1000, 1);
+    wheel.Insert(1000, 2);
+    wheel.Insert(1000, 3);
+
+    EXPECT_THAT(Expire(wheel, 1000), testing::UnorderedElementsAre(1, 2, 3));
+}
+
+TEST(TimerWheelTest, InsertAlreadyDue) {
+    IntTimerWheel wheel(0);
+    EXPECT_THAT(Expire(wheel, 500), testing::IsEmpty());
+    wheel.Insert(10, 1);
+
+    EXPECT_THAT(wheel.NextDeadline(), 500);
+    EXPECT_THAT(Expire(wheel, 500), testing::ElementsAre(1));
+}
+
+TEST(TimerWheelTest, NextDeadlineIsLowerBound) {
+    IntTimerWheel wheel(0);
+    wheel.Insert(123456, 1);
+
+    auto deadline = wheel.NextDeadline();
+    EXPECT_LE(deadline, 123456);
+    EXPECT_GT(deadline, 0);
+    while (!wheel.empty()) {
+        deadline = wheel.NextDeadline();
+        EXPECT_LE(deadline, 123456);
+        auto expired = Expire(wheel, deadline);
+        if (deadline < 123456) {
+            EXPECT_THAT(expired, testing::IsEmpty());
+        } else {
+            EXPECT_THAT(expired, testing::ElementsAre(1));
+        }
+    }
+}
+
+TEST(TimerWheelTest, FarDeadlines) {
+    IntTimerWheel wheel(1);
+    wheel.Insert(std::numeric_limits<IntTimerWheel::Time>::max(), 2);
+    wheel.Insert(uint64_t(1) << 62, 1);
+
+    EXPECT_THAT(Expire(wheel, uint64_t(1) << 61), testing::IsEmpty());
+    EXPECT_THAT(Expire(wheel, uint64_t(1) << 62), testing::ElementsAre(1));
+    EXPECT_THAT(Expire(wheel, std::numeric_limits<IntTimerWheel::Time>::max()), testing::ElementsAre(2));
+}
+
+TEST(TimerWheelTest, ForEach) {
+    IntTimerWheel wheel(0);
+    wheel.Insert(0, 1);
+    wheel.Insert(10, 2);
+    wheel.Insert(100000, 3);
+
+    KStdVector<int> actual;
+    wheel.ForEach([&actual](int value) { actual.push_back(value); });
+
+    EXPECT_THAT(actual, testing::UnorderedElementsAre(1, 2, 3));
+}
+
+TEST(TimerWheelTest, RandomizedInsertAndExpire) {
+    constexpr int kCount = 10000;
+    std::mt19937_64 random(42);
+    IntTimerWheel::Time now = 1000;
+    IntTimerWheel wheel(now);
+    KStdVector<IntTimerWheel::Time> deadlines;
+    KStdVector<bool> expired(kCount, false);
+    auto expire = [&](bool checkAll) {
+        KStdVector<IntTimerWheel::Time> batch;
+        wheel.Expire(now, [&](int value) {
+            EXPECT_FALSE(expired[value]);
+            expired[value] = true;
+            batch.push_back(deadlines[value]);
+        });
+        EXPECT_TRUE(std::is_sorted(batch.begin(), batch.end()));
+        if (!checkAll) return;
+        for (int i = 0; i < static_cast<int>(deadlines.size()); ++i) {
+            EXPECT_THAT(expired[i], deadlines[i] <= now);
+        }
+    };
+
+    for (int i = 0; i < kCount; ++i) {
+        IntTimerWheel::Time deadline = now + random() % 10000000;
+        deadlines.push_back(deadline);
+        wheel.Insert(deadline, i);
+        if (i % 500 == 0) {
+            now += random() % 200000;
+            expire(true);
+        }
+    }
+    while (!wheel.empty()) {
+        now = wheel.NextDeadline();
+        expire(false);
+    }
+
+    EXPECT_THAT(std::count(expired.begin(), expired.end(), true), kCount);
+}
+
+TEST(TimerWheelTest, ExpireInOrderAcrossLevels) {
+    constexpr int kCount = 5000;
+    std::mt19937_64 random(7);
+    IntTimerWheel wheel(0);
+    KStdVector<IntTimerWheel::Time> deadlines;
+    for (int i = 0; i < kCount; ++i) {
+        IntTimerWheel::Time deadline = 1 + random() % (uint64_t(1) << (1 + i % 40));
+        deadlines.push_back(deadline);
+        wheel.Insert(deadline, i);
+    }
+
+    KStdVector<IntTimerWheel::Time> actual;
+    wheel.Expire(std::numeric_limits<IntTimerWheel::Time>::max(), [&](int value) { actual.push_back(deadlines[value]); });
+
+    std::sort(deadlines.begin(), deadlines.end());
+    EXPECT_THAT(actual, testing::ElementsAreArray(deadlines));
+}
@@ -14,10 +14,11 @@
  * limitations under the License.
  */
 
-#include <limits.h>
 #include <stdio.h>
 #include <string.h>
 
+#include "DoubleToString.hpp"
+#include "IntegerToString.hpp"
 #include "KAssert.h"
 #include "Exceptions.h"
 #include "Memory.h"
@@ -28,41 +29,30 @@
 
 namespace {
 
-char int_to_digit(uint32_t value) {
-  if (value < 10) {
-    return '0' + value;
-  } else {
-    return 'a' + (value - 10);
+template <typename T> OBJ_GETTER(DecimalToString, T value) {
+  size_t length = kotlin::DecimalLength(value);
+  if (Kotlin_compactStringsEnabled()) {
+    KChar buffer[kotlin::kLongToStringMaxLength];
+    kotlin::WriteDecimal(value, buffer, length);
+    RETURN_RESULT_OF(CreateStringFromUtf16, buffer, length);
   }
+  ArrayHeader* result = AllocArrayInstance(theStringTypeInfo, length, OBJ_RESULT)->array();
+  kotlin::WriteDecimal(value, CharArrayAddressOfElementAt(result, 0), length);
+  RETURN_OBJ(result->obj());
 }
 
 // Radix is checked on the Kotlin side.
-template <typename T> OBJ_GETTER(Kotlin_toStringRadix, T value, KInt radix) {
-  if (value == 0) {
-    RETURN_RESULT_OF(CreateStringFromCString, "0");
-  }
-  // In the worst case, we convert to binary, with sign.
-  char cstring[sizeof(T) * CHAR_BIT + 2];
-  bool negative = (value < 0);
-  if  (!negative) {
-    value = -value;
-  }
-
-  int32_t length = 0;
-  while (value < 0) {
-    cstring[length++] = int_to_digit(-(value % radix));
-    value /= radix;
+OBJ_GETTER(RadixToString, KLong value, KInt radix) {
+  size_t length = kotlin::RadixLength(value, radix);
+  if (Kotlin_compactStringsEnabled()) {
+    // Up to 64 binary digits and the sign.
+    KChar buffer[65];
+    kotlin::WriteRadix(value, radix, buffer, length);
+    RETURN_RESULT_OF(CreateStringFromUtf16, buffer, length);
   }
-  if (negative) {
-    cstring[length++] = '-';
-  }
-  for (int i = 0, j = length - 1; i < j; i++, j--) {
-    char tmp = cstring[i];
-    cstring[i] = cstring[j];
-    cstring[j] = tmp;
-  }
-  cstring[length] = '\0';
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  ArrayHeader* result = AllocArrayInstance(theStringTypeInfo, length, OBJ_RESULT)->array();
+  kotlin::WriteRadix(value, radix, CharArrayAddressOfElementAt(result, 0), length);
+  RETURN_OBJ(result->obj());
 }
 
 }  // namespace
@@ -70,41 +60,43 @@ template <typename T> OBJ_GETTER(Kotlin_toStringRadix, T value, KInt radix) {
 extern "C" {
 
 OBJ_GETTER(Kotlin_Byte_toString, KByte value) {
-  char cstring[8];
-  konan::snprintf(cstring, sizeof(cstring), "%d", value);
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  RETURN_RESULT_OF(DecimalToString, static_cast<KInt>(value));
 }
 
 OBJ_GETTER(Kotlin_Char_toString, KChar value) {
-  ArrayHeader* result = AllocArrayInstance(theStringTypeInfo, 1, OBJ_RESULT)->array();
-  *CharArrayAddressOfElementAt(result, 0) = value;
-  RETURN_OBJ(result->obj());
+  RETURN_RESULT_OF(CreateStringFromUtf16, &value, 1);
 }
 
 OBJ_GETTER(Kotlin_Short_toString, KShort value) {
-  char cstring[8];
-  konan::snprintf(cstring, sizeof(cstring), "%d", value);
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  RETURN_RESULT_OF(DecimalToString, static_cast<KInt>(value));
 }
 
 OBJ_GETTER(Kotlin_Int_toString, KInt value) {
-  char cstring[16];
-  konan::snprintf(cstring, sizeof(cstring), "%d", value);
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  RETURN_RESULT_OF(DecimalToString, value);
 }
 
 OBJ_GETTER(Kotlin_Int_toStringRadix, KInt value, KInt radix) {
-  RETURN_RESULT_OF(Kotlin_toStringRadix<KInt>, value, radix)
+  RETURN_RESULT_OF(RadixToString, value, radix);
 }
 
 OBJ_GETTER(Kotlin_Long_toString, KLong value) {
-  char cstring[32];
-  konan::snprintf(cstring, sizeof(cstring), "%lld", static_cast<long long>(value));
-  RETURN_RESULT_OF(CreateStringFromCString, cstring);
+  RETURN_RESULT_OF(DecimalToString, value);
 }
 
 OBJ_GETTER(Kotlin_Long_toStringRadix, KLong value, KInt radix) {
-  RETURN_RESULT_OF(Kotlin_toStringRadix<KLong>, value, radix)
+  RETURN_RESULT_OF(RadixToString, value, radix);
+}
+
+OBJ_GETTER(Kotlin_Float_toString, KFloat value) {
+  KChar buffer[kotlin::kDoubleToStringMaxLength];
+  size_t length = kotlin::FloatToString(value, buffer);
+  RETURN_RESULT_OF(CreateStringFromUtf16, buffer, length);
+}
+
+OBJ_GETTER(Kotlin_Double_toString, KDouble value) {
+  KChar buffer[kotlin::kDoubleToStringMaxLength];
+  size_t length = kotlin::DoubleToString(value, buffer);
+  RETURN_RESULT_OF(CreateStringFromUtf16, buffer, length);
 }
 
 OBJ_GETTER(Kotlin_DurationValue_formatToExactDecimals, KDouble value, KInt decimals) {
@@ -0,0 +1,221 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "Tracing.hpp"
+
+#include <algorithm>
+
+#include "Alloc.h"
+#include "KString.h"
+
+using namespace kotlin;
+
+// Ring buffer with a single writer, its owner thread, and any number of readers.
+//
+// Readers don't stop the writer: they copy the spans and then drop the ones the writer could have started
+// overwriting meanwhile. The writer announces a slot with `started_` before writing it and publishes it with
+// `finished_`, the fences order these against the relaxed accesses to the slot, like in a seqlock.
+class Tracing::Buffer : private Pinned {
+public:
+    struct Event {
+        const char* category;
+        const char* name;
+        uint64_t startNanos;
+        uint64_t durationNanos;
+        uint32_t threadId;
+    };
+
+    bool TryAcquire() noexcept {
+        bool expected = false;
+        return !owned_.load(std::memory_order_relaxed) &&
+                owned_.compare_exchange_strong(expected, true, std::memory_order_acquire);
+    }
+
+    void Release() noexcept { owned_.store(false, std::memory_order_release); }
+
+    void Record(const Event& event) noexcept {
+        uint64_t index = finished_.load(std::memory_order_relaxed);
+        started_.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        auto& slot = slots_[index % kBufferCapacity];
+        slot.category.store(event.category, std::memory_order_relaxed);
+        slot.name.store(event.name, std::memory_order_relaxed);
+        slot.startNanos.store(event.startNanos, std::memory_order_relaxed);
+        slot.durationNanos.store(event.durationNanos, std::memory_order_relaxed);
+        slot.threadId.store(event.threadId, std::memory_order_relaxed);
+        finished_.store(index + 1, std::memory_order_release);
+    }
+
+    // Appends the spans in the buffer to `events`.
+    void Read(KStdVector<Event>& events) noexcept {
+        uint64_t end = finished_.load(std::memory_order_acquire);
+        uint64_t begin = end > kBufferCapacity ? end - kBufferCapacity : 0;
+        size_t first = events.size();
+        for (uint64_t index = begin; index < end; ++index) {
+            auto& slot = slots_[index % kBufferCapacity];
+            events.push_back(Event{
+                    slot.category.load(std::memory_order_relaxed),
+                    slot.name.load(std::memory_order_relaxed),
+                    slot.startNanos.load(std::memory_order_relaxed),
+                    slot.durationNanos.load(std::memory_order_relaxed),
+                    slot.threadId.load(std::memory_order_relaxed),
+            });
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t started = started_.load(std::memory_order_relaxed);
+        // The slots of these indices could have been overwritten while being copied.
+        uint64_t overwritten = started > kBufferCapacity ? started - kBufferCapacity : 0;
+        if (overwritten > begin) {
+            size_t dropped = static_cast<size_t>(std::min(overwritten, end) - begin);
+            events.erase(events.begin() + first, events.begin() + first + dropped);
+        }
+    }
+
+    Buffer* next() const noexcept { return next_; }
+    void setNext(Buffer* next) noexcept { next_ = next; }
+
+private:
+    struct Slot {
+        std::atomic<const char*> category{nullptr};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> startNanos{0};
+        std::atomic<uint64_t> durationNanos{0};
+        std::atomic<uint32_t> threadId{0};
+    };
+
+    Slot slots_[kBufferCapacity];
+    std::atomic<uint64_t> started_{0};
+    std::atomic<uint64_t> finished_{0};
+    std::atomic<bool> owned_{true};
+    // Buffers are never removed from the list, so it's only written before the buffer is published.
+    Buffer* next_ = nullptr;
+};
+
+std::atomic<bool> Tracing::enabled_{false};
+std::atomic<uint64_t> Tracing::clearedAtNanos_{0};
+std::atomic<Tracing::Buffer*> Tracing::buffers_{nullptr};
+std::atomic<uint32_t> Tracing::nextThreadId_{1};
+THREAD_LOCAL_VARIABLE Tracing::Buffer* Tracing::currentBuffer_ = nullptr;
+THREAD_LOCAL_VARIABLE uint32_t Tracing::currentThreadId_ = 0;
+THREAD_LOCAL_VARIABLE bool Tracing::threadExited_ = false;
+
+// static
+void Tracing::Start() noexcept {
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+// static
+void Tracing::Stop() noexcept {
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+// static
+void Tracing::Clear() noexcept {
+    clearedAtNanos_.store(konan::getTimeNanos(), std::memory_order_relaxed);
+}
+
+// static
+void Tracing::RecordSpan(const char* category, const char* name, uint64_t startNanos, uint64_t endNanos) noexcept {
+    Buffer* buffer = CurrentBuffer();
+    if (buffer == nullptr) return;
+    buffer->Record(Buffer::Event{category, name, startNanos, endNanos - startNanos, currentThreadId_});
+}
+
+// static
+Tracing::Buffer* Tracing::CurrentBuffer() noexcept {
+    if (currentBuffer_ != nullptr) return currentBuffer_;
+    if (threadExited_) return nullptr;
+    Buffer* buffer = nullptr;
+    for (Buffer* candidate = buffers_.load(std::memory_order_acquire); candidate != nullptr; candidate = candidate->next()) {
+        if (candidate->TryAcquire()) {
+            buffer = candidate;
+            break;
+        }
+    }
+    if (buffer == nullptr) {
+        buffer = konanConstructInstance<Buffer>();
+        if (buffer == nullptr) return nullptr;
+        Buffer* head = buffers_.load(std::memory_order_relaxed);
+        do {
+            buffer->setNext(head);
+        } while (!buffers_.compare_exchange_weak(head, buffer, std::memory_order_release, std::memory_order_relaxed));
+    }
+    currentBuffer_ = buffer;
+    currentThreadId_ = nextThreadId_.fetch_add(1, std::memory_order_relaxed);
+    konan::onThreadExit(ReleaseBuffer, buffer);
+    return buffer;
+}
+
+// static
+void Tracing::ReleaseBuffer(void* buffer) noexcept {
+    // The thread exit callbacks registered after this one would be lost, so spans of the later ones are not recorded.
+    currentBuffer_ = nullptr;
+    threadExited_ = true;
+    static_cast<Buffer*>(buffer)->Release();
+}
+
+// static
+void Tracing::WriteJson(KStdString& out) noexcept {
+    KStdVector<Buffer::Event> events;
+    for (Buffer* buffer = buffers_.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next()) {
+        buffer->Read(events);
+    }
+    uint64_t clearedAt = clearedAtNanos_.load(std::memory_order_relaxed);
+    std::sort(events.begin(), events.end(), [](const Buffer::Event& lhs, const Buffer::Event& rhs) {
+        return lhs.startNanos < rhs.startNanos;
+    });
+
+    // Timestamps are in microseconds, with nanoseconds as the fraction.
+    out += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (auto& event : events) {
+        if (event.startNanos < clearedAt) continue;
+        if (!first) out += ',';
+        first = false;
+        char buffer[256];
+        int length = konan::snprintf(
+                buffer, sizeof(buffer),
+                "\n{\"cat\":\"%s\",\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%llu.%03u,\"dur\":%llu.%03u}",
+                event.category, event.name, event.threadId, static_cast<unsigned long long>(event.startNanos / 1000),
+                static_cast<unsigned>(event.startNanos % 1000), static_cast<unsigned long long>(event.durationNanos / 1000),
+                static_cast<unsigned>(event.durationNanos % 1000));
+        out.append(buffer, std::min(static_cast<size_t>(std::max(length, 0)), sizeof(buffer) - 1));
+    }
+    out += "\n]}\n";
+}
+
+// static
+bool Tracing::WriteJson(const char* path) noexcept {
+    KStdString json;
+    WriteJson(json);
+    return konan::writeFile(path, json.data(), json.size());
+}
+
+extern "C" {
+
+void Kotlin_Tracing_start() {
+    Tracing::Start();
+}
+
+void Kotlin_Tracing_stop() {
+    Tracing::Stop();
+}
+
+void Kotlin_Tracing_clear() {
+    Tracing::Clear();
+}
+
+KBoolean Kotlin_Tracing_isEnabled() {
+    return Tracing::enabled();
+}
+
+KBoolean Kotlin_Tracing_writeTrace(KConstRef path) {
+    auto utf8Path = CreateCStringFromString(path);
+    bool result = Tracing::WriteJson(utf8Path);
+    DisposeCString(utf8Path);
+    return result;
+}
+
+} // extern "C"
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_TRACING_H
+#define RUNTIME_TRACING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Common.h"
+#include "Porting.h"
+#include "Types.h"
+#include "Utils.hpp"
+
+namespace kotlin {
+
+// Records spans of the runtime work (GC phases, worker jobs, freezing) to line them up on one timeline. The trace is
+// written in the Chrome trace event format (https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU),
+// which opens in Perfetto and chrome://tracing.
+//
+// Each thread records into its own ring buffer without locks, keeping the last `kBufferCapacity` spans. The buffer of
+// an exited thread is kept for the trace and reused by a new thread, overwriting the oldest spans first.
+//
+// Disabled by default. When disabled, a span costs a single relaxed load.
+class Tracing : private Pinned {
+public:
+    static constexpr size_t kBufferCapacity = 4096;
+
+    // Records the span from its construction to its destruction. `category` and `name` must be string literals.
+    class Span : private Pinned {
+    public:
+        ALWAYS_INLINE Span(const char* category, const char* name) noexcept : category_(category), name_(name) {
+            if (enabled()) startNanos_ = konan::getTimeNanos();
+        }
+
+        ALWAYS_INLINE ~Span() {
+            if (startNanos_ != 0 && enabled()) RecordSpan(category_, name_, startNanos_, konan::getTimeNanos());
+        }
+
+    private:
+        const char* category_;
+        const char* name_;
+        uint64_t startNanos_ = 0;
+    };
+
+    static bool enabled() noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+    // Starts recording, keeping the spans recorded so far.
+    static void Start() noexcept;
+    static void Stop() noexcept;
+    // Drops the spans recorded so far.
+    static void Clear() noexcept;
+
+    // Records a span on the current thread. Times are from `konan::getTimeNanos`.
+    static void RecordSpan(const char* category, const char* name, uint64_t startNanos, uint64_t endNanos) noexcept;
+
+    // Appends the recorded spans as a trace event JSON object.
+    static void WriteJson(KStdString& out) noexcept;
+    // Writes the recorded spans into the file at `path`. Returns false if the file couldn't be written.
+    static bool WriteJson(const char* path) noexcept;
+
+private:
+    class Buffer;
+
+    static Buffer* CurrentBuffer() noexcept;
+    static void ReleaseBuffer(void* buffer) noexcept;
+
+    static std::atomic<bool> enabled_;
+    // Spans started before are dropped by `Clear`.
+    static std::atomic<uint64_t> clearedAtNanos_;
+    static std::atomic<Buffer*> buffers_;
+    static std::atomic<uint32_t> nextThreadId_;
+    static THREAD_LOCAL_VARIABLE Buffer* currentBuffer_;
+    static THREAD_LOCAL_VARIABLE uint32_t currentThreadId_;
+    static THREAD_LOCAL_VARIABLE bool threadExited_;
+};
+
+} // namespace kotlin
+
+#endif // RUNTIME_TRACING_H
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "Tracing.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "TestSupport.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+std::string WriteTrace() {
+    KStdString out;
+    Tracing::WriteJson(out);
+    return std::string(out.begin(), out.end());
+}
+
+size_t CountOf(const std::string& text, const std::string& pattern) {
+    size_t result = 0;
+    for (size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1)) {
+        ++result;
+    }
+    return result;
+}
+
+class TracingTest : public testing::Test {
+public:
+    TracingTest() { Tracing::Clear(); }
+
+    ~TracingTest() override {
+        Tracing::Stop();
+        Tracing::Clear();
+    }
+};
+
+} // namespace
+
+TEST_F(TracingTest, DisabledByDefault) {
+    { Tracing::Span span("test", "disabled"); }
+
+    EXPECT_FALSE(Tracing::enabled());
+    EXPECT_THAT(CountOf(WriteTrace(), "\"disabled\""), 0);
+}
+
+TEST_F(TracingTest, RecordsSpans) {
+    Tracing::Start();
+    {
+        Tracing::Span outer("test", "outer");
+        Tracing::Span inner("test", "inner");
+    }
+    Tracing::Stop();
+    { Tracing::Span span("test", "stopped"); }
+
+    auto trace = WriteTrace();
+    EXPECT_THAT(trace, testing::StartsWith("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    EXPECT_THAT(trace, testing::HasSubstr("{\"cat\":\"test\",\"name\":\"outer\",\"ph\":\"X\",\"pid\":1,\"tid\":"));
+    EXPECT_THAT(CountOf(trace, "\"name\":\"outer\""), 1);
+    EXPECT_THAT(CountOf(trace, "\"name\":\"inner\""), 1);
+    EXPECT_THAT(CountOf(trace, "\"stopped\""), 0);
+    // Sorted by the start time.
+    EXPECT_LT(trace.find("\"outer\""), trace.find("\"inner\""));
+}
+
+TEST_F(TracingTest, Timestamps) {
+    Tracing::Start();
+    // After the last `Clear`, with a fraction of a microsecond.
+    uint64_t startMicros = konan::getTimeNanos() / 1000 + 1;
+    Tracing::RecordSpan("test", "timestamps", startMicros * 1000 + 67, startMicros * 1000 + 67 + 2001);
+
+    auto trace = WriteTrace();
+    EXPECT_THAT(trace, testing::HasSubstr("\"name\":\"timestamps\",\"ph\":\"X\",\"pid\":1,\"tid\":"));
+    EXPECT_THAT(trace, testing::HasSubstr(",\"ts\":" + std::to_string(startMicros) + ".067,\"dur\":2.001}"));
+}
+
+TEST_F(TracingTest, Clear) {
+    Tracing::Start();
+    { Tracing::Span span("test", "cleared"); }
+    Tracing::Clear();
+    { Tracing::Span span("test", "kept"); }
+
+    auto trace = WriteTrace();
+    EXPECT_THAT(CountOf(trace, "\"cleared\""), 0);
+    EXPECT_THAT(CountOf(trace, "\"kept\""), 1);
+}
+
+TEST_F(TracingTest, KeepsLastSpans) {
+    Tracing::Start();
+    for (size_t i = 0; i < Tracing::kBufferCapacity; ++i) {
+        Tracing::Span span("test", "old");
+    }
+    for (size_t i = 0; i < Tracing::kBufferCapacity / 2; ++i) {
+        Tracing::Span span("test", "new");
+    }
+
+    auto trace = WriteTrace();
+    EXPECT_THAT(CountOf(trace, "\"new\""), Tracing::kBufferCapacity / 2);
+    EXPECT_THAT(CountOf(trace, "\"old\""), Tracing::kBufferCapacity / 2);
+}
+
+TEST_F(TracingTest, Threads) {
+    constexpr int kThreadCount = kDefaultThreadCount;
+    // Few enough to fit into one buffer even if all the threads reuse it.
+    constexpr int kSpanCount = Tracing::kBufferCapacity / kThreadCount;
+    Tracing::Start();
+    std::atomic<bool> canStop(false);
+    // Reads the buffers while they are written.
+    std::thread reader([&canStop]() {
+        while (!canStop) {
+            auto trace = WriteTrace();
+            EXPECT_THAT(trace, testing::EndsWith("\n]}\n"));
+        }
+    });
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreadCount; ++i) {
+        threads.emplace_back([]() {
+            for (int j = 0; j < kSpanCount; ++j) {
+                Tracing::Span span("test", "thread");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    canStop = true;
+    reader.join();
+
+    // Buffers of the exited threads are still there.
+    EXPECT_THAT(CountOf(WriteTrace(), "\"thread\""), kThreadCount * kSpanCount);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_UNICODE_TABLES_H
+#define RUNTIME_UNICODE_TABLES_H
+
+#include <cstdint>
+
+#include "Types.h"
+
+namespace kotlin {
+
+namespace internal {
+
+// Properties of the BMP are stored in two-stage tables: the upper bits of a char select a block of
+// `kUnicodeBlockSize` values via `k*Index`, and the lower bits select a value in the block. Equal blocks are
+// stored once, which keeps the tables small while giving O(1) lookups.
+constexpr int kUnicodeBlockShift = 5;
+constexpr int kUnicodeBlockSize = 1 << kUnicodeBlockShift;
+
+extern const uint8_t kCharTypeIndex[];
+extern const uint8_t kCharTypeBlocks[];
+extern const uint8_t kUpperCaseDeltaIndex[];
+extern const uint16_t kUpperCaseDeltaBlocks[];
+extern const uint8_t kLowerCaseDeltaIndex[];
+extern const uint16_t kLowerCaseDeltaBlocks[];
+extern const uint8_t kCanonicalClassIndex[];
+extern const uint8_t kCanonicalClassBlocks[];
+extern const uint8_t kDecompositionIndex[];
+extern const uint16_t kDecompositionBlocks[];
+
+template <typename T>
+inline T LookupUnicodeTable(const uint8_t* index, const T* blocks, KChar ch) noexcept {
+    return blocks[(index[ch >> kUnicodeBlockShift] << kUnicodeBlockShift) | (ch & (kUnicodeBlockSize - 1))];
+}
+
+} // namespace internal
+
+// General category of `ch`, as in `CharCategory.value` (Unicode 3.0.1).
+inline int GetCharType(KChar ch) noexcept {
+    return internal::LookupUnicodeTable(internal::kCharTypeIndex, internal::kCharTypeBlocks, ch);
+}
+
+// Simple case mappings (Unicode 3.0.1). Stored as deltas, which repeat much more often than the mapped chars.
+inline KChar GetUpperCase(KChar ch) noexcept {
+    return static_cast<KChar>(ch + internal::LookupUnicodeTable(internal::kUpperCaseDeltaIndex, internal::kUpperCaseDeltaBlocks, ch));
+}
+
+inline KChar GetLowerCase(KChar ch) noexcept {
+    return static_cast<KChar>(ch + internal::LookupUnicodeTable(internal::kLowerCaseDeltaIndex, internal::kLowerCaseDeltaBlocks, ch));
+}
+
+// Canonical combining class of `ch` (Unicode 4.0.0).
+inline int GetCanonicalClass(KChar ch) noexcept {
+    return internal::LookupUnicodeTable(internal::kCanonicalClassIndex, internal::kCanonicalClassBlocks, ch);
+}
+
+// Index of the decomposition of `ch` in `unicode::internal::decompositionValues` of UnicodeRanges.hpp, or -1 if there is none.
+inline int GetDecompositionIndex(KChar ch) noexcept {
+    return internal::LookupUnicodeTable(internal::kDecompositionIndex, internal::kDecompositionBlocks, ch) - 1;
+}
+
+} // namespace kotlin
+
+#endif // RUNTIME_UNICODE_TABLES_H
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "UnicodeTables.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "Types.h"
+#include "UnicodeRanges.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+// Values of `CharCategory.value`.
+constexpr int kUnassigned = 0;
+constexpr int kUppercaseLetter = 1;
+constexpr int kLowercaseLetter = 2;
+constexpr int kTitlecaseLetter = 3;
+constexpr int kOtherLetter = 5;
+constexpr int kNonSpacingMark = 6;
+constexpr int kDecimalDigitNumber = 9;
+constexpr int kLetterNumber = 10;
+constexpr int kSpaceSeparator = 12;
+constexpr int kControl = 15;
+constexpr int kPrivateUse = 18;
+constexpr int kSurrogate = 19;
+constexpr int kMathSymbol = 25;
+constexpr int kOtherSymbol = 28;
+
+} // namespace
+
+TEST(UnicodeTablesTest, CharType) {
+    EXPECT_THAT(GetCharType(0), kControl);
+    EXPECT_THAT(GetCharType(' '), kSpaceSeparator);
+    EXPECT_THAT(GetCharType('+'), kMathSymbol);
+    EXPECT_THAT(GetCharType('7'), kDecimalDigitNumber);
+    EXPECT_THAT(GetCharType('Q'), kUppercaseLetter);
+    EXPECT_THAT(GetCharType('q'), kLowercaseLetter);
+    EXPECT_THAT(GetCharType(0x00DF), kLowercaseLetter); // ß
+    EXPECT_THAT(GetCharType(0x0394), kUppercaseLetter); // Δ
+    EXPECT_THAT(GetCharType(0x0436), kLowercaseLetter); // ж
+    EXPECT_THAT(GetCharType(0x0301), kNonSpacingMark);
+    EXPECT_THAT(GetCharType(0x0663), kDecimalDigitNumber); // Arabic-Indic three
+    EXPECT_THAT(GetCharType(0x4E2D), kOtherLetter); // 中
+    EXPECT_THAT(GetCharType(0xAC00), kOtherLetter); // 가
+    EXPECT_THAT(GetCharType(0xD800), kSurrogate);
+    EXPECT_THAT(GetCharType(0xDFFF), kSurrogate);
+    EXPECT_THAT(GetCharType(0xE000), kPrivateUse);
+    EXPECT_THAT(GetCharType(0xFFFF), kUnassigned);
+}
+
+TEST(UnicodeTablesTest, CaseMapping) {
+    EXPECT_THAT(GetUpperCase('a'), 'A');
+    EXPECT_THAT(GetLowerCase('A'), 'a');
+    EXPECT_THAT(GetUpperCase('1'), '1');
+    EXPECT_THAT(GetUpperCase(0x00FF), 0x0178); // ÿ -> Ÿ
+    EXPECT_THAT(GetUpperCase(0x00B5), 0x039C); // µ -> Μ
+    EXPECT_THAT(GetUpperCase(0x0131), 'I'); // dotless i
+    EXPECT_THAT(GetLowerCase(0x0130), 'i'); // İ
+    EXPECT_THAT(GetUpperCase(0x03C2), 0x03A3); // final sigma
+    EXPECT_THAT(GetLowerCase(0x2126), 0x03C9); // Ohm sign
+    EXPECT_THAT(GetLowerCase(0x212A), 'k'); // Kelvin sign
+    EXPECT_THAT(GetUpperCase(0xFF41), 0xFF21); // Fullwidth a
+    EXPECT_THAT(GetUpperCase(0x4E2D), 0x4E2D);
+    EXPECT_THAT(GetLowerCase(0xFFFF), 0xFFFF);
+
+    // Whole alphabets.
+    for (KChar ch = 0x0410; ch <= 0x042F; ++ch) {
+        EXPECT_THAT(GetLowerCase(ch), ch + 0x20);
+        EXPECT_THAT(GetUpperCase(ch + 0x20), ch);
+    }
+    for (KChar ch = 0x0391; ch <= 0x03A9; ++ch) {
+        if (ch == 0x03A2) continue;
+        EXPECT_THAT(GetLowerCase(ch), ch + 0x20);
+        EXPECT_THAT(GetUpperCase(ch + 0x20), ch);
+    }
+    // Alternating upper and lower case letters.
+    for (KChar ch = 0x0100; ch < 0x0130; ch += 2) {
+        EXPECT_THAT(GetLowerCase(ch), ch + 1);
+        EXPECT_THAT(GetUpperCase(ch + 1), ch);
+        EXPECT_THAT(GetLowerCase(ch + 1), ch + 1);
+        EXPECT_THAT(GetUpperCase(ch), ch);
+    }
+}
+
+TEST(UnicodeTablesTest, CaseMappingMatchesType) {
+    for (uint32_t i = 0; i <= 0xFFFF; ++i) {
+        KChar ch = static_cast<KChar>(i);
+        if (GetUpperCase(ch) != ch) {
+            // U+0345 COMBINING GREEK YPOGEGRAMMENI is a mark with an upper case mapping.
+            EXPECT_THAT(GetCharType(ch), testing::AnyOf(kLowercaseLetter, kTitlecaseLetter, kLetterNumber, kOtherSymbol, kNonSpacingMark))
+                    << i;
+        }
+        if (GetLowerCase(ch) != ch) {
+            EXPECT_THAT(GetCharType(ch), testing::AnyOf(kUppercaseLetter, kTitlecaseLetter, kLetterNumber, kOtherSymbol)) << i;
+        }
+    }
+}
+
+TEST(UnicodeTablesTest, CanonicalClass) {
+    EXPECT_THAT(GetCanonicalClass('a'), 0);
+    EXPECT_THAT(GetCanonicalClass(0x0300), 230);
+    EXPECT_THAT(GetCanonicalClass(0x0316), 220);
+    EXPECT_THAT(GetCanonicalClass(0x0345), 240);
+    EXPECT_THAT(GetCanonicalClass(0x3099), 8);
+    EXPECT_THAT(GetCanonicalClass(0x4E2D), 0);
+}
+
+TEST(UnicodeTablesTest, Decomposition) {
+    EXPECT_THAT(GetDecompositionIndex('A'), -1);
+    EXPECT_THAT(GetDecompositionIndex(0x00C0), 0); // À is the first decomposable char.
+    EXPECT_THAT(GetDecompositionIndex(0x00C1), 1);
+    EXPECT_THAT(GetDecompositionIndex(0x4E2D), -1);
+    EXPECT_THAT(GetDecompositionIndex(0xAC00), -1); // Hangul syllables are decomposed algorithmically.
+}
+
+// The tables are generated from the ranges, so they must agree on every char.
+TEST(UnicodeTablesTest, MatchesRanges) {
+    for (uint32_t i = 0; i <= 0xFFFF; ++i) {
+        KChar ch = static_cast<KChar>(i);
+        EXPECT_THAT(GetCharType(ch), unicode::GetCharTypeInRanges(ch)) << i;
+        EXPECT_THAT(GetUpperCase(ch), unicode::GetUpperCaseInRanges(ch)) << i;
+        EXPECT_THAT(GetLowerCase(ch), unicode::GetLowerCaseInRanges(ch)) << i;
+        EXPECT_THAT(GetCanonicalClass(ch), unicode::GetCanonicalClassInRanges(ch)) << i;
+        EXPECT_THAT(GetDecompositionIndex(ch), unicode::GetDecompositionIndexInRanges(ch)) << i;
+    }
+}
@@ -16,7 +16,9 @@
 
 #include "Weak.h"
 
+#include "Atomic.h"
 #include "Memory.h"
+#include "Mutex.hpp"
 #include "Types.h"
 
 namespace {
@@ -25,7 +27,8 @@ namespace {
 struct WeakReferenceCounter {
   ObjHeader header;
   KRef referred;
-  KInt lock;
+  // Number of threads currently materializing `referred`.
+  KInt readers;
   KInt cookie;
 };
 
@@ -33,20 +36,6 @@ inline WeakReferenceCounter* asWeakReferenceCounter(ObjHeader* obj) {
   return reinterpret_cast<WeakReferenceCounter*>(obj);
 }
 
-#if !KONAN_NO_THREADS
-
-inline void lock(int32_t* address) {
-    RuntimeAssert(*address == 0 || *address == 1, "Incorrect lock state");
-    while (__sync_val_compare_and_swap(address, 0, 1) == 1);
-}
-
-inline void unlock(int32_t* address) {
-    int old = __sync_val_compare_and_swap(address, 1, 0);
-    RuntimeAssert(old == 1, "Incorrect lock state");
-}
-
-#endif
-
 }  // namespace
 
 extern "C" {
@@ -79,27 +68,43 @@ OBJ_GETTER(Konan_getWeakReferenceImpl, ObjHeader* referred) {
 }
 
 // Materialize a weak reference to either null or the real reference.
+//
+// Readers never block each other: a reader announces itself in `readers` and then loads `referred`,
+// while `WeakReferenceCounterClear` first nulls `referred` and then waits for the announced readers to leave.
+// Both sides use sequentially consistent operations, so either the reader observes null, or the clearing
+// thread observes the reader and lets it finish retaining the object before it gets deallocated.
 OBJ_GETTER(Konan_WeakReferenceCounter_get, ObjHeader* counter) {
-  ObjHeader** referredAddress = &asWeakReferenceCounter(counter)->referred;
+  auto* weakCounter = asWeakReferenceCounter(counter);
+  ObjHeader** referredAddress = &weakCounter->referred;
 #if KONAN_NO_THREADS
   RETURN_OBJ(*referredAddress);
 #else
-  auto* weakCounter = asWeakReferenceCounter(counter);
-  RETURN_RESULT_OF(ReadHeapRefLocked, referredAddress,  &weakCounter->lock,  &weakCounter->cookie);
+  // Fast path for a cleared reference, does not touch the shared readers counter.
+  if (atomicGet(referredAddress) == nullptr) RETURN_OBJ(nullptr);
+  atomicAdd(&weakCounter->readers, 1);
+  if (atomicGet(referredAddress) == nullptr) {
+    atomicAdd(&weakCounter->readers, -1);
+    RETURN_OBJ(nullptr);
+  }
+  ObjHeader* result = ReadHeapRefUnlocked(referredAddress, &weakCounter->cookie, OBJ_RESULT);
+  atomicAdd(&weakCounter->readers, -1);
+  return result;
 #endif
 }
 
 void WeakReferenceCounterClear(ObjHeader* counter) {
-  ObjHeader** referredAddress = &asWeakReferenceCounter(counter)->referred;
+  auto* weakCounter = asWeakReferenceCounter(counter);
+  ObjHeader** referredAddress = &weakCounter->referred;
   // Note, that we don't do UpdateRef here, as reference is weak.
 #if KONAN_NO_THREADS
   *referredAddress = nullptr;
 #else
-  int32_t* lockAddress = &asWeakReferenceCounter(counter)->lock;
-  // Spinlock.
-  lock(lockAddress);
-  *referredAddress = nullptr;
-  unlock(lockAddress);
+  atomicSet(referredAddress, static_cast<ObjHeader*>(nullptr));
+  // Readers that have seen the old value are retaining it right now, wait for them.
+  kotlin::SpinBackoff backoff;
+  while (atomicGet(&weakCounter->readers) != 0) {
+    backoff.Wait();
+  }
 #endif
 }
 
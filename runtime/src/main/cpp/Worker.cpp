@@ -22,6 +22,8 @@
 #include <string.h>
 #include <stdio.h>
 
+#include <algorithm>
+
 #if WITH_WORKERS
 #include <pthread.h>
 #include "PthreadUtils.h"
@@ -31,8 +33,11 @@
 #include "Exceptions.h"
 #include "KAssert.h"
 #include "Memory.h"
+#include "Natives.h"
 #include "ObjCMMAPI.h"
 #include "Runtime.h"
+#include "TimerWheel.hpp"
+#include "Tracing.hpp"
 #include "Types.h"
 #include "Worker.h"
 
@@ -70,6 +75,7 @@ enum JobKind {
   // processed for APIs returning request process status.
   JOB_REGULAR = 2,
   JOB_EXECUTE_AFTER = 3,
+  JOB_EXECUTE_BATCH = 4,
 };
 
 enum class WorkerKind {
@@ -96,17 +102,17 @@ struct Job {
       KNativePtr operation;
       uint64_t whenExecute;
     } executeAfter;
-  };
-};
 
-struct JobCompare {
-  bool operator() (const Job& lhs, const Job& rhs) const {
-    RuntimeAssert(lhs.kind == JOB_EXECUTE_AFTER && rhs.kind == JOB_EXECUTE_AFTER, "Must be delayed jobs");
-    return lhs.executeAfter.whenExecute < rhs.executeAfter.whenExecute;
-  }
+    struct {
+      KNativePtr* operations;
+      KInt count;
+    } executeBatch;
+  };
 };
 
-typedef KStdOrderedSet<Job, JobCompare> DelayedJobSet;
+// Services may keep tens of thousands of pending timeouts, so delayed jobs are kept in a timer wheel
+// rather than in an ordered tree: insertion does not rebalance and, once warmed up, does not allocate.
+typedef kotlin::TimerWheel<Job> DelayedJobSet;
 
 }  // namespace
 
@@ -115,6 +121,7 @@ class Worker {
   Worker(KInt id, bool errorReporting, KRef customName, WorkerKind kind)
       : id_(id),
         kind_(kind),
+        delayed_(konan::getTimeMicros()),
         errorReporting_(errorReporting) {
     name_ = customName != nullptr ? CreateStablePointer(customName) : nullptr;
     pthread_mutex_init(&lock_, nullptr);
@@ -138,6 +145,8 @@ class Worker {
 
   JobKind processQueueElement(bool blocking);
 
+  void executeOperation(KNativePtr operation);
+
   bool park(KLong timeoutMicroseconds, bool process);
 
   KInt id() const { return id_; }
@@ -197,6 +206,48 @@ class Locker {
   pthread_mutex_t* lock_;
 };
 
+// A thread waiting for completion of any future from a particular set. Unlike waiters of
+// `State::waitForAnyFuture`, it is only woken up by the futures it is registered in.
+class FutureWaiter {
+ public:
+  FutureWaiter() {
+    pthread_mutex_init(&lock_, nullptr);
+    pthread_cond_init(&cond_, nullptr);
+  }
+
+  ~FutureWaiter() {
+    pthread_mutex_destroy(&lock_);
+    pthread_cond_destroy(&cond_);
+  }
+
+  void signal() {
+    Locker locker(&lock_);
+    signalled_ = true;
+    pthread_cond_signal(&cond_);
+  }
+
+  // Returns `true` if signalled before `millis` passed. Negative `millis` means no timeout.
+  bool wait(KInt millis) {
+    Locker locker(&lock_);
+    if (millis < 0) {
+      while (!signalled_) pthread_cond_wait(&cond_, &lock_);
+      return true;
+    }
+    uint64_t deadline = konan::getTimeMicros() + millis * 1000LL;
+    while (!signalled_) {
+      uint64_t now = konan::getTimeMicros();
+      if (now >= deadline) break;
+      WaitOnCondVar(&cond_, &lock_, (deadline - now) * 1000LL);
+    }
+    return signalled_;
+  }
+
+ private:
+  pthread_mutex_t lock_;
+  pthread_cond_t cond_;
+  bool signalled_ = false;
+};
+
 class Future {
  public:
   Future(KInt id) : state_(SCHEDULED), id_(id) {
@@ -236,6 +287,19 @@ class Future {
 
   void cancelUnlocked();
 
+  // Registers `waiter` to be signalled on completion, unless the future is already completed.
+  // Returns the state of the future.
+  KInt addWaiterUnlocked(FutureWaiter* waiter) {
+    Locker locker(&lock_);
+    if (state_ == SCHEDULED) waiters_.push_back(waiter);
+    return state_;
+  }
+
+  void removeWaiterUnlocked(FutureWaiter* waiter) {
+    Locker locker(&lock_);
+    waiters_.erase(std::remove(waiters_.begin(), waiters_.end(), waiter), waiters_.end());
+  }
+
   // Those are called with the lock taken.
   KInt state() const { return state_; }
   KInt id() const { return id_; }
@@ -250,6 +314,15 @@ class Future {
   // Lock and condition for waiting on the future.
   pthread_mutex_t lock_;
   pthread_cond_t cond_;
+  // Waiters of `waitForFutures` registered in this future. Signalled and cleared on completion.
+  KStdVector<FutureWaiter*> waiters_;
+
+  void signalWaitersLocked() {
+    for (auto* waiter : waiters_) {
+      waiter->signal();
+    }
+    waiters_.clear();
+  }
 };
 
 class State {
@@ -376,6 +449,24 @@ class State {
       return true;
   }
 
+  bool scheduleJobBatchInWorkerUnlocked(KInt id, KNativePtr* operationStablePtrs, KInt count) {
+      Worker* worker = nullptr;
+      Locker locker(&lock_);
+
+      auto it = workers_.find(id);
+      if (it == workers_.end()) {
+          return false;
+      }
+      worker = it->second;
+
+      Job job;
+      job.kind = JOB_EXECUTE_BATCH;
+      job.executeBatch.operations = operationStablePtrs;
+      job.executeBatch.count = count;
+      worker->putJob(job, false);
+      return true;
+  }
+
   // Returns `true` if something was indeed processed.
   bool processQueueUnlocked(KInt id) {
     // Can only process queue of the current worker.
@@ -438,22 +529,66 @@ class State {
     Locker locker(&lock_);
     if (version != currentVersion_) return false;
 
+    anyFutureWaiters_++;
     if (millis < 0) {
       pthread_cond_wait(&cond_, &lock_);
-      return true;
+    } else {
+      uint64_t nsDelta = millis * 1000000LL;
+      WaitOnCondVar(&cond_, &lock_, nsDelta);
     }
-
-    uint64_t nsDelta = millis * 1000000LL;
-    WaitOnCondVar(&cond_, &lock_, nsDelta);
+    anyFutureWaiters_--;
     return true;
   }
 
   void signalAnyFuture() {
+    bool hasWaiters = false;
     {
       Locker locker(&lock_);
       currentVersion_++;
+      hasWaiters = anyFutureWaiters_ != 0;
     }
-    pthread_cond_broadcast(&cond_);
+    // A waiter registers itself under the lock before checking the version, so it cannot be missed here.
+    if (hasWaiters) pthread_cond_broadcast(&cond_);
+  }
+
+  // Waits until any of futures with `ids` is completed. Returns `false` on timeout, or if none of
+  // the futures can complete anymore.
+  KBoolean waitForFuturesUnlocked(const KInt* ids, KInt count, KInt millis) {
+    FutureWaiter waiter;
+    bool registered = false;
+    bool completed = false;
+    {
+      Locker locker(&lock_);
+      for (KInt index = 0; index < count && !completed; index++) {
+        auto it = futures_.find(ids[index]);
+        if (it == futures_.end()) continue;
+        switch (it->second->addWaiterUnlocked(&waiter)) {
+          case SCHEDULED:
+            registered = true;
+            break;
+          case COMPUTED:
+            completed = true;
+            break;
+          default:
+            // Cancelled or thrown futures will never complete.
+            break;
+        }
+      }
+    }
+
+    if (registered && !completed) {
+      completed = waiter.wait(millis);
+    }
+
+    if (registered) {
+      // Futures are only destroyed with `lock_` taken, so none can be destroyed while unregistering.
+      Locker locker(&lock_);
+      for (KInt index = 0; index < count; index++) {
+        auto it = futures_.find(ids[index]);
+        if (it != futures_.end()) it->second->removeWaiterUnlocked(&waiter);
+      }
+    }
+    return completed;
   }
 
   KInt versionToken() {
@@ -528,6 +663,8 @@ class State {
   KInt currentWorkerId_;
   KInt currentFutureId_;
   KInt currentVersion_;
+  // Number of threads in `waitForAnyFuture`.
+  KInt anyFutureWaiters_ = 0;
 };
 
 State* theState() {
@@ -557,6 +694,7 @@ void Future::storeResultUnlocked(KNativePtr result, bool ok) {
     // of the taken lock, it's not on macOS (as of 10.13.1). If moved outside of the lock,
     // some notifications are missing.
     pthread_cond_broadcast(&cond_);
+    signalWaitersLocked();
   }
   theState()->signalAnyFuture();
 }
@@ -567,6 +705,7 @@ void Future::cancelUnlocked() {
     state_ = CANCELLED;
     result_ = nullptr;
     pthread_cond_broadcast(&cond_);
+    signalWaitersLocked();
   }
   theState()->signalAnyFuture();
 }
@@ -635,6 +774,11 @@ KInt versionToken() {
   return theState()->versionToken();
 }
 
+KBoolean waitForFutures(KConstRef futureIds, KInt millis) {
+  const ArrayHeader* ids = futureIds->array();
+  return theState()->waitForFuturesUnlocked(IntArrayAddressOfElementAt(ids, 0), ids->count_, millis);
+}
+
 OBJ_GETTER(attachObjectGraphInternal, KNativePtr stable) {
   RETURN_RESULT_OF(AdoptStablePointer, stable);
 }
@@ -699,6 +843,10 @@ KInt versionToken() {
   ThrowWorkerUnsupported();
 }
 
+KBoolean waitForFutures(KConstRef futureIds, KInt millis) {
+  ThrowWorkerUnsupported();
+}
+
 OBJ_GETTER(attachObjectGraphInternal, KNativePtr stable) {
   ThrowWorkerUnsupported();
 }
@@ -763,6 +911,14 @@ bool WorkerSchedule(KInt id, KNativePtr jobStablePtr) {
 #endif // WITH_WORKERS
 }
 
+bool WorkerScheduleBatch(KInt id, KNativePtr* jobStablePtrs, KInt count) {
+#if WITH_WORKERS
+    return theState()->scheduleJobBatchInWorkerUnlocked(id, jobStablePtrs, count);
+#else
+    return false;
+#endif // WITH_WORKERS
+}
+
 #if WITH_WORKERS
 
 Worker::~Worker() {
@@ -778,6 +934,13 @@ Worker::~Worker() {
         DisposeStablePointer(job.executeAfter.operation);
         break;
       }
+      case JOB_EXECUTE_BATCH: {
+        for (KInt index = 0; index < job.executeBatch.count; index++) {
+          DisposeStablePointer(job.executeBatch.operations[index]);
+        }
+        konanFreeMemory(job.executeBatch.operations);
+        break;
+      }
       case JOB_TERMINATE: {
         // TODO: any more processing here?
         job.terminationRequest.future->cancelUnlocked();
@@ -790,10 +953,10 @@ Worker::~Worker() {
     }
   }
 
-  for (auto job : delayed_) {
+  delayed_.ForEach([](Job& job) {
     RuntimeAssert(job.kind == JOB_EXECUTE_AFTER, "Must be delayed");
     DisposeStablePointer(job.executeAfter.operation);
-  }
+  });
 
   if (name_ != nullptr) DisposeStablePointer(name_);
 
@@ -835,13 +998,13 @@ void Worker::putJob(Job job, bool toFront) {
 
 void Worker::putDelayedJob(Job job) {
   Locker locker(&lock_);
-  delayed_.insert(job);
+  delayed_.Insert(job.executeAfter.whenExecute, job);
   pthread_cond_signal(&cond_);
 }
 
 bool Worker::waitDelayed(bool blocking) {
   Locker locker(&lock_);
-  if (delayed_.size() == 0) return false;
+  if (delayed_.empty()) return false;
   if (blocking) waitForQueueLocked(-1, nullptr);
   return true;
 }
@@ -857,20 +1020,19 @@ Job Worker::getJob(bool blocking) {
 }
 
 KLong Worker::checkDelayedLocked() {
-  if (delayed_.size() == 0) {
+  if (delayed_.empty()) {
     return -1;
   }
-  auto it = delayed_.begin();
-  auto job = *it;
-  RuntimeAssert(job.kind == JOB_EXECUTE_AFTER, "Must be delayed job");
   auto now = konan::getTimeMicros();
-  if (job.executeAfter.whenExecute <= now) {
-    delayed_.erase(it);
+  bool expired = false;
+  delayed_.Expire(now, [this, &expired](Job& job) {
+    RuntimeAssert(job.kind == JOB_EXECUTE_AFTER, "Must be delayed job");
     queue_.push_back(job);
-    return 0;
-  } else {
-    return job.executeAfter.whenExecute - now;
-  }
+    expired = true;
+  });
+  if (expired) return 0;
+  // Lower bound of the closest deadline: waking up earlier just advances the wheel.
+  return delayed_.NextDeadline() - now;
 }
 
 bool Worker::waitForQueueLocked(KLong timeoutMicroseconds, KLong* remaining) {
@@ -950,21 +1112,20 @@ JobKind Worker::processQueueElement(bool blocking) {
       break;
     }
     case JOB_EXECUTE_AFTER: {
-      ObjHolder operationHolder, dummyHolder;
-      KRef obj = DerefStablePointer(job.executeAfter.operation, operationHolder.slot());
-      try {
-#if KONAN_OBJC_INTEROP
-        konan::AutoreleasePool autoreleasePool;
-#endif
-        WorkerLaunchpad(obj, dummyHolder.slot());
-      } catch (ExceptionObjHolder& e) {
-        if (errorReporting())
-          ReportUnhandledException(e.obj());
+      kotlin::Tracing::Span span("worker", "executeAfter");
+      executeOperation(job.executeAfter.operation);
+      break;
+    }
+    case JOB_EXECUTE_BATCH: {
+      kotlin::Tracing::Span span("worker", "executeBatch");
+      for (KInt index = 0; index < job.executeBatch.count; index++) {
+        executeOperation(job.executeBatch.operations[index]);
       }
-      DisposeStablePointer(job.executeAfter.operation);
+      konanFreeMemory(job.executeBatch.operations);
       break;
     }
     case JOB_REGULAR: {
+      kotlin::Tracing::Span span("worker", "job");
       KRef argument = AdoptStablePointer(job.regularJob.argument, argumentHolder.slot());
       KNativePtr result = nullptr;
       bool ok = true;
@@ -992,6 +1153,21 @@ JobKind Worker::processQueueElement(bool blocking) {
   return job.kind;
 }
 
+void Worker::executeOperation(KNativePtr operation) {
+  ObjHolder operationHolder, dummyHolder;
+  KRef obj = DerefStablePointer(operation, operationHolder.slot());
+  try {
+#if KONAN_OBJC_INTEROP
+    konan::AutoreleasePool autoreleasePool;
+#endif
+    WorkerLaunchpad(obj, dummyHolder.slot());
+  } catch (ExceptionObjHolder& e) {
+    if (errorReporting())
+      ReportUnhandledException(e.obj());
+  }
+  DisposeStablePointer(operation);
+}
+
 #endif  // WITH_WORKERS
 
 extern "C" {
@@ -1044,6 +1220,10 @@ KInt Kotlin_Worker_versionToken() {
   return versionToken();
 }
 
+KBoolean Kotlin_Worker_waitForFutures(KConstRef futureIds, KInt millis) {
+  return waitForFutures(futureIds, millis);
+}
+
 OBJ_GETTER(Kotlin_Worker_attachObjectGraphInternal, KNativePtr stable) {
   RETURN_RESULT_OF(attachObjectGraphInternal, stable);
 }
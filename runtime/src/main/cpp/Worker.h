@@ -18,5 +18,8 @@ void WaitNativeWorkersTermination();
 void WaitNativeWorkerTermination(KInt id);
 // Schedule the job without the result.
 bool WorkerSchedule(KInt id, KNativePtr jobStablePtr);
+// Schedule `count` jobs without the result as a single queue element. On success takes ownership of
+// `jobStablePtrs`, which must be allocated with `konanAllocArray`.
+bool WorkerScheduleBatch(KInt id, KNativePtr* jobStablePtrs, KInt count);
 
 #endif // RUNTIME_WORKER_H
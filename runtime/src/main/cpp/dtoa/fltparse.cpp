@@ -540,12 +540,17 @@ OutOfMemory:
 extern "C" KFloat
 Kotlin_native_FloatingPointParser_parseFloatImpl(KString s, KInt e)
 {
-  const KChar* utf16 = CharArrayAddressOfElementAt(s, 0);
+  uint32_t length = StringLength(s);
   KStdString utf8;
-  utf8.reserve(s->count_);
-  TRY_CATCH(utf8::utf16to8(utf16, utf16 + s->count_, back_inserter(utf8)),
-            utf8::unchecked::utf16to8(utf16, utf16 + s->count_, back_inserter(utf8)),
-            /* Illegal UTF-16 string. */ ThrowNumberFormatException());
+  utf8.reserve(length);
+  if (IsLatin1String(s)) {
+    Latin1ToUtf8(Latin1StringAddressOfElementAt(s, 0), length, &utf8);
+  } else {
+    const KChar* utf16 = CharArrayAddressOfElementAt(s, 0);
+    TRY_CATCH(utf8::utf16to8(utf16, utf16 + length, back_inserter(utf8)),
+              utf8::unchecked::utf16to8(utf16, utf16 + length, back_inserter(utf8)),
+              /* Illegal UTF-16 string. */ ThrowNumberFormatException());
+  }
   const char *str = utf8.c_str();
   auto flt = createFloat(str, e);
 
@@ -124,10 +124,10 @@ public actual fun ByteArray.asList(): List<Byte> {
     return object : AbstractList<Byte>(), RandomAccess {
         override val size: Int get() = this@asList.size
         override fun isEmpty(): Boolean = this@asList.isEmpty()
-        override fun contains(element: Byte): Boolean = this@asList.contains(element)
+        override fun contains(element: Byte): Boolean = arrayIndexOf(this@asList, element) >= 0
         override fun get(index: Int): Byte = this@asList[index]
-        override fun indexOf(element: Byte): Int = this@asList.indexOf(element)
-        override fun lastIndexOf(element: Byte): Int = this@asList.lastIndexOf(element)
+        override fun indexOf(element: Byte): Int = arrayIndexOf(this@asList, element)
+        override fun lastIndexOf(element: Byte): Int = arrayLastIndexOf(this@asList, element)
     }
 }
 
@@ -138,10 +138,10 @@ public actual fun ShortArray.asList(): List<Short> {
     return object : AbstractList<Short>(), RandomAccess {
         override val size: Int get() = this@asList.size
         override fun isEmpty(): Boolean = this@asList.isEmpty()
-        override fun contains(element: Short): Boolean = this@asList.contains(element)
+        override fun contains(element: Short): Boolean = arrayIndexOf(this@asList, element) >= 0
         override fun get(index: Int): Short = this@asList[index]
-        override fun indexOf(element: Short): Int = this@asList.indexOf(element)
-        override fun lastIndexOf(element: Short): Int = this@asList.lastIndexOf(element)
+        override fun indexOf(element: Short): Int = arrayIndexOf(this@asList, element)
+        override fun lastIndexOf(element: Short): Int = arrayLastIndexOf(this@asList, element)
     }
 }
 
@@ -152,10 +152,10 @@ public actual fun IntArray.asList(): List<Int> {
     return object : AbstractList<Int>(), RandomAccess {
         override val size: Int get() = this@asList.size
         override fun isEmpty(): Boolean = this@asList.isEmpty()
-        override fun contains(element: Int): Boolean = this@asList.contains(element)
+        override fun contains(element: Int): Boolean = arrayIndexOf(this@asList, element) >= 0
         override fun get(index: Int): Int = this@asList[index]
-        override fun indexOf(element: Int): Int = this@asList.indexOf(element)
-        override fun lastIndexOf(element: Int): Int = this@asList.lastIndexOf(element)
+        override fun indexOf(element: Int): Int = arrayIndexOf(this@asList, element)
+        override fun lastIndexOf(element: Int): Int = arrayLastIndexOf(this@asList, element)
     }
 }
 
@@ -166,10 +166,10 @@ public actual fun LongArray.asList(): List<Long> {
     return object : AbstractList<Long>(), RandomAccess {
         override val size: Int get() = this@asList.size
         override fun isEmpty(): Boolean = this@asList.isEmpty()
-        override fun contains(element: Long): Boolean = this@asList.contains(element)
+        override fun contains(element: Long): Boolean = arrayIndexOf(this@asList, element) >= 0
         override fun get(index: Int): Long = this@asList[index]
-        override fun indexOf(element: Long): Int = this@asList.indexOf(element)
-        override fun lastIndexOf(element: Long): Int = this@asList.lastIndexOf(element)
+        override fun indexOf(element: Long): Int = arrayIndexOf(this@asList, element)
+        override fun lastIndexOf(element: Long): Int = arrayLastIndexOf(this@asList, element)
     }
 }
 
@@ -180,10 +180,10 @@ public actual fun FloatArray.asList(): List<Float> {
     return object : AbstractList<Float>(), RandomAccess {
         override val size: Int get() = this@asList.size
         override fun isEmpty(): Boolean = this@asList.isEmpty()
-        override fun contains(element: Float): Boolean = this@asList.any { it.toBits() == element.toBits() }
+        override fun contains(element: Float): Boolean = arrayIndexOf(this@asList, element) >= 0
         override fun get(index: Int): Float = this@asList[index]
-        override fun indexOf(element: Float): Int = this@asList.indexOfFirst { it.toBits() == element.toBits() }
-        override fun lastIndexOf(element: Float): Int = this@asList.indexOfLast { it.toBits() == element.toBits() }
+        override fun indexOf(element: Float): Int = arrayIndexOf(this@asList, element)
+        override fun lastIndexOf(element: Float): Int = arrayLastIndexOf(this@asList, element)
     }
 }
 
@@ -194,10 +194,10 @@ public actual fun DoubleArray.asList(): List<Double> {
     return object : AbstractList<Double>(), RandomAccess {
         override val size: Int get() = this@asList.size
         override fun isEmpty(): Boolean = this@asList.isEmpty()
-        override fun contains(element: Double): Boolean = this@asList.any { it.toBits() == element.toBits() }
+        override fun contains(element: Double): Boolean = arrayIndexOf(this@asList, element) >= 0
         override fun get(index: Int): Double = this@asList[index]
-        override fun indexOf(element: Double): Int = this@asList.indexOfFirst { it.toBits() == element.toBits() }
-        override fun lastIndexOf(element: Double): Int = this@asList.indexOfLast { it.toBits() == element.toBits() }
+        override fun indexOf(element: Double): Int = arrayIndexOf(this@asList, element)
+        override fun lastIndexOf(element: Double): Int = arrayLastIndexOf(this@asList, element)
     }
 }
 
@@ -208,10 +208,10 @@ public actual fun BooleanArray.asList(): List<Boolean> {
     return object : AbstractList<Boolean>(), RandomAccess {
         override val size: Int get() = this@asList.size
         override fun isEmpty(): Boolean = this@asList.isEmpty()
-        override fun contains(element: Boolean): Boolean = this@asList.contains(element)
+        override fun contains(element: Boolean): Boolean = arrayIndexOf(this@asList, element) >= 0
         override fun get(index: Int): Boolean = this@asList[index]
-        override fun indexOf(element: Boolean): Int = this@asList.indexOf(element)
-        override fun lastIndexOf(element: Boolean): Int = this@asList.lastIndexOf(element)
+        override fun indexOf(element: Boolean): Int = arrayIndexOf(this@asList, element)
+        override fun lastIndexOf(element: Boolean): Int = arrayLastIndexOf(this@asList, element)
     }
 }
 
@@ -222,10 +222,10 @@ public actual fun CharArray.asList(): List<Char> {
     return object : AbstractList<Char>(), RandomAccess {
         override val size: Int get() = this@asList.size
         override fun isEmpty(): Boolean = this@asList.isEmpty()
-        override fun contains(element: Char): Boolean = this@asList.contains(element)
+        override fun contains(element: Char): Boolean = arrayIndexOf(this@asList, element) >= 0
         override fun get(index: Int): Char = this@asList[index]
-        override fun indexOf(element: Char): Int = this@asList.indexOf(element)
-        override fun lastIndexOf(element: Char): Int = this@asList.lastIndexOf(element)
+        override fun indexOf(element: Char): Int = arrayIndexOf(this@asList, element)
+        override fun lastIndexOf(element: Char): Int = arrayLastIndexOf(this@asList, element)
     }
 }
 
@@ -469,11 +469,7 @@ public actual infix fun <T> Array<out T>?.contentEquals(other: Array<out T>?): B
 public actual infix fun ByteArray?.contentEquals(other: ByteArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -487,11 +483,7 @@ public actual infix fun ByteArray?.contentEquals(other: ByteArray?): Boolean {
 public actual infix fun ShortArray?.contentEquals(other: ShortArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -505,11 +497,7 @@ public actual infix fun ShortArray?.contentEquals(other: ShortArray?): Boolean {
 public actual infix fun IntArray?.contentEquals(other: IntArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -523,11 +511,7 @@ public actual infix fun IntArray?.contentEquals(other: IntArray?): Boolean {
 public actual infix fun LongArray?.contentEquals(other: LongArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -541,11 +525,7 @@ public actual infix fun LongArray?.contentEquals(other: LongArray?): Boolean {
 public actual infix fun FloatArray?.contentEquals(other: FloatArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (!this[i].equals(other[i])) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -559,11 +539,7 @@ public actual infix fun FloatArray?.contentEquals(other: FloatArray?): Boolean {
 public actual infix fun DoubleArray?.contentEquals(other: DoubleArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (!this[i].equals(other[i])) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -577,11 +553,7 @@ public actual infix fun DoubleArray?.contentEquals(other: DoubleArray?): Boolean
 public actual infix fun BooleanArray?.contentEquals(other: BooleanArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -595,11 +567,7 @@ public actual infix fun BooleanArray?.contentEquals(other: BooleanArray?): Boole
 public actual infix fun CharArray?.contentEquals(other: CharArray?): Boolean {
     if (this === other) return true
     if (this === null || other === null) return false
-    if (size != other.size) return false
-    for (i in indices) {
-        if (this[i] != other[i]) return false
-    }
-    return true
+    return arrayContentEquals(this, other)
 }
 
 /**
@@ -710,10 +678,7 @@ public actual fun <T> Array<out T>?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun ByteArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -722,10 +687,7 @@ public actual fun ByteArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun ShortArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -734,10 +696,7 @@ public actual fun ShortArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun IntArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -746,10 +705,7 @@ public actual fun IntArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun LongArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -758,10 +714,7 @@ public actual fun LongArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun FloatArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -770,10 +723,7 @@ public actual fun FloatArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun DoubleArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -782,10 +732,7 @@ public actual fun DoubleArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun BooleanArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -794,10 +741,7 @@ public actual fun BooleanArray?.contentHashCode(): Int {
 @SinceKotlin("1.4")
 public actual fun CharArray?.contentHashCode(): Int {
     if (this === null) return 0
-    var result = 1
-    for (element in this)
-        result = 31 * result + element.hashCode()
-    return result
+    return arrayContentHashCode(this)
 }
 
 /**
@@ -26,8 +26,14 @@ public open class Throwable(open val message: String?, open val cause: Throwable
 
     constructor() : this(null, null)
 
+    init {
+        // The runtime keeps the frame addresses, the array is only created when the stack trace is requested.
+        captureStackTrace(this)
+    }
+
     @get:ExportForCppRuntime("Kotlin_Throwable_getStackTrace")
-    private val stackTrace: NativePtrArray = getCurrentStackTrace()
+    private val stackTrace: NativePtrArray
+        get() = getStackTraceAddresses(this)
 
     private val stackTraceStrings: Array<String> by lazy {
         getStackTraceStrings(stackTrace).freeze()
@@ -39,8 +45,10 @@ public open class Throwable(open val message: String?, open val cause: Throwable
      */
     public fun getStackTrace(): Array<String> = stackTraceStrings
 
-    internal fun getStackTraceAddressesInternal(): List<Long> =
-            (0 until stackTrace.size).map { index -> stackTrace[index].toLong() }
+    internal fun getStackTraceAddressesInternal(): List<Long> {
+        val stackTrace = stackTrace
+        return (0 until stackTrace.size).map { index -> stackTrace[index].toLong() }
+    }
 
     /**
      * Prints the [detailed description][Throwable.stackTraceToString] of this throwable to the standard output.
@@ -139,8 +147,11 @@ public open class Throwable(open val message: String?, open val cause: Throwable
     internal var suppressedExceptionsList: MutableList<Throwable>? = null
 }
 
-@SymbolName("Kotlin_getCurrentStackTrace")
-private external fun getCurrentStackTrace(): NativePtrArray
+@SymbolName("Kotlin_Throwable_captureStackTrace")
+private external fun captureStackTrace(throwable: Throwable)
+
+@SymbolName("Kotlin_Throwable_getStackTraceAddresses")
+private external fun getStackTraceAddresses(throwable: Throwable): NativePtrArray
 
 @SymbolName("Kotlin_getStackTraceStrings")
 private external fun getStackTraceStrings(stackTrace: NativePtrArray): Array<String>
@@ -152,6 +152,101 @@ internal external fun arrayCopy(array: DoubleArray, fromIndex: Int, destination:
 @SymbolName("Kotlin_BooleanArray_copyImpl")
 internal external fun arrayCopy(array: BooleanArray, fromIndex: Int, destination: BooleanArray, toIndex: Int, count: Int)
 
+@SymbolName("Kotlin_ByteArray_contentEquals")
+internal external fun arrayContentEquals(array: ByteArray, other: ByteArray): Boolean
+
+@SymbolName("Kotlin_ShortArray_contentEquals")
+internal external fun arrayContentEquals(array: ShortArray, other: ShortArray): Boolean
+
+@SymbolName("Kotlin_CharArray_contentEquals")
+internal external fun arrayContentEquals(array: CharArray, other: CharArray): Boolean
+
+@SymbolName("Kotlin_IntArray_contentEquals")
+internal external fun arrayContentEquals(array: IntArray, other: IntArray): Boolean
+
+@SymbolName("Kotlin_LongArray_contentEquals")
+internal external fun arrayContentEquals(array: LongArray, other: LongArray): Boolean
+
+@SymbolName("Kotlin_FloatArray_contentEquals")
+internal external fun arrayContentEquals(array: FloatArray, other: FloatArray): Boolean
+
+@SymbolName("Kotlin_DoubleArray_contentEquals")
+internal external fun arrayContentEquals(array: DoubleArray, other: DoubleArray): Boolean
+
+@SymbolName("Kotlin_BooleanArray_contentEquals")
+internal external fun arrayContentEquals(array: BooleanArray, other: BooleanArray): Boolean
+
+@SymbolName("Kotlin_ByteArray_contentHashCode")
+internal external fun arrayContentHashCode(array: ByteArray): Int
+
+@SymbolName("Kotlin_ShortArray_contentHashCode")
+internal external fun arrayContentHashCode(array: ShortArray): Int
+
+@SymbolName("Kotlin_CharArray_contentHashCode")
+internal external fun arrayContentHashCode(array: CharArray): Int
+
+@SymbolName("Kotlin_IntArray_contentHashCode")
+internal external fun arrayContentHashCode(array: IntArray): Int
+
+@SymbolName("Kotlin_LongArray_contentHashCode")
+internal external fun arrayContentHashCode(array: LongArray): Int
+
+@SymbolName("Kotlin_FloatArray_contentHashCode")
+internal external fun arrayContentHashCode(array: FloatArray): Int
+
+@SymbolName("Kotlin_DoubleArray_contentHashCode")
+internal external fun arrayContentHashCode(array: DoubleArray): Int
+
+@SymbolName("Kotlin_BooleanArray_contentHashCode")
+internal external fun arrayContentHashCode(array: BooleanArray): Int
+
+@SymbolName("Kotlin_ByteArray_indexOf")
+internal external fun arrayIndexOf(array: ByteArray, element: Byte): Int
+
+@SymbolName("Kotlin_ShortArray_indexOf")
+internal external fun arrayIndexOf(array: ShortArray, element: Short): Int
+
+@SymbolName("Kotlin_CharArray_indexOf")
+internal external fun arrayIndexOf(array: CharArray, element: Char): Int
+
+@SymbolName("Kotlin_IntArray_indexOf")
+internal external fun arrayIndexOf(array: IntArray, element: Int): Int
+
+@SymbolName("Kotlin_LongArray_indexOf")
+internal external fun arrayIndexOf(array: LongArray, element: Long): Int
+
+@SymbolName("Kotlin_FloatArray_indexOf")
+internal external fun arrayIndexOf(array: FloatArray, element: Float): Int
+
+@SymbolName("Kotlin_DoubleArray_indexOf")
+internal external fun arrayIndexOf(array: DoubleArray, element: Double): Int
+
+@SymbolName("Kotlin_BooleanArray_indexOf")
+internal external fun arrayIndexOf(array: BooleanArray, element: Boolean): Int
+
+@SymbolName("Kotlin_ByteArray_lastIndexOf")
+internal external fun arrayLastIndexOf(array: ByteArray, element: Byte): Int
+
+@SymbolName("Kotlin_ShortArray_lastIndexOf")
+internal external fun arrayLastIndexOf(array: ShortArray, element: Short): Int
+
+@SymbolName("Kotlin_CharArray_lastIndexOf")
+internal external fun arrayLastIndexOf(array: CharArray, element: Char): Int
+
+@SymbolName("Kotlin_IntArray_lastIndexOf")
+internal external fun arrayLastIndexOf(array: IntArray, element: Int): Int
+
+@SymbolName("Kotlin_LongArray_lastIndexOf")
+internal external fun arrayLastIndexOf(array: LongArray, element: Long): Int
+
+@SymbolName("Kotlin_FloatArray_lastIndexOf")
+internal external fun arrayLastIndexOf(array: FloatArray, element: Float): Int
+
+@SymbolName("Kotlin_DoubleArray_lastIndexOf")
+internal external fun arrayLastIndexOf(array: DoubleArray, element: Double): Int
+
+@SymbolName("Kotlin_BooleanArray_lastIndexOf")
+internal external fun arrayLastIndexOf(array: BooleanArray, element: Boolean): Int
 
 internal fun <E> Collection<E>.collectionToString(): String {
     val sb = StringBuilder(2 + size * 3)
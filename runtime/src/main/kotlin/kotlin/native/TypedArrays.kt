@@ -85,6 +85,84 @@ public external fun ByteArray.getFloatAt(index: Int): Float
 @SymbolName("Kotlin_ByteArray_getDoubleAt")
 public external fun ByteArray.getDoubleAt(index: Int): Double
 
+/**
+ * Reads [count] [Char] values out of the [ByteArray] byte buffer starting from index [index]
+ * into [destination] starting from [destinationOffset], all at once.
+ * @throws ArrayIndexOutOfBoundsException if the range is outside of either array boundaries.
+ */
+public fun ByteArray.getCharsAt(index: Int, destination: CharArray,
+        destinationOffset: Int = 0, count: Int = destination.size - destinationOffset) {
+    getCharsAtImpl(index, destination, destinationOffset, count)
+}
+
+@SymbolName("Kotlin_ByteArray_getCharsAt")
+private external fun ByteArray.getCharsAtImpl(index: Int, destination: CharArray, destinationOffset: Int, count: Int)
+
+/**
+ * Reads [count] [Short] values out of the [ByteArray] byte buffer starting from index [index]
+ * into [destination] starting from [destinationOffset], all at once.
+ * @throws ArrayIndexOutOfBoundsException if the range is outside of either array boundaries.
+ */
+public fun ByteArray.getShortsAt(index: Int, destination: ShortArray,
+        destinationOffset: Int = 0, count: Int = destination.size - destinationOffset) {
+    getShortsAtImpl(index, destination, destinationOffset, count)
+}
+
+@SymbolName("Kotlin_ByteArray_getShortsAt")
+private external fun ByteArray.getShortsAtImpl(index: Int, destination: ShortArray, destinationOffset: Int, count: Int)
+
+/**
+ * Reads [count] [Int] values out of the [ByteArray] byte buffer starting from index [index]
+ * into [destination] starting from [destinationOffset], all at once.
+ * @throws ArrayIndexOutOfBoundsException if the range is outside of either array boundaries.
+ */
+public fun ByteArray.getIntsAt(index: Int, destination: IntArray,
+        destinationOffset: Int = 0, count: Int = destination.size - destinationOffset) {
+    getIntsAtImpl(index, destination, destinationOffset, count)
+}
+
+@SymbolName("Kotlin_ByteArray_getIntsAt")
+private external fun ByteArray.getIntsAtImpl(index: Int, destination: IntArray, destinationOffset: Int, count: Int)
+
+/**
+ * Reads [count] [Long] values out of the [ByteArray] byte buffer starting from index [index]
+ * into [destination] starting from [destinationOffset], all at once.
+ * @throws ArrayIndexOutOfBoundsException if the range is outside of either array boundaries.
+ */
+public fun ByteArray.getLongsAt(index: Int, destination: LongArray,
+        destinationOffset: Int = 0, count: Int = destination.size - destinationOffset) {
+    getLongsAtImpl(index, destination, destinationOffset, count)
+}
+
+@SymbolName("Kotlin_ByteArray_getLongsAt")
+private external fun ByteArray.getLongsAtImpl(index: Int, destination: LongArray, destinationOffset: Int, count: Int)
+
+/**
+ * Reads [count] [Float] values out of the [ByteArray] byte buffer starting from index [index]
+ * into [destination] starting from [destinationOffset], all at once.
+ * @throws ArrayIndexOutOfBoundsException if the range is outside of either array boundaries.
+ */
+public fun ByteArray.getFloatsAt(index: Int, destination: FloatArray,
+        destinationOffset: Int = 0, count: Int = destination.size - destinationOffset) {
+    getFloatsAtImpl(index, destination, destinationOffset, count)
+}
+
+@SymbolName("Kotlin_ByteArray_getFloatsAt")
+private external fun ByteArray.getFloatsAtImpl(index: Int, destination: FloatArray, destinationOffset: Int, count: Int)
+
+/**
+ * Reads [count] [Double] values out of the [ByteArray] byte buffer starting from index [index]
+ * into [destination] starting from [destinationOffset], all at once.
+ * @throws ArrayIndexOutOfBoundsException if the range is outside of either array boundaries.
+ */
+public fun ByteArray.getDoublesAt(index: Int, destination: DoubleArray,
+        destinationOffset: Int = 0, count: Int = destination.size - destinationOffset) {
+    getDoublesAtImpl(index, destination, destinationOffset, count)
+}
+
+@SymbolName("Kotlin_ByteArray_getDoublesAt")
+private external fun ByteArray.getDoublesAtImpl(index: Int, destination: DoubleArray, destinationOffset: Int, count: Int)
+
 /**
  * Sets [UByte] out of the [ByteArray] byte buffer at specified index [index]
  * @throws ArrayIndexOutOfBoundsException if [index] is outside of array boundaries.
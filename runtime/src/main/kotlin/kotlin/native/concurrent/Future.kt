@@ -82,17 +82,17 @@ public fun <T> Collection<Future<T>>.waitForMultipleFutures(millis: Int): Set<Fu
 public fun <T> waitForMultipleFutures(futures: Collection<Future<T>>, timeoutMillis: Int): Set<Future<T>> {
     val result = mutableSetOf<Future<T>>()
 
-    while (true) {
-        val versionToken = versionToken()
-        for (future in futures) {
-            if (future.state == FutureState.COMPUTED) {
-                result += future
-            }
+    for (future in futures) {
+        if (future.state == FutureState.COMPUTED) {
+            result += future
         }
-        if (result.isNotEmpty()) return result
-
-        if (waitForAnyFuture(versionToken, timeoutMillis)) break
     }
+    if (result.isNotEmpty()) return result
+
+    // Only completion of one of `futures` wakes us up, not completion of any future in the process.
+    val ids = IntArray(futures.size)
+    futures.forEachIndexed { index, future -> ids[index] = future.id }
+    waitForFutures(ids, timeoutMillis)
 
     for (future in futures) {
         if (future.state == FutureState.COMPUTED) {
@@ -101,4 +101,4 @@ public fun <T> waitForMultipleFutures(futures: Collection<Future<T>>, timeoutMil
     }
 
     return result
-}
\ No newline at end of file
+}
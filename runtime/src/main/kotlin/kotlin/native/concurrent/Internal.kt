@@ -28,6 +28,9 @@ external internal fun waitForAnyFuture(versionToken: Int, millis: Int): Boolean
 @SymbolName("Kotlin_Worker_versionToken")
 external internal fun versionToken(): Int
 
+@SymbolName("Kotlin_Worker_waitForFutures")
+external internal fun waitForFutures(futureIds: IntArray, millis: Int): Boolean
+
 @kotlin.native.internal.ExportForCompiler
 internal fun executeImpl(worker: Worker, mode: TransferMode, producer: () -> Any?,
                          job: CPointer<CFunction<*>>): Future<Any?> =
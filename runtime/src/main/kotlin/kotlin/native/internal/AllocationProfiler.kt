@@ -0,0 +1,56 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package kotlin.native.internal
+
+/**
+ * Sampling profiler of Kotlin heap allocations.
+ *
+ * When started, about one allocation per [samplingIntervalBytes] allocated bytes is sampled together with its stack
+ * and type. The samples are written with [writeProfile] in the [pprof](https://github.com/google/pprof) format,
+ * scaled to estimate all the allocations, so the profile can be analyzed with `pprof` and compatible tools.
+ * Allocation stacks are symbolized if the binary has debug info, otherwise `pprof` can symbolize them with the binary.
+ */
+object AllocationProfiler {
+    /**
+     * Starts sampling allocations, keeping the samples collected so far.
+     * Smaller [samplingIntervalBytes] give more precise profiles at the cost of more overhead.
+     */
+    fun start(samplingIntervalBytes: Long = 512 * 1024) {
+        require(samplingIntervalBytes > 0) { "Sampling interval must be positive: $samplingIntervalBytes" }
+        startImpl(samplingIntervalBytes)
+    }
+
+    /**
+     * Stops sampling allocations, keeping the samples collected so far.
+     */
+    @SymbolName("Kotlin_AllocationProfiler_stop")
+    external fun stop()
+
+    /**
+     * Drops the samples collected so far.
+     */
+    @SymbolName("Kotlin_AllocationProfiler_clear")
+    external fun clear()
+
+    /**
+     * Whether allocations are being sampled.
+     */
+    val isEnabled: Boolean
+        get() = isEnabledImpl()
+
+    /**
+     * Writes the samples collected so far into the file at [path] in the pprof format.
+     * Returns `false` if the file couldn't be written.
+     */
+    @SymbolName("Kotlin_AllocationProfiler_writeProfile")
+    external fun writeProfile(path: String): Boolean
+
+    @SymbolName("Kotlin_AllocationProfiler_start")
+    private external fun startImpl(samplingIntervalBytes: Long)
+
+    @SymbolName("Kotlin_AllocationProfiler_isEnabled")
+    private external fun isEnabledImpl(): Boolean
+}
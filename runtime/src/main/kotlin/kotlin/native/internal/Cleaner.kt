@@ -88,26 +88,62 @@ fun <T> createCleaner(argument: T, block: (T) -> Unit): Cleaner {
 }
 
 /**
- * Perform GC on a worker that executes Cleaner blocks.
+ * Number of workers that execute Cleaner blocks, `1` by default.
+ *
+ * Blocks of cleaners deallocated together are executed in batches, which are distributed between the workers.
+ * Can only be changed before the first cleaner is created.
+ *
+ * @throws IllegalStateException if cleaner workers are already started.
+ */
+@ExperimentalStdlibApi
+public var cleanerWorkerCount: Int
+    get() = getCleanerWorkerCount()
+    set(value) {
+        require(value in 1..MAX_CLEANER_WORKER_COUNT) { "Cleaner worker count must be in 1..$MAX_CLEANER_WORKER_COUNT" }
+        check(setCleanerWorkerCount(value)) { "Cleaner workers are already started" }
+    }
+
+// Must match `kMaxCleanerWorkerCount` in Cleaner.h
+private const val MAX_CLEANER_WORKER_COUNT = 16
+
+/**
+ * Perform GC on workers that execute Cleaner blocks.
  */
 @InternalForKotlinNative
-fun performGCOnCleanerWorker() =
-    getCleanerWorker().execute(TransferMode.SAFE, {}) {
+fun performGCOnCleanerWorker() = forEachCleanerWorker {
+    it.execute(TransferMode.SAFE, {}) {
         GC.collect()
     }.result
+}
 
 /**
- * Wait for a worker that executes Cleaner blocks to complete its scheduled tasks.
+ * Wait for workers that execute Cleaner blocks to complete their scheduled tasks.
  */
 @InternalForKotlinNative
-fun waitCleanerWorker() =
-    getCleanerWorker().execute(TransferMode.SAFE, {}) {
+fun waitCleanerWorker() = forEachCleanerWorker {
+    it.execute(TransferMode.SAFE, {}) {
         Unit
     }.result
+}
+
+private inline fun forEachCleanerWorker(block: (Worker) -> Unit) {
+    for (index in 0 until getCleanerWorkerCount()) {
+        block(getCleanerWorkerAt(index))
+    }
+}
 
 @SymbolName("Kotlin_CleanerImpl_getCleanerWorker")
 external private fun getCleanerWorker(): Worker
 
+@SymbolName("Kotlin_CleanerImpl_getCleanerWorkerCount")
+external private fun getCleanerWorkerCount(): Int
+
+@SymbolName("Kotlin_CleanerImpl_getCleanerWorkerAt")
+external private fun getCleanerWorkerAt(index: Int): Worker
+
+@SymbolName("Kotlin_CleanerImpl_setCleanerWorkerCount")
+external private fun setCleanerWorkerCount(count: Int): Boolean
+
 @ExportForCppRuntime("Kotlin_CleanerImpl_shutdownCleanerWorker")
 private fun shutdownCleanerWorker(worker: Worker, executeScheduledCleaners: Boolean) {
     worker.requestTermination(executeScheduledCleaners).result
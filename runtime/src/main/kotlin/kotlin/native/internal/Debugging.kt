@@ -11,6 +11,18 @@ public object Debugging {
     public var forceCheckedShutdown: Boolean
         get() = Debugging_getForceCheckedShutdown()
         set(value) = Debugging_setForceCheckedShutdown(value)
+
+    /**
+     * Maximum number of frames captured when a [Throwable] is created, [Int.MAX_VALUE] (unlimited) by default.
+     * Deeper stack traces are truncated to the limit.
+     * `0` disables capturing stack traces, which makes exceptions used for control flow cheaper.
+     */
+    public var stackTraceDepthLimit: Int
+        get() = Debugging_getStackTraceDepthLimit()
+        set(value) {
+            require(value >= 0) { "Stack trace depth limit must not be negative: $value" }
+            Debugging_setStackTraceDepthLimit(value)
+        }
 }
 
 @SymbolName("Kotlin_Debugging_getForceCheckedShutdown")
@@ -18,3 +30,9 @@ private external fun Debugging_getForceCheckedShutdown(): Boolean
 
 @SymbolName("Kotlin_Debugging_setForceCheckedShutdown")
 private external fun Debugging_setForceCheckedShutdown(value: Boolean): Unit
+
+@SymbolName("Kotlin_Debugging_getStackTraceDepthLimit")
+private external fun Debugging_getStackTraceDepthLimit(): Int
+
+@SymbolName("Kotlin_Debugging_setStackTraceDepthLimit")
+private external fun Debugging_setStackTraceDepthLimit(value: Int): Unit
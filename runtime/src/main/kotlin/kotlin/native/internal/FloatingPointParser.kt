@@ -49,6 +49,22 @@ private external fun parseDoubleImpl(s: String, e: Int): Double
 @SymbolName("Kotlin_native_FloatingPointParser_parseFloatImpl")
 private external fun parseFloatImpl(s: String, e: Int): Float
 
+/**
+ * Parses a plain decimal number, like "-3.14" or "6.02e23", without allocations.
+ *
+ * @return the double closest to the real number, or NaN if the string must be parsed with [FloatingPointParser.parseDouble]
+ */
+@SymbolName("Kotlin_native_FloatingPointParser_tryParseDouble")
+private external fun tryParseDouble(s: String): Double
+
+/**
+ * Parses a plain decimal number, like "-3.14" or "6.02e23", without allocations.
+ *
+ * @return the float closest to the real number, or NaN if the string must be parsed with [FloatingPointParser.parseFloat]
+ */
+@SymbolName("Kotlin_native_FloatingPointParser_tryParseFloat")
+private external fun tryParseFloat(s: String): Float
+
 /**
  * Used to parse a string and return either a single or double precision
  * floating point number.
@@ -293,6 +309,11 @@ object FloatingPointParser {
      * @exception NumberFormatException if the String doesn't represent a double
      */
     fun parseDouble(string: String): Double {
+        val fast = tryParseDouble(string)
+        if (!fast.isNaN()) {
+            return fast
+        }
+
         var s = string
         s = s.trim { it <= ' ' }
         val length = s.length
@@ -340,6 +361,11 @@ object FloatingPointParser {
      * @exception NumberFormatException if the String doesn't represent a float
      */
     fun parseFloat(string: String): Float {
+        val fast = tryParseFloat(string)
+        if (!fast.isNaN()) {
+            return fast
+        }
+
         var s = string
         s = s.trim { it <= ' ' }
         val length = s.length
@@ -100,6 +100,27 @@ object GC {
         get() = getCyclicCollectorEnabled()
         set(value) = setCyclicCollectorEnabled(value)
 
+    /**
+     * Generational mode of the experimental memory manager: a thread frequently collects the objects it has recently
+     * allocated, without stopping other threads. Pauses of these minor collections are counted in [MemoryStatistics].
+     * The default memory manager doesn't support it: it's always `false` there, and enabling it
+     * throws [IllegalArgumentException].
+     */
+    var generational: Boolean
+        get() = getGenerational()
+        set(value) = setGenerational(value)
+
+    /**
+     * Number of bytes a thread allocates in [generational] mode before a minor collection,
+     * `-1` if the memory manager doesn't support the mode.
+     */
+    var nurserySize: Long
+        get() = getNurserySize()
+        set(value) {
+            require(value > 0) { "nurserySize must be positive: $value" }
+            setNurserySize(value)
+        }
+
     /**
      * Detect cyclic references going via atomic references and return list of cycle-inducing objects
      * or `null` if the leak detector is not available. Use [Platform.isMemoryLeakCheckerActive] to check
@@ -138,6 +159,18 @@ object GC {
     @SymbolName("Kotlin_native_internal_GC_setTuneThreshold")
     private external fun setTuneThreshold(value: Boolean)
 
+    @SymbolName("Kotlin_native_internal_GC_getGenerational")
+    private external fun getGenerational(): Boolean
+
+    @SymbolName("Kotlin_native_internal_GC_setGenerational")
+    private external fun setGenerational(value: Boolean)
+
+    @SymbolName("Kotlin_native_internal_GC_getNurserySize")
+    private external fun getNurserySize(): Long
+
+    @SymbolName("Kotlin_native_internal_GC_setNurserySize")
+    private external fun setNurserySize(value: Long)
+
     @SymbolName("Kotlin_native_internal_GC_getCyclicCollector")
     private external fun getCyclicCollectorEnabled(): Boolean
 
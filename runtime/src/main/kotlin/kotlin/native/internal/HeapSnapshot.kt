@@ -0,0 +1,25 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package kotlin.native.internal
+
+/**
+ * Heap snapshots for finding what retains memory.
+ *
+ * A snapshot has the roots and the objects with their types, sizes and references. It's analyzed with
+ * `tools/heapSnapshotAnalyzer`, which computes the dominator tree of the heap and reports the objects and
+ * the types retaining most memory.
+ */
+object HeapSnapshot {
+    /**
+     * Writes a snapshot of the heap into the file at [path]. Returns `false` if the file couldn't be written.
+     *
+     * With the legacy memory manager, only the objects reachable from the current thread's stack and thread local
+     * storage, the globals and the stable references are written. With the experimental one, all the objects are written, and the unreachable ones are garbage
+     * not collected yet.
+     */
+    @SymbolName("Kotlin_HeapSnapshot_dump")
+    external fun dump(path: String): Boolean
+}
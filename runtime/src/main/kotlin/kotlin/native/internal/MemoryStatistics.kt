@@ -0,0 +1,147 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package kotlin.native.internal
+
+/**
+ * Process-wide counters of the memory manager.
+ *
+ * The counters are always collected and cheap to read. They are updated concurrently by all the threads,
+ * so values read one after another are not a consistent snapshot.
+ */
+object MemoryStatistics {
+    /**
+     * Number of allocation size classes. Size class `i` counts allocations of up to `16 shl i` bytes,
+     * the last one counts all the bigger allocations.
+     */
+    const val sizeClassCount: Int = 18
+
+    /**
+     * Number of GC pause histogram buckets. Bucket `i` counts pauses shorter than `1 shl i` microseconds,
+     * the last one counts all the longer pauses.
+     */
+    const val gcPauseBucketCount: Int = 24
+
+    /** Number of objects allocated in [sizeClass]. */
+    @SymbolName("Kotlin_MemoryStatistics_getAllocationCount")
+    external fun allocationCount(sizeClass: Int): Long
+
+    /** Number of bytes allocated in [sizeClass], including the memory manager headers. */
+    @SymbolName("Kotlin_MemoryStatistics_getAllocatedBytes")
+    external fun allocatedBytes(sizeClass: Int): Long
+
+    /** Number of garbage collections performed. */
+    val gcCount: Long
+        get() = getGcCount()
+
+    /** Total time spent in garbage collection pauses, in microseconds. */
+    val gcPauseMicroseconds: Long
+        get() = getGcPauseMicroseconds()
+
+    /** The longest garbage collection pause, in microseconds. */
+    val gcMaxPauseMicroseconds: Long
+        get() = getGcMaxPauseMicroseconds()
+
+    /** Number of garbage collection pauses in histogram [bucket]. */
+    @SymbolName("Kotlin_MemoryStatistics_getGcPauseCount")
+    external fun gcPauseCount(bucket: Int): Long
+
+    /** Number of minor collections performed in [GC.generational] mode. They are not counted in [gcCount]. */
+    val minorGcCount: Long
+        get() = getMinorGcCount()
+
+    /** Total time spent in minor collection pauses, in microseconds. */
+    val minorGcPauseMicroseconds: Long
+        get() = getMinorGcPauseMicroseconds()
+
+    /** The longest minor collection pause, in microseconds. */
+    val minorGcMaxPauseMicroseconds: Long
+        get() = getMinorGcMaxPauseMicroseconds()
+
+    /** Number of bytes of young objects freed by minor collections. */
+    val minorGcFreedBytes: Long
+        get() = getMinorGcFreedBytes()
+
+    /** Number of bytes of young objects that survived minor collections. */
+    val minorGcPromotedBytes: Long
+        get() = getMinorGcPromotedBytes()
+
+    /** Number of garbage cycles collected by the cycle collector. */
+    val collectedCycles: Long
+        get() = getCollectedCycles()
+
+    /** Length of the finalizer queue seen by the last garbage collection. */
+    val finalizerQueueLength: Long
+        get() = getFinalizerQueueLength()
+
+    /** The longest finalizer queue seen by a garbage collection. */
+    val finalizerQueueMaxLength: Long
+        get() = getFinalizerQueueMaxLength()
+
+    /** Number of live stable references. */
+    val stableRefs: Long
+        get() = getStableRefs()
+
+    /** Number of bytes of objects frozen so far, cumulative: freeing frozen objects doesn't decrease it. */
+    val frozenBytes: Long
+        get() = getFrozenBytes()
+
+    /**
+     * Returns all the counters as a JSON object.
+     */
+    @SymbolName("Kotlin_MemoryStatistics_toJson")
+    external fun toJson(): String
+
+    /**
+     * Writes [toJson] output into the file at [path]. Returns `false` if the file couldn't be written.
+     */
+    @SymbolName("Kotlin_MemoryStatistics_dumpJson")
+    external fun dumpJson(path: String): Boolean
+
+    /**
+     * Sets the file to write [toJson] output into on runtime shutdown. `null`, the default, disables the dump.
+     */
+    @SymbolName("Kotlin_MemoryStatistics_setDumpOnExitPath")
+    external fun setDumpOnExitPath(path: String?)
+
+    @SymbolName("Kotlin_MemoryStatistics_getGcCount")
+    private external fun getGcCount(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getGcPauseMicroseconds")
+    private external fun getGcPauseMicroseconds(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getGcMaxPauseMicroseconds")
+    private external fun getGcMaxPauseMicroseconds(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getMinorGcCount")
+    private external fun getMinorGcCount(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getMinorGcPauseMicroseconds")
+    private external fun getMinorGcPauseMicroseconds(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getMinorGcMaxPauseMicroseconds")
+    private external fun getMinorGcMaxPauseMicroseconds(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getMinorGcFreedBytes")
+    private external fun getMinorGcFreedBytes(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getMinorGcPromotedBytes")
+    private external fun getMinorGcPromotedBytes(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getCollectedCycles")
+    private external fun getCollectedCycles(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getFinalizerQueueLength")
+    private external fun getFinalizerQueueLength(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getFinalizerQueueMaxLength")
+    private external fun getFinalizerQueueMaxLength(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getStableRefs")
+    private external fun getStableRefs(): Long
+
+    @SymbolName("Kotlin_MemoryStatistics_getFrozenBytes")
+    private external fun getFrozenBytes(): Long
+}
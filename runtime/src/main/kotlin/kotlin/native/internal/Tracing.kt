@@ -0,0 +1,49 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package kotlin.native.internal
+
+/**
+ * Tracing of the runtime work: GC phases, worker jobs and freezing.
+ *
+ * When started, each thread records the spans of this work, keeping the most recent ones. [writeTrace] writes them
+ * on one timeline in the Chrome trace event JSON format, which opens in [Perfetto](https://ui.perfetto.dev)
+ * and `chrome://tracing`.
+ */
+object Tracing {
+    /**
+     * Starts recording, keeping the spans recorded so far.
+     */
+    @SymbolName("Kotlin_Tracing_start")
+    external fun start()
+
+    /**
+     * Stops recording, keeping the spans recorded so far.
+     */
+    @SymbolName("Kotlin_Tracing_stop")
+    external fun stop()
+
+    /**
+     * Drops the spans recorded so far.
+     */
+    @SymbolName("Kotlin_Tracing_clear")
+    external fun clear()
+
+    /**
+     * Whether the spans are being recorded.
+     */
+    val isEnabled: Boolean
+        get() = isEnabledImpl()
+
+    /**
+     * Writes the recorded spans into the file at [path] as trace event JSON.
+     * Returns `false` if the file couldn't be written.
+     */
+    @SymbolName("Kotlin_Tracing_writeTrace")
+    external fun writeTrace(path: String): Boolean
+
+    @SymbolName("Kotlin_Tracing_isEnabled")
+    private external fun isEnabledImpl(): Boolean
+}
@@ -37,8 +37,8 @@ import kotlin.native.internal.Escapes
 @NoReorderFields
 @Frozen
 internal class WeakReferenceCounter(var referred: COpaquePointer?) : WeakReferenceImpl() {
-    // Spinlock, potentially taken when materializing or removing 'referred' object.
-    var lock: Int = 0
+    // Number of threads materializing 'referred' object, awaited when removing it.
+    var readers: Int = 0
 
     // Optimization for concurrent access.
     var cookie: Int = 0
@@ -153,14 +153,18 @@ actual class StringBuilder private constructor (
      */
     // TODO: optimize those!
     actual fun append(value: Boolean): StringBuilder = append(value.toString())
-    fun append(value: Byte): StringBuilder = append(value.toString())
-    fun append(value: Short): StringBuilder = append(value.toString())
+    fun append(value: Byte): StringBuilder = append(value.toInt())
+    fun append(value: Short): StringBuilder = append(value.toInt())
     fun append(value: Int): StringBuilder {
         ensureExtraCapacity(11)
         _length += insertInt(array, _length, value)
         return this
     }
-    fun append(value: Long): StringBuilder = append(value.toString())
+    fun append(value: Long): StringBuilder {
+        ensureExtraCapacity(20)
+        _length += insertLong(array, _length, value)
+        return this
+    }
     fun append(value: Float): StringBuilder = append(value.toString())
     fun append(value: Double): StringBuilder = append(value.toString())
 
@@ -150,7 +150,7 @@ open internal class DecomposedCharSet(
 
     override fun first(set: AbstractSet): Boolean {
         return if (set is DecomposedCharSet)
-            set.decomposedChar.contentEquals(decomposedChar)
+            arrayContentEquals(set.decomposedChar, decomposedChar)
         else
             true
     }
@@ -5,6 +5,7 @@
 
 #include "ExtraObjectData.hpp"
 
+#include "Exceptions.h"
 #include "PointerBits.h"
 #include "Weak.h"
 
@@ -69,6 +70,7 @@ mm::ExtraObjectData::~ExtraObjectData() {
         WeakReferenceCounterClear(weakReferenceCounter_);
         ZeroHeapRef(&weakReferenceCounter_);
     }
+    DestroyCapturedStackTrace(stackTrace_);
 
 #ifdef KONAN_OBJC_INTEROP
     Kotlin_ObjCExport_releaseAssociatedObject(associatedObject_);
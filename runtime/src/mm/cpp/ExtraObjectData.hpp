@@ -32,6 +32,10 @@ public:
 
     ObjHeader** GetWeakCounterLocation() noexcept { return &weakReferenceCounter_; }
 
+    int32_t* GetIdentityHashLocation() noexcept { return &identityHash_; }
+
+    void** GetStackTraceLocation() noexcept { return &stackTrace_; }
+
 private:
     explicit ExtraObjectData(const TypeInfo* typeInfo) noexcept : typeInfo_(typeInfo) {}
     ~ExtraObjectData();
@@ -43,8 +47,12 @@ private:
     void* associatedObject_ = nullptr;
 #endif
 
-    // TODO: Need to respect when marking.
+    // Marked with the object, see `MarkAndSweep`.
     ObjHeader* weakReferenceCounter_ = nullptr;
+
+    int32_t identityHash_ = 0;
+
+    void* stackTrace_ = nullptr;
 };
 
 } // namespace mm
@@ -11,6 +11,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "IdentityHash.hpp"
 #include "TestSupport.hpp"
 
 using namespace kotlin;
@@ -35,6 +36,25 @@ TEST(ExtraObjectDataTest, Install) {
     EXPECT_THAT(object.type_info(), &typeInfo);
 }
 
+TEST(ExtraObjectDataTest, IdentityHash) {
+    TypeInfo typeInfo;
+    typeInfo.typeInfo_ = &typeInfo;
+    ObjHeader object;
+    object.typeInfoOrMeta_ = &typeInfo;
+
+    int32_t hash = IdentityHashCode(&object);
+
+    ASSERT_TRUE(object.has_meta_object());
+    auto& extraData = mm::ExtraObjectData::FromMetaObjHeader(object.meta_object());
+    EXPECT_THAT(*extraData.GetIdentityHashLocation(), hash);
+    EXPECT_THAT(IdentityHashCode(&object), hash);
+    // The stored hash is kept regardless of the address.
+    *extraData.GetIdentityHashLocation() = 42;
+    EXPECT_THAT(IdentityHashCode(&object), 42);
+
+    mm::ExtraObjectData::Uninstall(&object);
+}
+
 TEST(ExtraObjectDataTest, ConcurrentInstall) {
     TypeInfo typeInfo;
     typeInfo.typeInfo_ = &typeInfo;
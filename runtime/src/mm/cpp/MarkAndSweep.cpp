@@ -0,0 +1,88 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "MarkAndSweep.hpp"
+
+#include <algorithm>
+
+#include "ExtraObjectData.hpp"
+#include "ObjectTraversal.hpp"
+#include "Tracing.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+ObjHeader* ObjectOf(mm::ObjectFactory::Iterator& it) noexcept {
+    return it.IsArray() ? it.GetArrayHeader()->obj() : it.GetObjHeader();
+}
+
+} // namespace
+
+// static
+std::atomic<size_t> mm::MarkAndSweep::promotedBytes_{0};
+
+// static
+std::atomic<size_t> mm::MarkAndSweep::threshold_{mm::MarkAndSweep::kMinThreshold};
+
+// static
+bool mm::MarkAndSweep::OnPromotion(size_t bytes) noexcept {
+    return promotedBytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes >= threshold_.load(std::memory_order_relaxed);
+}
+
+void mm::MarkAndSweep::Mark(ObjHeader* root) noexcept {
+    MarkOne(root);
+    while (!worklist_.empty()) {
+        ObjHeader* object = worklist_.back();
+        worklist_.pop_back();
+        TraverseReferenceFields(object, [this](uint32_t, ObjHeader* const* location) { MarkOne(*location); });
+        // The counter only refers to `object` by a raw pointer, and dies with it.
+        if (object->has_meta_object()) {
+            MarkOne(*ExtraObjectData::FromMetaObjHeader(object->meta_object()).GetWeakCounterLocation());
+        }
+    }
+}
+
+mm::MarkAndSweep::CollectionStatistics mm::MarkAndSweep::Sweep(ObjectFactory& objectFactory) noexcept {
+    Tracing::Span span("gc", "sweep");
+    auto objects = objectFactory.Iter();
+
+    // A meta object may refer to another unmarked object, e.g. the weak reference counter, so none of them is freed yet.
+    for (auto it = objects.begin(); it != objects.end(); ++it) {
+        ObjHeader* object = ObjectOf(it);
+        if ((ObjectFactory::GCFlags(object).load(std::memory_order_relaxed) & kMarked) == 0 && object->has_meta_object()) {
+            ObjHeader::destroyMetaObject(object);
+        }
+    }
+
+    CollectionStatistics statistics;
+    for (auto it = objects.begin(); it != objects.end();) {
+        ObjHeader* object = ObjectOf(it);
+        auto& flags = ObjectFactory::GCFlags(object);
+        size_t size = ObjectFactory::GetAllocatedSize(object);
+        if ((flags.load(std::memory_order_relaxed) & kMarked) != 0) {
+            flags.fetch_and(~kMarked, std::memory_order_relaxed);
+            ++statistics.aliveObjects;
+            statistics.aliveBytes += size;
+            ++it;
+        } else {
+            ++statistics.freedObjects;
+            statistics.freedBytes += size;
+            objects.EraseAndAdvance(it);
+        }
+    }
+
+    promotedBytes_.store(0, std::memory_order_relaxed);
+    threshold_.store(std::max(kMinThreshold, statistics.aliveBytes), std::memory_order_relaxed);
+    return statistics;
+}
+
+void mm::MarkAndSweep::MarkOne(ObjHeader* object) noexcept {
+    if (object == nullptr || object->permanent() || object->local()) return;
+    auto& flags = ObjectFactory::GCFlags(object);
+    if ((flags.load(std::memory_order_relaxed) & kMarked) != 0) return;
+    flags.fetch_or(kMarked, std::memory_order_relaxed);
+    worklist_.push_back(object);
+}
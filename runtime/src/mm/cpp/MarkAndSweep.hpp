@@ -0,0 +1,67 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_MM_MARK_AND_SWEEP_H
+#define RUNTIME_MM_MARK_AND_SWEEP_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Memory.h"
+#include "ObjectFactory.hpp"
+#include "Types.h"
+#include "Utils.hpp"
+
+namespace kotlin {
+namespace mm {
+
+// Major collection: frees the published objects of an `ObjectFactory` that are not reachable from the roots.
+// Objects are not moved, see `Nursery`.
+//
+// The caller must make sure the heap doesn't change while collecting: all the threads have published their objects and
+// don't run Kotlin code. A weak reference counter is reachable from its referent, and the meta objects of the unreachable
+// objects are destroyed before any of them is freed, which clears their weak references.
+class MarkAndSweep : private Pinned {
+public:
+    // `ObjectFactory::GCFlags` of the objects, next to the `Nursery` ones.
+    static constexpr uint32_t kMarked = 1 << 2;
+
+    // The least size of the objects promoted by minor collections that triggers a major one.
+    static constexpr size_t kMinThreshold = 16 * 1024 * 1024;
+
+    struct CollectionStatistics {
+        size_t freedObjects = 0;
+        size_t freedBytes = 0;
+        size_t aliveObjects = 0;
+        size_t aliveBytes = 0;
+    };
+
+    // Called after a minor collection promoted `bytes`. Whether enough were promoted since the last major collection
+    // to do another one: as many as were alive after it, but at least `kMinThreshold`.
+    static bool OnPromotion(size_t bytes) noexcept;
+
+    MarkAndSweep() noexcept = default;
+
+    // Marks the heap objects reachable from `root`. Permanent and stack-allocated objects are skipped: stack-allocated
+    // roots must be traversed by the caller, see `ShadowStack::TraverseObjects`.
+    void Mark(ObjHeader* root) noexcept;
+
+    // Frees the objects of `objectFactory` that are not marked, and unmarks the rest.
+    CollectionStatistics Sweep(ObjectFactory& objectFactory) noexcept;
+
+private:
+    static std::atomic<size_t> promotedBytes_;
+    static std::atomic<size_t> threshold_;
+
+    void MarkOne(ObjHeader* object) noexcept;
+
+    KStdVector<ObjHeader*> worklist_;
+};
+
+} // namespace mm
+} // namespace kotlin
+
+#endif // RUNTIME_MM_MARK_AND_SWEEP_H
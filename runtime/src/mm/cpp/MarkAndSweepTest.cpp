@@ -0,0 +1,209 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "MarkAndSweep.hpp"
+
+#include <array>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "ExtraObjectData.hpp"
+#include "MemoryStatistics.hpp"
+#include "Nursery.hpp"
+#include "Types.h"
+#include "Utils.hpp"
+
+using namespace kotlin;
+
+using mm::MarkAndSweep;
+using mm::Nursery;
+using mm::ObjectFactory;
+
+namespace {
+
+struct Node {
+    ObjHeader header;
+    ObjHeader* next;
+};
+
+const int32_t kNodeOffsets[] = {offsetof(Node, next)};
+
+KStdUniquePtr<TypeInfo> MakeNodeTypeInfo() {
+    auto typeInfo = make_unique<TypeInfo>();
+    typeInfo->typeInfo_ = typeInfo.get();
+    typeInfo->instanceSize_ = sizeof(Node);
+    typeInfo->objOffsets_ = kNodeOffsets;
+    typeInfo->objOffsetsCount_ = 1;
+    return typeInfo;
+}
+
+ObjHeader*& NextOf(ObjHeader* object) {
+    return reinterpret_cast<Node*>(object)->next;
+}
+
+// A frame with a single local, like the compiler creates.
+class StackFrame : private Pinned {
+public:
+    explicit StackFrame(mm::ShadowStack& shadowStack) : shadowStack_(shadowStack) {
+        data_.fill(nullptr);
+        shadowStack_.EnterFrame(data_.data(), 0, kTotalCount);
+    }
+
+    ~StackFrame() { shadowStack_.LeaveFrame(data_.data(), 0, kTotalCount); }
+
+    ObjHeader*& local() { return data_[kFrameOverlayCount]; }
+
+private:
+    static inline constexpr int kFrameOverlayCount = sizeof(FrameOverlay) / sizeof(ObjHeader**);
+    static inline constexpr int kTotalCount = kFrameOverlayCount + 1;
+
+    mm::ShadowStack& shadowStack_;
+    std::array<ObjHeader*, kTotalCount> data_;
+};
+
+class MarkAndSweepTest : public testing::Test {
+public:
+    ~MarkAndSweepTest() override {
+        Nursery::SetEnabled(false);
+        MemoryStatistics::Instance().ResetForTests();
+    }
+
+    ObjHeader* Allocate() { return threadQueue_.CreateObject(typeInfo_.get()); }
+
+    MarkAndSweep::CollectionStatistics Sweep() {
+        threadQueue_.Publish();
+        return markAndSweep_.Sweep(objectFactory_);
+    }
+
+    KStdVector<ObjHeader*> Published() {
+        KStdVector<ObjHeader*> result;
+        auto iter = objectFactory_.Iter();
+        for (auto it = iter.begin(); it != iter.end(); ++it) {
+            result.push_back(it.GetObjHeader());
+        }
+        return result;
+    }
+
+protected:
+    KStdUniquePtr<TypeInfo> typeInfo_ = MakeNodeTypeInfo();
+    ObjectFactory objectFactory_;
+    ObjectFactory::ThreadQueue threadQueue_{objectFactory_};
+    MarkAndSweep markAndSweep_;
+};
+
+} // namespace
+
+TEST_F(MarkAndSweepTest, FreesUnreachable) {
+    auto* head = Allocate();
+    auto* garbage = Allocate();
+    auto* next = Allocate();
+    NextOf(head) = next;
+    NextOf(garbage) = next;
+    markAndSweep_.Mark(head);
+    markAndSweep_.Mark(nullptr);
+
+    auto statistics = Sweep();
+    EXPECT_THAT(statistics.freedObjects, 1);
+    EXPECT_THAT(statistics.freedBytes, sizeof(Node));
+    EXPECT_THAT(statistics.aliveObjects, 2);
+    EXPECT_THAT(statistics.aliveBytes, 2 * sizeof(Node));
+    EXPECT_THAT(Published(), testing::ElementsAre(head, next));
+    EXPECT_THAT(ObjectFactory::GCFlags(head).load() & MarkAndSweep::kMarked, 0);
+    EXPECT_THAT(ObjectFactory::GCFlags(next).load() & MarkAndSweep::kMarked, 0);
+}
+
+TEST_F(MarkAndSweepTest, FreesUnreachableCycles) {
+    auto* root = Allocate();
+    auto* first = Allocate();
+    auto* second = Allocate();
+    NextOf(root) = root;
+    NextOf(first) = second;
+    NextOf(second) = first;
+    markAndSweep_.Mark(root);
+
+    auto statistics = Sweep();
+    EXPECT_THAT(statistics.freedObjects, 2);
+    EXPECT_THAT(Published(), testing::ElementsAre(root));
+
+    // Nothing is marked from the previous collection.
+    statistics = Sweep();
+    EXPECT_THAT(statistics.freedObjects, 1);
+    EXPECT_THAT(Published(), testing::IsEmpty());
+}
+
+TEST_F(MarkAndSweepTest, StackAllocatedObjectsAreSkipped) {
+    Node local = {};
+    local.header.typeInfoOrMeta_ = setPointerBits(typeInfo_.get(), OBJECT_TAG_PERMANENT_CONTAINER | OBJECT_TAG_NONTRIVIAL_CONTAINER);
+    ASSERT_TRUE(local.header.local());
+    local.next = Allocate();
+    markAndSweep_.Mark(&local.header);
+
+    auto statistics = Sweep();
+    EXPECT_THAT(statistics.freedObjects, 1);
+    EXPECT_THAT(Published(), testing::IsEmpty());
+}
+
+TEST_F(MarkAndSweepTest, WeakReferenceCounter) {
+    auto* referent = Allocate();
+    auto* counter = Allocate();
+    auto* garbageReferent = Allocate();
+    auto* garbageCounter = Allocate();
+    *mm::ExtraObjectData::Install(referent).GetWeakCounterLocation() = counter;
+    *mm::ExtraObjectData::Install(garbageReferent).GetWeakCounterLocation() = garbageCounter;
+    markAndSweep_.Mark(referent);
+
+    auto statistics = Sweep();
+    EXPECT_THAT(statistics.freedObjects, 2);
+    EXPECT_THAT(Published(), testing::ElementsAre(referent, counter));
+    EXPECT_TRUE(referent->has_meta_object());
+
+    mm::ExtraObjectData::Uninstall(referent);
+}
+
+TEST_F(MarkAndSweepTest, Threshold) {
+    Sweep();
+    EXPECT_FALSE(MarkAndSweep::OnPromotion(MarkAndSweep::kMinThreshold - 1));
+    EXPECT_TRUE(MarkAndSweep::OnPromotion(1));
+
+    Sweep();
+    EXPECT_FALSE(MarkAndSweep::OnPromotion(1));
+}
+
+// A promoted object is collected by the major collection, and the young objects stored into it survive the minor ones.
+TEST_F(MarkAndSweepTest, FreesPromoted) {
+    Nursery nursery;
+    mm::ShadowStack shadowStack;
+    mm::ThreadLocalStorage tls;
+    tls.Commit();
+    Nursery::SetEnabled(true);
+    auto allocate = [&]() {
+        auto* object = Allocate();
+        nursery.OnAllocation(object, ObjectFactory::GetAllocatedSize(object));
+        return object;
+    };
+
+    ObjHeader* promoted = nullptr;
+    {
+        StackFrame frame(shadowStack);
+        promoted = allocate();
+        frame.local() = promoted;
+        auto statistics = nursery.Collect(threadQueue_, shadowStack, tls);
+        EXPECT_THAT(statistics.promotedObjects, 1);
+    }
+    auto* young = allocate();
+    allocate();
+    nursery.Remember(&NextOf(promoted), young);
+    NextOf(promoted) = young;
+
+    auto minorStatistics = nursery.Collect(threadQueue_, shadowStack, tls);
+    EXPECT_THAT(minorStatistics.freedObjects, 1);
+    EXPECT_THAT(minorStatistics.promotedObjects, 1);
+    EXPECT_THAT(Published(), testing::ElementsAre(promoted, young));
+
+    auto statistics = Sweep();
+    EXPECT_THAT(statistics.freedObjects, 2);
+    EXPECT_THAT(Published(), testing::IsEmpty());
+}
@@ -5,10 +5,19 @@
 
 #include "Memory.h"
 
+#include <cstring>
+
+#include "AllocationProfiler.hpp"
 #include "Exceptions.h"
 #include "ExtraObjectData.hpp"
 #include "GlobalsRegistry.hpp"
+#include "HeapSnapshot.hpp"
 #include "KAssert.h"
+#include "MarkAndSweep.hpp"
+#include "MemoryStatistics.hpp"
+#include "Mutex.hpp"
+#include "Natives.h"
+#include "Nursery.hpp"
 #include "Porting.h"
 #include "StableRefRegistry.hpp"
 #include "ThreadData.hpp"
@@ -57,12 +66,92 @@ ALWAYS_INLINE mm::ThreadData* GetThreadData(MemoryState* state) {
     return FromMemoryState(state)->Get();
 }
 
+// Stack-allocated objects die with their frames, the compiler must not let them escape.
+void CheckNotStackAllocated(const ObjHeader* object, const char* operation) {
+    if (object == nullptr || !object->local()) return;
+    konan::consolePrintf("Attempt to %s a stack object %p\n", operation, object);
+    konan::consolePrintf("This is a compiler bug, please report it to https://kotl.in/issue\n");
+    konan::abort();
+}
+
+// The write barrier of the generational mode.
+ALWAYS_INLINE void RememberHeapStore(ObjHeader** location, const ObjHeader* object) {
+    if (mm::Nursery::IsYoung(object)) {
+        mm::ThreadRegistry::Instance().CurrentThreadData()->nursery().Remember(location, object);
+    }
+}
+
+// Frees the objects that are not reachable from the roots.
+// TODO: Stop the other threads at safepoints once the compiler emits them. Until then, nothing is collected while
+// there are other registered threads.
+void CollectGarbage(mm::ThreadData* threadData) {
+    auto threads = mm::ThreadRegistry::Instance().Iter();
+    for (auto& thread : threads) {
+        if (&thread != threadData) return;
+    }
+    uint64_t startMicros = konan::getTimeMicros();
+
+    // Unreachable young objects are freed by the sweep too.
+    threadData->nursery().Promote(threadData->objectFactoryThreadQueue());
+    mm::GlobalsRegistry::Instance().ProcessThread(threadData);
+    mm::StableRefRegistry::Instance().ProcessThread(threadData);
+    mm::StableRefRegistry::Instance().ProcessDeletions();
+
+    mm::MarkAndSweep markAndSweep;
+    threadData->shadowStack().TraverseObjects([&markAndSweep](ObjHeader* object) { markAndSweep.Mark(object); }, [](ObjHeader*) {});
+    for (ObjHeader** location : threadData->tls()) {
+        markAndSweep.Mark(*location);
+    }
+    for (ObjHeader** location : mm::GlobalsRegistry::Instance().Iter()) {
+        markAndSweep.Mark(*location);
+    }
+    for (ObjHeader* object : mm::StableRefRegistry::Instance().Iter()) {
+        markAndSweep.Mark(object);
+    }
+    markAndSweep.Sweep(mm::ObjectFactory::Instance());
+
+    MemoryStatistics::Instance().RecordGc(konan::getTimeMicros() - startMicros);
+}
+
+ALWAYS_INLINE void CollectNurseryIfFull(mm::ThreadData* threadData) {
+    auto& nursery = threadData->nursery();
+    if (nursery.full()) {
+        auto statistics = nursery.Collect(threadData->objectFactoryThreadQueue(), threadData->shadowStack(), threadData->tls());
+        if (mm::MarkAndSweep::OnPromotion(statistics.promotedBytes)) {
+            CollectGarbage(threadData);
+        }
+    }
+}
+
+void LockSpinlock(int32_t* spinlock) {
+    SpinBackoff backoff;
+    while (!__sync_bool_compare_and_swap(spinlock, 0, 1)) {
+        backoff.Wait();
+    }
+}
+
+void UnlockSpinlock(int32_t* spinlock) {
+    __sync_bool_compare_and_swap(spinlock, 1, 0);
+}
+
 } // namespace
 
 ObjHeader** ObjHeader::GetWeakCounterLocation() {
+    CheckNotStackAllocated(this, "create a weak reference to");
+    // Weak references can be dereferenced on any thread.
+    mm::Nursery::Escape(this);
     return mm::ExtraObjectData::FromMetaObjHeader(this->meta_object()).GetWeakCounterLocation();
 }
 
+int32_t* ObjHeader::GetIdentityHashLocation() {
+    return mm::ExtraObjectData::FromMetaObjHeader(this->meta_object()).GetIdentityHashLocation();
+}
+
+void** ObjHeader::GetStackTraceLocation() {
+    CheckNotStackAllocated(this, "capture a stack trace of");
+    return mm::ExtraObjectData::FromMetaObjHeader(this->meta_object()).GetStackTraceLocation();
+}
+
 #ifdef KONAN_OBJC_INTEROP
 
 void* ObjHeader::GetAssociatedObject() {
@@ -98,11 +187,16 @@ ALWAYS_INLINE bool isShareable(const ObjHeader* obj) {
 }
 
 extern "C" MemoryState* InitMemory(bool firstRuntime) {
+    konan::init_object_heap();
     return ToMemoryState(mm::ThreadRegistry::Instance().RegisterCurrentThread());
 }
 
 extern "C" void DeinitMemory(MemoryState* state, bool destroyRuntime) {
+    auto* threadData = GetThreadData(state);
+    threadData->nursery().Promote(threadData->objectFactoryThreadQueue());
     mm::ThreadRegistry::Instance().Unregister(FromMemoryState(state));
+    // Objects that are still alive stay valid: they are owned by the global object storage.
+    konan::deinit_object_heap();
 }
 
 extern "C" void RestoreMemory(MemoryState*) {
@@ -111,7 +205,10 @@ extern "C" void RestoreMemory(MemoryState*) {
 
 extern "C" RUNTIME_NOTHROW OBJ_GETTER(AllocInstance, const TypeInfo* typeInfo) {
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    CollectNurseryIfFull(threadData);
     auto* object = threadData->objectFactoryThreadQueue().CreateObject(typeInfo);
+    threadData->nursery().OnAllocation(object, mm::ObjectFactory::GetAllocatedSize(object));
+    AllocationProfiler::OnAllocation(typeInfo, typeInfo->instanceSize_);
     RETURN_OBJ(object);
 }
 
@@ -120,11 +217,19 @@ extern "C" OBJ_GETTER(AllocArrayInstance, const TypeInfo* typeInfo, int32_t elem
         ThrowIllegalArgumentException();
     }
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    CollectNurseryIfFull(threadData);
     auto* array = threadData->objectFactoryThreadQueue().CreateArray(typeInfo, static_cast<uint32_t>(elements));
+    threadData->nursery().OnAllocation(array->obj(), mm::ObjectFactory::GetAllocatedSize(array->obj()));
+    AllocationProfiler::OnAllocation(typeInfo, sizeof(ArrayHeader) + static_cast<size_t>(-typeInfo->instanceSize_) * elements);
     // `ArrayHeader` and `ObjHeader` are expected to be compatible.
     RETURN_OBJ(reinterpret_cast<ObjHeader*>(array));
 }
 
+extern "C" OBJ_GETTER(AllocUninitializedArrayInstance, const TypeInfo* typeInfo, int32_t elements) {
+    // TODO: Let `ObjectFactory` skip zeroing of the elements too.
+    RETURN_RESULT_OF(AllocArrayInstance, typeInfo, elements);
+}
+
 extern "C" OBJ_GETTER(InitSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (*ctor)(ObjHeader*)) {
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
     // TODO: This should only be called if singleton is actually created here. It's possible that the
@@ -152,6 +257,104 @@ extern "C" RUNTIME_NOTHROW void LeaveFrame(ObjHeader** start, int parameters, in
     threadData->shadowStack().LeaveFrame(start, parameters, count);
 }
 
+extern "C" RUNTIME_NOTHROW void SetStackRef(ObjHeader** location, const ObjHeader* object) {
+    *location = const_cast<ObjHeader*>(object);
+}
+
+extern "C" RUNTIME_NOTHROW void SetHeapRef(ObjHeader** location, const ObjHeader* object) {
+    RememberHeapStore(location, object);
+    *location = const_cast<ObjHeader*>(object);
+}
+
+extern "C" RUNTIME_NOTHROW void ZeroHeapRef(ObjHeader** location) {
+    *location = nullptr;
+}
+
+extern "C" RUNTIME_NOTHROW void ZeroArrayRefs(ArrayHeader* array) {
+    for (uint32_t index = 0; index < array->count_; ++index) {
+        *ArrayAddressOfElementAt(array, index) = nullptr;
+    }
+}
+
+extern "C" RUNTIME_NOTHROW void ZeroStackRef(ObjHeader** location) {
+    *location = nullptr;
+}
+
+extern "C" RUNTIME_NOTHROW void UpdateStackRef(ObjHeader** location, const ObjHeader* object) {
+    *location = const_cast<ObjHeader*>(object);
+}
+
+extern "C" RUNTIME_NOTHROW void UpdateHeapRef(ObjHeader** location, const ObjHeader* object) {
+    RememberHeapStore(location, object);
+    *location = const_cast<ObjHeader*>(object);
+}
+
+extern "C" RUNTIME_NOTHROW void CopyHeapRefs(ObjHeader** destination, ObjHeader* const* source, uint32_t count) {
+    for (uint32_t index = 0; index < count; ++index) {
+        RememberHeapStore(destination + index, source[index]);
+    }
+    memmove(destination, source, count * sizeof(ObjHeader*));
+}
+
+extern "C" RUNTIME_NOTHROW void FillHeapRefs(ObjHeader** location, const ObjHeader* object, uint32_t count) {
+    for (uint32_t index = 0; index < count; ++index) {
+        RememberHeapStore(location + index, object);
+        location[index] = const_cast<ObjHeader*>(object);
+    }
+}
+
+extern "C" RUNTIME_NOTHROW void UpdateHeapRefIfNull(ObjHeader** location, const ObjHeader* object) {
+    if (object == nullptr) return;
+    // Remembering a store that doesn't happen only makes `object` survive a minor collection.
+    RememberHeapStore(location, object);
+    compareAndSet(location, static_cast<ObjHeader*>(nullptr), const_cast<ObjHeader*>(object));
+}
+
+// There are no containers to remember in this MM, so `cookie` is unused by the locked entry points.
+extern "C" RUNTIME_NOTHROW OBJ_GETTER(
+        SwapHeapRefLocked, ObjHeader** location, ObjHeader* expectedValue, ObjHeader* newValue, int32_t* spinlock, int32_t* cookie) {
+    LockSpinlock(spinlock);
+    ObjHeader* oldValue = *location;
+    if (oldValue == expectedValue) {
+        RememberHeapStore(location, newValue);
+        *location = newValue;
+    }
+    UnlockSpinlock(spinlock);
+    RETURN_OBJ(oldValue);
+}
+
+extern "C" RUNTIME_NOTHROW void SetHeapRefLocked(ObjHeader** location, ObjHeader* newValue, int32_t* spinlock, int32_t* cookie) {
+    LockSpinlock(spinlock);
+    RememberHeapStore(location, newValue);
+    *location = newValue;
+    UnlockSpinlock(spinlock);
+}
+
+extern "C" RUNTIME_NOTHROW OBJ_GETTER(ReadHeapRefLocked, ObjHeader** location, int32_t* spinlock, int32_t* cookie) {
+    LockSpinlock(spinlock);
+    ObjHeader* value = *location;
+    UnlockSpinlock(spinlock);
+    RETURN_OBJ(value);
+}
+
+// Same as `ReadHeapRefLocked`, for the locations that are read with an acquire load instead of the spinlock.
+extern "C" RUNTIME_NOTHROW OBJ_GETTER(ReadHeapRefUnlocked, ObjHeader** location, int32_t* cookie) {
+    ObjHeader* value = __atomic_load_n(location, __ATOMIC_ACQUIRE);
+    RETURN_OBJ(value);
+}
+
+extern "C" RUNTIME_NOTHROW void UpdateReturnRef(ObjHeader** returnSlot, const ObjHeader* object) {
+    *returnSlot = const_cast<ObjHeader*>(object);
+}
+
+extern "C" RUNTIME_NOTHROW void PerformFullGC(MemoryState* memory) {
+    CollectGarbage(GetThreadData(memory));
+}
+
+extern "C" void Kotlin_native_internal_GC_collect(KRef) {
+    CollectGarbage(mm::ThreadRegistry::Instance().CurrentThreadData());
+}
+
 extern "C" RUNTIME_NOTHROW void AddTLSRecord(MemoryState* memory, void** key, int size) {
     GetThreadData(memory)->tls().AddRecord(key, size);
 }
@@ -190,18 +393,56 @@ extern "C" bool Kotlin_Any_isShareable(ObjHeader* thiz) {
 
 extern "C" RUNTIME_NOTHROW bool ClearSubgraphReferences(ObjHeader* root, bool checked) {
     // TODO: Remove when legacy MM is gone.
+    CheckNotStackAllocated(root, "transfer");
     return true;
 }
 
 extern "C" RUNTIME_NOTHROW void* CreateStablePointer(ObjHeader* object) {
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    CheckNotStackAllocated(object, "create a stable reference to");
+    mm::Nursery::Escape(object);
+    MemoryStatistics::Instance().RecordStableRefCreated();
     return mm::StableRefRegistry::Instance().RegisterStableRef(threadData, object);
 }
 
 extern "C" RUNTIME_NOTHROW void DisposeStablePointer(void* pointer) {
+    if (pointer == nullptr) return;
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
     auto* node = static_cast<mm::StableRefRegistry::Node*>(pointer);
     mm::StableRefRegistry::Instance().UnregisterStableRef(threadData, node);
+    MemoryStatistics::Instance().RecordStableRefDisposed();
+}
+
+extern "C" RUNTIME_NOTHROW void CreateStablePointers(ObjHeader* const* objects, void** pointers, size_t count) {
+    auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    for (size_t i = 0; i < count; ++i) {
+        CheckNotStackAllocated(objects[i], "create a stable reference to");
+        mm::Nursery::Escape(objects[i]);
+    }
+    MemoryStatistics::Instance().RecordStableRefCreated(count);
+    auto** nodes = reinterpret_cast<mm::StableRefRegistry::Node**>(pointers);
+    mm::StableRefRegistry::Instance().RegisterStableRefs(threadData, objects, count, nodes);
+}
+
+extern "C" RUNTIME_NOTHROW void DisposeStablePointers(void* const* pointers, size_t count) {
+    auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    auto* const* nodes = reinterpret_cast<mm::StableRefRegistry::Node* const*>(pointers);
+    size_t disposed = 0;
+    // Unregisters the runs of non-null pointers, like the legacy MM skips `nullptr`s.
+    for (size_t start = 0; start < count;) {
+        if (nodes[start] == nullptr) {
+            ++start;
+            continue;
+        }
+        size_t end = start;
+        while (end < count && nodes[end] != nullptr) {
+            ++end;
+        }
+        mm::StableRefRegistry::Instance().UnregisterStableRefs(threadData, nodes + start, end - start);
+        disposed += end - start;
+        start = end;
+    }
+    MemoryStatistics::Instance().RecordStableRefDisposed(disposed);
 }
 
 extern "C" RUNTIME_NOTHROW OBJ_GETTER(DerefStablePointer, void* pointer) {
@@ -216,6 +457,7 @@ extern "C" RUNTIME_NOTHROW OBJ_GETTER(AdoptStablePointer, void* pointer) {
     ObjHeader* object = **node;
     UpdateReturnRef(OBJ_RESULT, object);
     mm::StableRefRegistry::Instance().UnregisterStableRef(threadData, node);
+    MemoryStatistics::Instance().RecordStableRefDisposed();
     return object;
 }
 
@@ -229,6 +471,9 @@ extern "C" RUNTIME_NOTHROW void CheckLifetimesConstraint(ObjHeader* obj, ObjHead
 
 extern "C" ForeignRefContext InitForeignRef(ObjHeader* object) {
     auto* threadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    CheckNotStackAllocated(object, "create a foreign reference to");
+    mm::Nursery::Escape(object);
+    MemoryStatistics::Instance().RecordStableRefCreated();
     auto* node = mm::StableRefRegistry::Instance().RegisterStableRef(threadData, object);
     return ToForeignRefManager(node);
 }
@@ -238,6 +483,19 @@ extern "C" void DeinitForeignRef(ObjHeader* object, ForeignRefContext context) {
     auto* node = FromForeignRefManager(context);
     RuntimeAssert(object == **node, "Must correspond to the same object");
     mm::StableRefRegistry::Instance().UnregisterStableRef(threadData, node);
+    MemoryStatistics::Instance().RecordStableRefDisposed();
+}
+
+// Foreign references are stable references in this MM.
+extern "C" void InitForeignRefs(ObjHeader* const* objects, ForeignRefContext* contexts, size_t count) {
+    CreateStablePointers(objects, reinterpret_cast<void**>(contexts), count);
+}
+
+extern "C" void DeinitForeignRefs(ObjHeader* const* objects, const ForeignRefContext* contexts, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        RuntimeAssert(objects[i] == **FromForeignRefManager(contexts[i]), "Must correspond to the same object");
+    }
+    DisposeStablePointers(reinterpret_cast<void* const*>(contexts), count);
 }
 
 extern "C" bool IsForeignRefAccessible(ObjHeader* object, ForeignRefContext context) {
@@ -250,6 +508,59 @@ extern "C" void AdoptReferenceFromSharedVariable(ObjHeader* object) {
     // Nothing to do.
 }
 
+// Without a GC the object factory has every object ever allocated, so the snapshot includes the garbage too: it's the objects
+// not reachable from the roots. Other threads are not stopped: their stacks are read as is, and their objects, globals and
+// stable references created since they last published their queues are not seen.
+extern "C" RUNTIME_NOTHROW bool DumpHeapSnapshot(const char* path) {
+    HeapSnapshotWriter writer(path);
+    if (!writer.ok()) return false;
+
+    auto* currentThreadData = mm::ThreadRegistry::Instance().CurrentThreadData();
+    currentThreadData->nursery().Promote(currentThreadData->objectFactoryThreadQueue());
+    mm::GlobalsRegistry::Instance().ProcessThread(currentThreadData);
+    mm::StableRefRegistry::Instance().ProcessThread(currentThreadData);
+    mm::StableRefRegistry::Instance().ProcessDeletions();
+
+    for (auto& threadData : mm::ThreadRegistry::Instance().Iter()) {
+        for (ObjHeader* object : threadData.shadowStack()) {
+            writer.WriteRoot(HeapSnapshotWriter::RootKind::kStack, object);
+        }
+        // Not in the `ObjectFactory`, but the stack roots may point to them.
+        threadData.shadowStack().TraverseObjects([](ObjHeader*) {}, [&writer](ObjHeader* object) { writer.WriteObject(object); });
+        for (ObjHeader** location : threadData.tls()) {
+            writer.WriteRoot(HeapSnapshotWriter::RootKind::kThreadLocal, *location);
+        }
+    }
+    for (ObjHeader** location : mm::GlobalsRegistry::Instance().Iter()) {
+        writer.WriteRoot(HeapSnapshotWriter::RootKind::kGlobal, *location);
+    }
+    for (ObjHeader* object : mm::StableRefRegistry::Instance().Iter()) {
+        writer.WriteRoot(HeapSnapshotWriter::RootKind::kStableRef, object);
+    }
+
+    auto objects = mm::ObjectFactory::Instance().Iter();
+    for (auto it = objects.begin(); it != objects.end(); ++it) {
+        writer.WriteObject(it.IsArray() ? it.GetArrayHeader()->obj() : it.GetObjHeader());
+    }
+    return writer.Finish();
+}
+
+extern "C" KBoolean Kotlin_native_internal_GC_getGenerational(KRef) {
+    return mm::Nursery::enabled();
+}
+
+extern "C" void Kotlin_native_internal_GC_setGenerational(KRef, KBoolean value) {
+    mm::Nursery::SetEnabled(value);
+}
+
+extern "C" KLong Kotlin_native_internal_GC_getNurserySize(KRef) {
+    return static_cast<KLong>(mm::Nursery::capacity());
+}
+
+extern "C" void Kotlin_native_internal_GC_setNurserySize(KRef, KLong value) {
+    mm::Nursery::SetCapacity(static_cast<size_t>(value));
+}
+
 void CheckGlobalsAccessible() {
     // TODO: Remove when legacy MM is gone.
     // Always accessible
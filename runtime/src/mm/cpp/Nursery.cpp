@@ -0,0 +1,226 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "Nursery.hpp"
+
+#include <algorithm>
+
+#include "MemoryStatistics.hpp"
+#include "Natives.h"
+#include "ObjectTraversal.hpp"
+#include "Porting.h"
+#include "Tracing.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+// Objects indexed in the order they are added, looked up by the addresses of their reference fields.
+class ObjectRanges : private Pinned {
+public:
+    static constexpr size_t kNotFound = static_cast<size_t>(-1);
+
+    void Add(ObjHeader* object) noexcept {
+        size_t index = objects_.size();
+        objects_.push_back(object);
+        uintptr_t begin = reinterpret_cast<uintptr_t>(object);
+        ranges_.push_back(Range{begin, begin + ReferenceFieldsSize(object), index});
+    }
+
+    void Seal() noexcept {
+        std::sort(ranges_.begin(), ranges_.end(), [](const Range& lhs, const Range& rhs) { return lhs.begin < rhs.begin; });
+    }
+
+    size_t size() const noexcept { return objects_.size(); }
+    ObjHeader* operator[](size_t index) const noexcept { return objects_[index]; }
+
+    size_t IndexOf(const ObjHeader* object) const noexcept {
+        auto* range = RangeBefore(reinterpret_cast<uintptr_t>(object));
+        return range != nullptr && range->begin == reinterpret_cast<uintptr_t>(object) ? range->index : kNotFound;
+    }
+
+    // The object with the reference field at `location`.
+    size_t OwnerOf(ObjHeader** location) const noexcept {
+        auto* range = RangeBefore(reinterpret_cast<uintptr_t>(location));
+        return range != nullptr && reinterpret_cast<uintptr_t>(location) < range->end ? range->index : kNotFound;
+    }
+
+private:
+    struct Range {
+        uintptr_t begin;
+        uintptr_t end;
+        size_t index;
+    };
+
+    static size_t ReferenceFieldsSize(const ObjHeader* object) noexcept {
+        const TypeInfo* typeInfo = object->type_info();
+        if (typeInfo == theArrayTypeInfo) {
+            const ArrayHeader* array = object->array();
+            return reinterpret_cast<uintptr_t>(ArrayAddressOfElementAt(array, array->count_)) - reinterpret_cast<uintptr_t>(array);
+        }
+        return typeInfo->IsArray() ? 0 : static_cast<size_t>(typeInfo->instanceSize_);
+    }
+
+    // The range with the greatest `begin` not above `address`.
+    const Range* RangeBefore(uintptr_t address) const noexcept {
+        auto it = std::upper_bound(
+                ranges_.begin(), ranges_.end(), address, [](uintptr_t address, const Range& range) { return address < range.begin; });
+        return it == ranges_.begin() ? nullptr : &*std::prev(it);
+    }
+
+    KStdVector<ObjHeader*> objects_;
+    KStdVector<Range> ranges_;
+};
+
+class Marker : private Pinned {
+public:
+    explicit Marker(const ObjectRanges& young) noexcept : young_(young), marked_(young.size(), false) {}
+
+    bool marked(size_t index) const noexcept { return marked_[index]; }
+
+    void Mark(size_t index) noexcept {
+        if (index == ObjectRanges::kNotFound || marked_[index]) return;
+        marked_[index] = true;
+        worklist_.push_back(index);
+    }
+
+    void Mark(const ObjHeader* object) noexcept {
+        if (object != nullptr) Mark(young_.IndexOf(object));
+    }
+
+    // Marks everything reachable from the marked objects through their current reference fields and `extraEdges`, which
+    // are (owner, value) index pairs sorted by the owner.
+    void Trace(const KStdVector<std::pair<size_t, size_t>>& extraEdges) noexcept {
+        while (!worklist_.empty()) {
+            size_t index = worklist_.back();
+            worklist_.pop_back();
+            TraverseReferenceFields(young_[index], [this](uint32_t, ObjHeader* const* location) { Mark(*location); });
+            auto edges = std::equal_range(
+                    extraEdges.begin(), extraEdges.end(), std::make_pair(index, size_t(0)),
+                    [](const std::pair<size_t, size_t>& lhs, const std::pair<size_t, size_t>& rhs) { return lhs.first < rhs.first; });
+            for (auto it = edges.first; it != edges.second; ++it) {
+                Mark(it->second);
+            }
+        }
+    }
+
+private:
+    const ObjectRanges& young_;
+    KStdVector<bool> marked_;
+    KStdVector<size_t> worklist_;
+};
+
+} // namespace
+
+// static
+std::atomic<bool> mm::Nursery::enabled_{false};
+
+// static
+std::atomic<size_t> mm::Nursery::capacity_{mm::Nursery::kDefaultCapacity};
+
+// static
+void mm::Nursery::Escape(const ObjHeader* object) noexcept {
+    if (object == nullptr || object->permanent()) return;
+    auto& flags = ObjectFactory::GCFlags(object);
+    // Don't touch the flags of the promoted objects, they are accessed by other threads.
+    if ((flags.load(std::memory_order_relaxed) & kYoung) == 0) return;
+    flags.fetch_or(kEscaped, std::memory_order_relaxed);
+}
+
+mm::Nursery::CollectionStatistics mm::Nursery::Collect(
+        ObjectFactory::ThreadQueue& objectFactoryThreadQueue, ShadowStack& shadowStack, ThreadLocalStorage& tls) noexcept {
+    Tracing::Span span("gc", "minor");
+    uint64_t startMicros = konan::getTimeMicros();
+
+    // Young objects of the thread, in the order of `objectFactoryThreadQueue`.
+    ObjectRanges young;
+    for (auto& node : objectFactoryThreadQueue) {
+        auto* object = static_cast<ObjHeader*>(node.Data());
+        if ((node.GCFlags().load(std::memory_order_relaxed) & kYoung) != 0) young.Add(object);
+    }
+    young.Seal();
+
+    // Stores into the stack-allocated objects don't make the values escape: those are reached from the stack.
+    KStdVector<ObjHeader*> stackRoots;
+    ObjectRanges locals;
+    shadowStack.TraverseObjects(
+            [&stackRoots](ObjHeader* object) { stackRoots.push_back(object); }, [&locals](ObjHeader* object) { locals.Add(object); });
+    locals.Seal();
+
+    // Escaped objects first: everything that was ever stored into them escapes too, not just what they refer to now.
+    Marker escaped(young);
+    KStdVector<std::pair<size_t, size_t>> storesIntoYoung;
+    for (auto& store : rememberedSet_) {
+        size_t value = young.IndexOf(store.second);
+        // Could be a young object of another thread, or a promoted one.
+        if (value == ObjectRanges::kNotFound) continue;
+        size_t owner = young.OwnerOf(store.first);
+        if (owner != ObjectRanges::kNotFound) {
+            storesIntoYoung.emplace_back(owner, value);
+        } else if (locals.OwnerOf(store.first) == ObjectRanges::kNotFound) {
+            escaped.Mark(value);
+        }
+    }
+    for (size_t i = 0; i < young.size(); ++i) {
+        if ((ObjectFactory::GCFlags(young[i]).load(std::memory_order_relaxed) & kEscaped) != 0) escaped.Mark(i);
+    }
+    std::sort(storesIntoYoung.begin(), storesIntoYoung.end());
+    escaped.Trace(storesIntoYoung);
+
+    Marker alive(young);
+    for (size_t i = 0; i < young.size(); ++i) {
+        if (escaped.marked(i)) alive.Mark(i);
+    }
+    for (ObjHeader* object : stackRoots) {
+        alive.Mark(object);
+    }
+    for (ObjHeader** location : tls) {
+        alive.Mark(*location);
+    }
+    alive.Trace({});
+
+    CollectionStatistics statistics;
+    size_t index = 0;
+    for (auto it = objectFactoryThreadQueue.begin(); it != objectFactoryThreadQueue.end();) {
+        auto& flags = (*it).GCFlags();
+        if ((flags.load(std::memory_order_relaxed) & kYoung) == 0) {
+            ++it;
+            continue;
+        }
+        ObjHeader* object = young[index];
+        size_t size = ObjectFactory::GetAllocatedSize(object);
+        if (alive.marked(index++)) {
+            flags.fetch_and(~(kYoung | kEscaped), std::memory_order_relaxed);
+            ++statistics.promotedObjects;
+            statistics.promotedBytes += size;
+            ++it;
+        } else {
+            if (object->has_meta_object()) {
+                ObjHeader::destroyMetaObject(object);
+            }
+            ++statistics.freedObjects;
+            statistics.freedBytes += size;
+            objectFactoryThreadQueue.EraseAndAdvance(it);
+        }
+    }
+    objectFactoryThreadQueue.Publish();
+    rememberedSet_.clear();
+    youngSize_ = 0;
+
+    MemoryStatistics::Instance().RecordMinorGc(konan::getTimeMicros() - startMicros, statistics.freedBytes, statistics.promotedBytes);
+    return statistics;
+}
+
+void mm::Nursery::Promote(ObjectFactory::ThreadQueue& objectFactoryThreadQueue) noexcept {
+    // Nothing is young unless the mode was on at some point.
+    if (youngSize_ != 0) {
+        for (auto& node : objectFactoryThreadQueue) {
+            node.GCFlags().fetch_and(~(kYoung | kEscaped), std::memory_order_relaxed);
+        }
+    }
+    objectFactoryThreadQueue.Publish();
+    rememberedSet_.clear();
+    youngSize_ = 0;
+}
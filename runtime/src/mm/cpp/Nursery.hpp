@@ -0,0 +1,111 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#ifndef RUNTIME_MM_NURSERY_H
+#define RUNTIME_MM_NURSERY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "Memory.h"
+#include "ObjectFactory.hpp"
+#include "ShadowStack.hpp"
+#include "ThreadLocalStorage.hpp"
+#include "Types.h"
+#include "Utils.hpp"
+
+namespace kotlin {
+namespace mm {
+
+// Generational mode: a thread collects the objects it has recently allocated without stopping the other threads.
+// Disabled by default.
+//
+// The nursery of a thread is its unpublished `ObjectFactory::ThreadQueue`: objects created while the mode is on
+// are young until the next minor collection of the thread, which frees the unreachable ones and publishes the rest.
+// Objects are never moved, since the compiled code and the interop keep raw pointers to them: being published is
+// what promotes an object.
+//
+// The other threads may hold a young object that is already unreachable for its owner, so such an object must
+// survive: it's escaped. The heap-ref write entry points record the stores of young objects into the remembered
+// set of the thread, and a minor collection treats a young object as escaped if it was stored into an escaped one, or
+// outside of the young objects and the stack-allocated objects of the thread. Stable references and weak references
+// escape an object right away.
+// The roots are the escaped objects, the shadow stack with the stack-allocated objects it refers to, and the
+// thread local storage.
+//
+// Promoted objects are freed by the major collection, see `MarkAndSweep`. It's triggered by the minor collections once
+// they have promoted enough.
+class Nursery : private Pinned {
+public:
+    // `ObjectFactory::GCFlags` of the objects.
+    static constexpr uint32_t kYoung = 1 << 0;
+    static constexpr uint32_t kEscaped = 1 << 1;
+
+    static constexpr size_t kDefaultCapacity = 4 * 1024 * 1024;
+    // A minor collection empties the remembered set, so it's triggered by a long one too.
+    static constexpr size_t kRememberedSetCapacity = 64 * 1024;
+
+    struct CollectionStatistics {
+        size_t freedObjects = 0;
+        size_t freedBytes = 0;
+        size_t promotedObjects = 0;
+        size_t promotedBytes = 0;
+    };
+
+    static bool enabled() noexcept { return enabled_.load(std::memory_order_relaxed); }
+    // Objects created before enabling are not young, young objects stay young after disabling.
+    static void SetEnabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    // Size of the young objects of a thread that triggers its minor collection.
+    static size_t capacity() noexcept { return capacity_.load(std::memory_order_relaxed); }
+    static void SetCapacity(size_t capacity) noexcept { capacity_.store(capacity, std::memory_order_relaxed); }
+
+    // Whether `object` is young and not known to be escaped. Its owner thread is not known.
+    static ALWAYS_INLINE bool IsYoung(const ObjHeader* object) noexcept {
+        // Permanent and stack-allocated objects are not created by an `ObjectFactory`.
+        if (object == nullptr || object->permanent()) return false;
+        return (ObjectFactory::GCFlags(object).load(std::memory_order_relaxed) & (kYoung | kEscaped)) == kYoung;
+    }
+
+    // Makes `object` survive minor collections even if it's not reachable from its owner thread.
+    static void Escape(const ObjHeader* object) noexcept;
+
+    Nursery() noexcept = default;
+
+    // Called by the owning thread for the `object` of `size` bytes it has just created.
+    ALWAYS_INLINE void OnAllocation(ObjHeader* object, size_t size) noexcept {
+        if (!enabled()) return;
+        ObjectFactory::GCFlags(object).store(kYoung, std::memory_order_relaxed);
+        youngSize_ += size;
+    }
+
+    // Called by the owning thread when it stores `value` into the heap `location`, if `IsYoung(value)`.
+    void Remember(ObjHeader** location, const ObjHeader* value) noexcept { rememberedSet_.emplace_back(location, value); }
+
+    // Whether the owning thread should do a minor collection.
+    bool full() const noexcept { return youngSize_ >= capacity() || rememberedSet_.size() >= kRememberedSetCapacity; }
+
+    // Frees the young objects of `objectFactoryThreadQueue` that are neither escaped nor reachable from the roots,
+    // and publishes the rest. Must be called by the owning thread.
+    CollectionStatistics Collect(
+            ObjectFactory::ThreadQueue& objectFactoryThreadQueue, ShadowStack& shadowStack, ThreadLocalStorage& tls) noexcept;
+
+    // Publishes the young objects of `objectFactoryThreadQueue` without collecting them.
+    void Promote(ObjectFactory::ThreadQueue& objectFactoryThreadQueue) noexcept;
+
+private:
+    static std::atomic<bool> enabled_;
+    static std::atomic<size_t> capacity_;
+
+    KStdVector<std::pair<ObjHeader**, const ObjHeader*>> rememberedSet_;
+    size_t youngSize_ = 0;
+};
+
+} // namespace mm
+} // namespace kotlin
+
+#endif // RUNTIME_MM_NURSERY_H
@@ -0,0 +1,240 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+#include "Nursery.hpp"
+
+#include <array>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "MemoryStatistics.hpp"
+#include "Types.h"
+#include "Utils.hpp"
+
+using namespace kotlin;
+
+using mm::Nursery;
+using mm::ObjectFactory;
+
+namespace {
+
+struct Node {
+    ObjHeader header;
+    ObjHeader* next;
+};
+
+const int32_t kNodeOffsets[] = {offsetof(Node, next)};
+
+KStdUniquePtr<TypeInfo> MakeNodeTypeInfo() {
+    auto typeInfo = make_unique<TypeInfo>();
+    typeInfo->typeInfo_ = typeInfo.get();
+    typeInfo->instanceSize_ = sizeof(Node);
+    typeInfo->objOffsets_ = kNodeOffsets;
+    typeInfo->objOffsetsCount_ = 1;
+    return typeInfo;
+}
+
+ObjHeader*& NextOf(ObjHeader* object) {
+    return reinterpret_cast<Node*>(object)->next;
+}
+
+// A frame with a single local, like the compiler creates.
+class StackFrame : private Pinned {
+public:
+    explicit StackFrame(mm::ShadowStack& shadowStack) : shadowStack_(shadowStack) {
+        data_.fill(nullptr);
+        shadowStack_.EnterFrame(data_.data(), 0, kTotalCount);
+    }
+
+    ~StackFrame() { shadowStack_.LeaveFrame(data_.data(), 0, kTotalCount); }
+
+    ObjHeader*& local() { return data_[kFrameOverlayCount]; }
+
+private:
+    static inline constexpr int kFrameOverlayCount = sizeof(FrameOverlay) / sizeof(ObjHeader**);
+    static inline constexpr int kTotalCount = kFrameOverlayCount + 1;
+
+    mm::ShadowStack& shadowStack_;
+    std::array<ObjHeader*, kTotalCount> data_;
+};
+
+class NurseryTest : public testing::Test {
+public:
+    NurseryTest() {
+        Nursery::SetEnabled(true);
+        tls_.AddRecord(&tlsKey_, 1);
+        tls_.Commit();
+    }
+
+    ~NurseryTest() override {
+        Nursery::SetEnabled(false);
+        Nursery::SetCapacity(Nursery::kDefaultCapacity);
+        MemoryStatistics::Instance().ResetForTests();
+    }
+
+    ObjHeader* Allocate() {
+        auto* object = threadQueue_.CreateObject(typeInfo_.get());
+        nursery_.OnAllocation(object, ObjectFactory::GetAllocatedSize(object));
+        return object;
+    }
+
+    // Stores like the heap-ref write entry points do.
+    void Store(ObjHeader** location, ObjHeader* value) {
+        if (Nursery::IsYoung(value)) nursery_.Remember(location, value);
+        *location = value;
+    }
+
+    Nursery::CollectionStatistics Collect() { return nursery_.Collect(threadQueue_, shadowStack_, tls_); }
+
+    KStdVector<ObjHeader*> Published() {
+        KStdVector<ObjHeader*> result;
+        auto iter = objectFactory_.Iter();
+        for (auto it = iter.begin(); it != iter.end(); ++it) {
+            result.push_back(it.GetObjHeader());
+        }
+        return result;
+    }
+
+    ObjHeader*& tlsSlot() { return *tls_.Lookup(&tlsKey_, 0); }
+
+protected:
+    KStdUniquePtr<TypeInfo> typeInfo_ = MakeNodeTypeInfo();
+    ObjectFactory objectFactory_;
+    ObjectFactory::ThreadQueue threadQueue_{objectFactory_};
+    mm::ShadowStack shadowStack_;
+    mm::ThreadLocalStorage tls_;
+    int tlsKey_ = 0;
+    Nursery nursery_;
+};
+
+} // namespace
+
+TEST_F(NurseryTest, NotYoungWhenDisabled) {
+    Nursery::SetEnabled(false);
+    auto* object = Allocate();
+
+    EXPECT_FALSE(Nursery::IsYoung(object));
+    EXPECT_FALSE(nursery_.full());
+    auto statistics = Collect();
+    EXPECT_THAT(statistics.freedObjects, 0);
+    EXPECT_THAT(statistics.promotedObjects, 0);
+    EXPECT_THAT(Published(), testing::ElementsAre(object));
+}
+
+TEST_F(NurseryTest, FreesUnreachable) {
+    StackFrame frame(shadowStack_);
+    auto* onStack = Allocate();
+    auto* garbage = Allocate();
+    auto* inTls = Allocate();
+    frame.local() = onStack;
+    tlsSlot() = inTls;
+
+    EXPECT_TRUE(Nursery::IsYoung(garbage));
+    auto statistics = Collect();
+    EXPECT_THAT(statistics.freedObjects, 1);
+    EXPECT_THAT(statistics.freedBytes, sizeof(Node));
+    EXPECT_THAT(statistics.promotedObjects, 2);
+    EXPECT_THAT(statistics.promotedBytes, 2 * sizeof(Node));
+    EXPECT_THAT(Published(), testing::ElementsAre(onStack, inTls));
+    EXPECT_FALSE(Nursery::IsYoung(onStack));
+    EXPECT_FALSE(Nursery::IsYoung(inTls));
+    EXPECT_THAT(MemoryStatistics::Instance().minorGcCount(), 1);
+    EXPECT_THAT(MemoryStatistics::Instance().minorGcFreedBytes(), sizeof(Node));
+}
+
+TEST_F(NurseryTest, TracesYoungObjects) {
+    StackFrame frame(shadowStack_);
+    auto* head = Allocate();
+    auto* next = Allocate();
+    auto* overwritten = Allocate();
+    frame.local() = head;
+    Store(&NextOf(head), overwritten);
+    Store(&NextOf(head), next);
+
+    auto statistics = Collect();
+    EXPECT_THAT(statistics.freedObjects, 1);
+    EXPECT_THAT(Published(), testing::ElementsAre(head, next));
+}
+
+TEST_F(NurseryTest, StoredOutside) {
+    Nursery::SetEnabled(false);
+    auto* mature = Allocate();
+    threadQueue_.Publish();
+    Nursery::SetEnabled(true);
+    auto* escaped = Allocate();
+    auto* storedIntoEscaped = Allocate();
+    auto* storedIntoGarbage = Allocate();
+    auto* garbage = Allocate();
+    Store(&NextOf(mature), escaped);
+    Store(&NextOf(escaped), storedIntoEscaped);
+    Store(&NextOf(garbage), storedIntoGarbage);
+    // Another thread could have read them before.
+    NextOf(mature) = nullptr;
+    NextOf(escaped) = nullptr;
+
+    auto statistics = Collect();
+    EXPECT_THAT(statistics.freedObjects, 2);
+    EXPECT_THAT(Published(), testing::ElementsAre(mature, escaped, storedIntoEscaped));
+}
+
+TEST_F(NurseryTest, Escape) {
+    auto* object = Allocate();
+    Nursery::Escape(object);
+
+    EXPECT_FALSE(Nursery::IsYoung(object));
+    auto statistics = Collect();
+    EXPECT_THAT(statistics.freedObjects, 0);
+    EXPECT_THAT(Published(), testing::ElementsAre(object));
+}
+
+TEST_F(NurseryTest, StackAllocatedRoots) {
+    StackFrame frame(shadowStack_);
+    Node local = {};
+    local.header.typeInfoOrMeta_ = setPointerBits(typeInfo_.get(), OBJECT_TAG_PERMANENT_CONTAINER | OBJECT_TAG_NONTRIVIAL_CONTAINER);
+    ASSERT_TRUE(local.header.local());
+    auto* object = Allocate();
+    Allocate();
+    frame.local() = &local.header;
+    local.next = object;
+
+    auto statistics = Collect();
+    EXPECT_THAT(statistics.freedObjects, 1);
+    EXPECT_THAT(Published(), testing::ElementsAre(object));
+}
+
+TEST_F(NurseryTest, StoredIntoStackAllocated) {
+    StackFrame frame(shadowStack_);
+    Node local = {};
+    local.header.typeInfoOrMeta_ = setPointerBits(typeInfo_.get(), OBJECT_TAG_PERMANENT_CONTAINER | OBJECT_TAG_NONTRIVIAL_CONTAINER);
+    frame.local() = &local.header;
+    auto* object = Allocate();
+    auto* overwritten = Allocate();
+    Store(&local.next, overwritten);
+    Store(&local.next, object);
+
+    auto statistics = Collect();
+    EXPECT_THAT(statistics.freedObjects, 1);
+    EXPECT_THAT(Published(), testing::ElementsAre(object));
+}
+
+TEST_F(NurseryTest, Full) {
+    Nursery::SetCapacity(2 * sizeof(Node));
+    Allocate();
+    EXPECT_FALSE(nursery_.full());
+    Allocate();
+    EXPECT_TRUE(nursery_.full());
+
+    Collect();
+    EXPECT_FALSE(nursery_.full());
+}
+
+TEST_F(NurseryTest, Promote) {
+    auto* object = Allocate();
+    nursery_.Promote(threadQueue_);
+
+    EXPECT_FALSE(Nursery::IsYoung(object));
+    EXPECT_THAT(Published(), testing::ElementsAre(object));
+}
@@ -8,13 +8,30 @@
 #include "Alignment.hpp"
 #include "Alloc.h"
 #include "GlobalData.hpp"
+#include "KString.h"
+#include "MemoryStatistics.hpp"
 #include "Types.h"
 
 using namespace kotlin;
 
+namespace {
+
+size_t ObjectAllocatedSize(const TypeInfo* typeInfo) noexcept {
+    return typeInfo->instanceSize_;
+}
+
+size_t ArrayAllocatedSize(const TypeInfo* typeInfo, uint32_t count) noexcept {
+    uint32_t arraySize = static_cast<uint32_t>(-typeInfo->instanceSize_) * count;
+    // Note: array body is aligned, but for size computation it is enough to align the sum.
+    return AlignUp(sizeof(ArrayHeader) + arraySize, kObjectAlignment);
+}
+
+} // namespace
+
 ObjHeader* mm::ObjectFactory::ThreadQueue::CreateObject(const TypeInfo* typeInfo) noexcept {
     RuntimeAssert(!typeInfo->IsArray(), "Must not be an array");
-    size_t allocSize = typeInfo->instanceSize_;
+    size_t allocSize = ObjectAllocatedSize(typeInfo);
+    MemoryStatistics::Instance().RecordAllocation(allocSize);
     auto& node = producer_.Insert(allocSize);
     auto* object = static_cast<ObjHeader*>(node.Data());
     object->typeInfoOrMeta_ = const_cast<TypeInfo*>(typeInfo);
@@ -23,9 +40,8 @@ ObjHeader* mm::ObjectFactory::ThreadQueue::CreateObject(const TypeInfo* typeInfo
 
 ArrayHeader* mm::ObjectFactory::ThreadQueue::CreateArray(const TypeInfo* typeInfo, uint32_t count) noexcept {
     RuntimeAssert(typeInfo->IsArray(), "Must be an array");
-    uint32_t arraySize = static_cast<uint32_t>(-typeInfo->instanceSize_) * count;
-    // Note: array body is aligned, but for size computation it is enough to align the sum.
-    size_t allocSize = AlignUp(sizeof(ArrayHeader) + arraySize, kObjectAlignment);
+    size_t allocSize = ArrayAllocatedSize(typeInfo, count);
+    MemoryStatistics::Instance().RecordAllocation(allocSize);
     auto& node = producer_.Insert(allocSize);
     auto* array = static_cast<ArrayHeader*>(node.Data());
     array->typeInfoOrMeta_ = const_cast<TypeInfo*>(typeInfo);
@@ -59,3 +75,12 @@ mm::ObjectFactory::~ObjectFactory() = default;
 mm::ObjectFactory& mm::ObjectFactory::Instance() noexcept {
     return GlobalData::Instance().objectFactory();
 }
+
+// static
+size_t mm::ObjectFactory::GetAllocatedSize(const ObjHeader* object) noexcept {
+    const TypeInfo* typeInfo = object->type_info();
+    if (!typeInfo->IsArray()) return ObjectAllocatedSize(typeInfo);
+    // `count_` of Latin-1 strings is the length with a flag, not what the string was allocated for.
+    const ArrayHeader* array = object->array();
+    return ArrayAllocatedSize(typeInfo, typeInfo == theStringTypeInfo ? StringStorageLength(array) : array->count_);
+}
@@ -7,6 +7,7 @@
 #define RUNTIME_MM_OBJECT_FACTORY_H
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <type_traits>
@@ -25,7 +26,7 @@ namespace internal {
 
 // A queue that is constructed by collecting subqueues from several `Producer`s.
 // This is essentially a heterogeneous `MultiSourceQueue` on top of a singly linked list that
-// uses `konanAllocMemory` and `konanFreeMemory`
+// uses `konanAllocAlignedObjectMemory` and `konanFreeMemory`
 // TODO: Consider merging with `MultiSourceQueue` somehow.
 template <size_t DataAlignment>
 class ObjectFactoryStorage : private Pinned {
@@ -54,6 +55,15 @@ public:
             return *static_cast<T*>(Data());
         }
 
+        // Inverse of `Data()`.
+        static Node& FromData(void* data) noexcept {
+            constexpr size_t kDataOffset = DataOffset();
+            return *reinterpret_cast<Node*>(static_cast<uint8_t*>(data) - kDataOffset);
+        }
+
+        // Free for use by the GC. Zero for a new `Node`.
+        std::atomic<uint32_t>& GCFlags() noexcept { return gcFlags_; }
+
     private:
         friend class ObjectFactoryStorage;
 
@@ -66,7 +76,7 @@ public:
             RuntimeAssert(
                     DataOffset() + dataSize <= totalSize, "totalSize %zu is not enough to fit data %zu at offset %zu", totalSize, dataSize,
                     DataOffset());
-            void* ptr = konanAllocAlignedMemory(totalSize, totalAlignment);
+            void* ptr = konanAllocAlignedObjectMemory(totalSize, totalAlignment);
             if (!ptr) {
                 // TODO: Try doing GC first.
                 konan::consoleErrorf("Out of memory trying to allocate %zu. Aborting.\n", totalSize);
@@ -77,10 +87,35 @@ public:
         }
 
         KStdUniquePtr<Node> next_;
+        std::atomic<uint32_t> gcFlags_{0};
         // There's some more data of an unknown (at compile-time) size here, but it cannot be represented
         // with C++ members.
     };
 
+    class Iterator {
+    public:
+        Node& operator*() noexcept { return *node_; }
+        Node* operator->() noexcept { return node_; }
+
+        Iterator& operator++() noexcept {
+            previousNode_ = node_;
+            node_ = node_->next_.get();
+            return *this;
+        }
+
+        bool operator==(const Iterator& rhs) const noexcept { return node_ == rhs.node_; }
+
+        bool operator!=(const Iterator& rhs) const noexcept { return node_ != rhs.node_; }
+
+    private:
+        friend class ObjectFactoryStorage;
+
+        Iterator(Node* previousNode, Node* node) noexcept : previousNode_(previousNode), node_(node) {}
+
+        Node* previousNode_; // Kept for `EraseAndAdvance`.
+        Node* node_;
+    };
+
     class Producer : private MoveOnly {
     public:
         explicit Producer(ObjectFactoryStorage& owner) noexcept : owner_(owner) {}
@@ -140,6 +175,15 @@ public:
             owner_.AssertCorrectUnsafe();
         }
 
+        // Iterates over the nodes inserted since the last `Publish`. Only the owning thread may use these.
+        Iterator begin() noexcept { return Iterator(nullptr, root_.get()); }
+        Iterator end() noexcept { return Iterator(last_, nullptr); }
+
+        void EraseAndAdvance(Iterator& iterator) noexcept {
+            iterator.node_ = EraseAfter(root_, last_, iterator.previousNode_);
+            AssertCorrect();
+        }
+
     private:
         friend class ObjectFactoryStorage;
 
@@ -157,30 +201,6 @@ public:
         Node* last_ = nullptr;
     };
 
-    class Iterator {
-    public:
-        Node& operator*() noexcept { return *node_; }
-        Node* operator->() noexcept { return node_; }
-
-        Iterator& operator++() noexcept {
-            previousNode_ = node_;
-            node_ = node_->next_.get();
-            return *this;
-        }
-
-        bool operator==(const Iterator& rhs) const noexcept { return node_ == rhs.node_; }
-
-        bool operator!=(const Iterator& rhs) const noexcept { return node_ != rhs.node_; }
-
-    private:
-        friend class ObjectFactoryStorage;
-
-        Iterator(Node* previousNode, Node* node) noexcept : previousNode_(previousNode), node_(node) {}
-
-        Node* previousNode_; // Kept for `Iterable::EraseAndAdvance`.
-        Node* node_;
-    };
-
     class Iterable : private MoveOnly {
     public:
         explicit Iterable(ObjectFactoryStorage& owner) noexcept : owner_(owner), guard_(owner_.mutex_) {}
@@ -204,31 +224,37 @@ public:
     Iterable Iter() noexcept { return Iterable(*this); }
 
 private:
-    // Expects `mutex_` to be held by the current thread.
-    Node* EraseUnsafe(Node* previousNode) noexcept {
-        RuntimeAssert(root_ != nullptr, "Must not be empty");
-        AssertCorrectUnsafe();
+    // Erases the node after `previousNode` (or the root if it's `nullptr`) from the list of `root` and `last`.
+    // Returns the node after the erased one.
+    static Node* EraseAfter(KStdUniquePtr<Node>& root, Node*& last, Node* previousNode) noexcept {
+        RuntimeAssert(root != nullptr, "Must not be empty");
 
         if (previousNode == nullptr) {
             // Deleting the root.
-            root_ = std::move(root_->next_);
-            if (!root_) {
-                last_ = nullptr;
+            root = std::move(root->next_);
+            if (!root) {
+                last = nullptr;
             }
-            AssertCorrectUnsafe();
-            return root_.get();
+            return root.get();
         }
 
         auto node = std::move(previousNode->next_);
         previousNode->next_ = std::move(node->next_);
         if (!previousNode->next_) {
-            last_ = previousNode;
+            last = previousNode;
         }
 
-        AssertCorrectUnsafe();
         return previousNode->next_.get();
     }
 
+    // Expects `mutex_` to be held by the current thread.
+    Node* EraseUnsafe(Node* previousNode) noexcept {
+        AssertCorrectUnsafe();
+        Node* next = EraseAfter(root_, last_, previousNode);
+        AssertCorrectUnsafe();
+        return next;
+    }
+
     // Expects `mutex_` to be held by the current thread.
     ALWAYS_INLINE void AssertCorrectUnsafe() const noexcept {
         if (root_ == nullptr) {
@@ -250,19 +276,6 @@ class ObjectFactory : private Pinned {
 public:
     using Storage = internal::ObjectFactoryStorage<kObjectAlignment>;
 
-    class ThreadQueue : private MoveOnly {
-    public:
-        explicit ThreadQueue(ObjectFactory& owner) noexcept : producer_(owner.storage_) {}
-
-        ObjHeader* CreateObject(const TypeInfo* typeInfo) noexcept;
-        ArrayHeader* CreateArray(const TypeInfo* typeInfo, uint32_t count) noexcept;
-
-        void Publish() noexcept { producer_.Publish(); }
-
-    private:
-        Storage::Producer producer_;
-    };
-
     class Iterator {
     public:
         Storage::Node& operator*() noexcept { return *iterator_; }
@@ -289,6 +302,25 @@ public:
         Storage::Iterator iterator_;
     };
 
+    class ThreadQueue : private MoveOnly {
+    public:
+        explicit ThreadQueue(ObjectFactory& owner) noexcept : producer_(owner.storage_) {}
+
+        ObjHeader* CreateObject(const TypeInfo* typeInfo) noexcept;
+        ArrayHeader* CreateArray(const TypeInfo* typeInfo, uint32_t count) noexcept;
+
+        void Publish() noexcept { producer_.Publish(); }
+
+        // Iterates over the objects created since the last `Publish`. Only the owning thread may use these.
+        Iterator begin() noexcept { return Iterator(producer_.begin()); }
+        Iterator end() noexcept { return Iterator(producer_.end()); }
+
+        void EraseAndAdvance(Iterator& iterator) noexcept { producer_.EraseAndAdvance(iterator.iterator_); }
+
+    private:
+        Storage::Producer producer_;
+    };
+
     class Iterable {
     public:
         Iterable(ObjectFactory& owner) noexcept : iter_(owner.storage_.Iter()) {}
@@ -307,6 +339,14 @@ public:
 
     static ObjectFactory& Instance() noexcept;
 
+    // Only for the objects created by an `ObjectFactory`.
+    static std::atomic<uint32_t>& GCFlags(const ObjHeader* object) noexcept {
+        return Storage::Node::FromData(const_cast<ObjHeader*>(object)).GCFlags();
+    }
+
+    // The size the object was created with.
+    static size_t GetAllocatedSize(const ObjHeader* object) noexcept;
+
     Iterable Iter() noexcept { return Iterable(*this); }
 
 private:
@@ -296,6 +296,41 @@ TEST(ObjectFactoryStorageTest, EraseTheOnlyElement) {
     EXPECT_THAT(actual, testing::IsEmpty());
 }
 
+TEST(ObjectFactoryStorageTest, EraseUnpublished) {
+    ObjectFactoryStorageRegular storage;
+    ObjectFactoryStorageRegular::Producer producer(storage);
+
+    producer.Insert<int>(1);
+    producer.Insert<int>(2);
+    producer.Insert<int>(3);
+
+    for (auto it = producer.begin(); it != producer.end();) {
+        if (it->Data<int>() != 2) {
+            producer.EraseAndAdvance(it);
+        } else {
+            ++it;
+        }
+    }
+    producer.Insert<int>(4);
+    producer.Publish();
+
+    auto actual = Collect<int>(storage);
+
+    EXPECT_THAT(actual, testing::ElementsAre(2, 4));
+}
+
+TEST(ObjectFactoryStorageTest, GCFlags) {
+    ObjectFactoryStorageRegular storage;
+    ObjectFactoryStorageRegular::Producer producer(storage);
+
+    auto& node = producer.Insert<int>(1);
+    EXPECT_THAT(node.GCFlags().load(), 0);
+    node.GCFlags() = 42;
+
+    EXPECT_THAT(&ObjectFactoryStorageRegular::Node::FromData(node.Data()), &node);
+    EXPECT_THAT(ObjectFactoryStorageRegular::Node::FromData(node.Data()).GCFlags().load(), 42);
+}
+
 TEST(ObjectFactoryStorageTest, ConcurrentPublish) {
     ObjectFactoryStorageRegular storage;
     constexpr int kThreadCount = kDefaultThreadCount;
@@ -532,6 +567,36 @@ TEST(ObjectFactoryTest, Erase) {
     }
 }
 
+TEST(ObjectFactoryTest, IterUnpublished) {
+    auto objectTypeInfo = MakeObjectTypeInfo(24);
+    auto arrayTypeInfo = MakeArrayTypeInfo(24);
+    ObjectFactory objectFactory;
+    ObjectFactory::ThreadQueue threadQueue(objectFactory);
+
+    auto* object = threadQueue.CreateObject(objectTypeInfo.get());
+    threadQueue.CreateArray(arrayTypeInfo.get(), 3);
+
+    int count = 0;
+    for (auto it = threadQueue.begin(); it != threadQueue.end(); ++count) {
+        if (it.IsArray()) {
+            EXPECT_THAT(
+                    ObjectFactory::GetAllocatedSize(it.GetArrayHeader()->obj()), AlignUp(sizeof(ArrayHeader) + 3 * 24, kObjectAlignment));
+            threadQueue.EraseAndAdvance(it);
+        } else {
+            EXPECT_THAT(ObjectFactory::GetAllocatedSize(it.GetObjHeader()), 24);
+            ++it;
+        }
+    }
+    EXPECT_THAT(count, 2);
+    threadQueue.Publish();
+
+    auto iter = objectFactory.Iter();
+    auto it = iter.begin();
+    EXPECT_THAT(it.GetObjHeader(), object);
+    ++it;
+    EXPECT_THAT(it, iter.end());
+}
+
 TEST(ObjectFactoryTest, ConcurrentPublish) {
     auto typeInfo = MakeObjectTypeInfo(24);
     ObjectFactory objectFactory;
@@ -7,6 +7,8 @@
 #define RUNTIME_MM_SHADOW_STACK
 
 #include "Memory.h"
+#include "ObjectTraversal.hpp"
+#include "Types.h"
 #include "Utils.hpp"
 
 struct FrameOverlay;
@@ -23,7 +25,8 @@ namespace mm {
 // running code outside Kotlin), or by the mutator itself. So, in concurrent collection case, make sure
 // to do as little as possible while scanning the stack to free the mutator as soon as possible.
 //
-// TODO: This is currently incompatible with stack-allocated objects. Fix it.
+// The slots may point to stack-allocated objects, which live in the frames and are never freed by the GC.
+// Use `TraverseObjects` to find the heap objects they refer to.
 class ShadowStack : private Pinned {
 public:
     class Iterator {
@@ -57,6 +60,32 @@ public:
     Iterator begin() noexcept { return Iterator(currentFrame_); }
     Iterator end() noexcept { return Iterator(nullptr); }
 
+    // Calls `processHeap(object)` for each non-null heap object the stack refers to, and `processLocal(object)` once for
+    // each stack-allocated one. The stack refers to an object if a slot or a field of a stack-allocated object it refers
+    // to points to it.
+    template <typename HeapF, typename LocalF>
+    void TraverseObjects(HeapF processHeap, LocalF processLocal) noexcept {
+        KStdUnorderedSet<ObjHeader*> visitedLocals;
+        KStdVector<ObjHeader*> locals;
+        auto visit = [&processHeap, &visitedLocals, &locals](ObjHeader* object) {
+            if (object == nullptr) return;
+            if (!object->local()) {
+                processHeap(object);
+            } else if (visitedLocals.insert(object).second) {
+                locals.push_back(object);
+            }
+        };
+        for (ObjHeader* object : *this) {
+            visit(object);
+        }
+        while (!locals.empty()) {
+            ObjHeader* local = locals.back();
+            locals.pop_back();
+            processLocal(local);
+            TraverseReferenceFields(local, [&visit](uint32_t, ObjHeader* const* location) { visit(*location); });
+        }
+    }
+
 private:
     FrameOverlay* currentFrame_ = nullptr;
 };
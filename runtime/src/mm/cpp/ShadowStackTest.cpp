@@ -52,6 +52,33 @@ KStdVector<ObjHeader*> Collect(mm::ShadowStack& shadowStack) {
     return result;
 }
 
+struct Node {
+    ObjHeader header;
+    ObjHeader* next;
+};
+
+const int32_t kNodeOffsets[] = {offsetof(Node, next)};
+
+class NodeType : private Pinned {
+public:
+    NodeType() noexcept {
+        typeInfo_.typeInfo_ = &typeInfo_;
+        typeInfo_.instanceSize_ = sizeof(Node);
+        typeInfo_.objOffsets_ = kNodeOffsets;
+        typeInfo_.objOffsetsCount_ = 1;
+    }
+
+    void InitHeap(Node& node) noexcept { node = {{&typeInfo_}, nullptr}; }
+
+    // Tagged like the compiler does for the objects in the stack frames.
+    void InitStackAllocated(Node& node) noexcept {
+        node = {{setPointerBits(&typeInfo_, OBJECT_TAG_PERMANENT_CONTAINER | OBJECT_TAG_NONTRIVIAL_CONTAINER)}, nullptr};
+    }
+
+private:
+    TypeInfo typeInfo_ = {};
+};
+
 } // namespace
 
 TEST(ShadowStackTest, Empty) {
@@ -119,3 +146,30 @@ TEST(ShadowStackTest, ManyStackFrames) {
 
     EXPECT_THAT(actual, testing::ElementsAre(frame4[0], frame4[1], frame4[2], frame3[0], frame1[0], frame1[1], frame1[2]));
 }
+
+TEST(ShadowStackTest, StackAllocatedObjects) {
+    NodeType type;
+    Node heap1, heap2, local1, local2;
+    type.InitHeap(heap1);
+    type.InitHeap(heap2);
+    type.InitStackAllocated(local1);
+    type.InitStackAllocated(local2);
+    ASSERT_TRUE(local1.header.local());
+    local1.next = &local2.header;
+    local2.next = &heap2.header;
+    mm::ShadowStack shadowStack;
+    StackEntry<0, 3> frame1(shadowStack);
+    StackEntry<0, 1> frame2(shadowStack);
+    frame1[0] = &heap1.header;
+    frame1[1] = &local1.header;
+    frame1[2] = nullptr;
+    frame2[0] = &local2.header;
+
+    KStdVector<ObjHeader*> heap;
+    KStdVector<ObjHeader*> locals;
+    shadowStack.TraverseObjects(
+            [&heap](ObjHeader* object) { heap.push_back(object); }, [&locals](ObjHeader* object) { locals.push_back(object); });
+
+    EXPECT_THAT(heap, testing::UnorderedElementsAre(&heap1.header, &heap2.header));
+    EXPECT_THAT(locals, testing::UnorderedElementsAre(&local1.header, &local2.header));
+}
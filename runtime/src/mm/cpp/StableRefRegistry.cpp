@@ -23,6 +23,15 @@ void mm::StableRefRegistry::UnregisterStableRef(mm::ThreadData* threadData, Node
     threadData->stableRefThreadQueue().Erase(node);
 }
 
+void mm::StableRefRegistry::RegisterStableRefs(
+        mm::ThreadData* threadData, ObjHeader* const* objects, size_t count, Node** nodes) noexcept {
+    threadData->stableRefThreadQueue().Insert(objects, count, nodes);
+}
+
+void mm::StableRefRegistry::UnregisterStableRefs(mm::ThreadData* threadData, Node* const* nodes, size_t count) noexcept {
+    threadData->stableRefThreadQueue().Erase(nodes, count);
+}
+
 void mm::StableRefRegistry::ProcessThread(mm::ThreadData* threadData) noexcept {
     threadData->stableRefThreadQueue().Publish();
 }
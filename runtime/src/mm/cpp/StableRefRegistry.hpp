@@ -32,6 +32,11 @@ public:
 
     void UnregisterStableRef(mm::ThreadData* threadData, Node* node) noexcept;
 
+    // Batched versions of the above for the interop code passing many objects at once.
+    void RegisterStableRefs(mm::ThreadData* threadData, ObjHeader* const* objects, size_t count, Node** nodes) noexcept;
+
+    void UnregisterStableRefs(mm::ThreadData* threadData, Node* const* nodes, size_t count) noexcept;
+
     // Collect stable references from thread corresponding to `threadData`. Must be called by the thread
     // when it's asked by GC to stop.
     void ProcessThread(mm::ThreadData* threadData) noexcept;
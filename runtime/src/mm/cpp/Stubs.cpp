@@ -7,6 +7,8 @@
 
 #include "KAssert.h"
 
+int32_t freezeCount = 0;
+
 ALWAYS_INLINE bool isFrozen(const ObjHeader* obj) {
     TODO();
 }
@@ -21,55 +23,6 @@ OBJ_GETTER(InitThreadLocalSingleton, ObjHeader** location, const TypeInfo* typeI
     TODO();
 }
 
-RUNTIME_NOTHROW void SetStackRef(ObjHeader** location, const ObjHeader* object) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void SetHeapRef(ObjHeader** location, const ObjHeader* object) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void ZeroHeapRef(ObjHeader** location) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void ZeroArrayRefs(ArrayHeader* array) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void ZeroStackRef(ObjHeader** location) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void UpdateStackRef(ObjHeader** location, const ObjHeader* object) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void UpdateHeapRef(ObjHeader** location, const ObjHeader* object) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void UpdateHeapRefIfNull(ObjHeader** location, const ObjHeader* object) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void UpdateReturnRef(ObjHeader** returnSlot, const ObjHeader* object) {
-    TODO();
-}
-
-RUNTIME_NOTHROW OBJ_GETTER(
-        SwapHeapRefLocked, ObjHeader** location, ObjHeader* expectedValue, ObjHeader* newValue, int32_t* spinlock, int32_t* cookie) {
-    TODO();
-}
-
-RUNTIME_NOTHROW void SetHeapRefLocked(ObjHeader** location, ObjHeader* newValue, int32_t* spinlock, int32_t* cookie) {
-    TODO();
-}
-
-RUNTIME_NOTHROW OBJ_GETTER(ReadHeapRefLocked, ObjHeader** location, int32_t* spinlock, int32_t* cookie) {
-    TODO();
-}
-
 void MutationCheck(ObjHeader* obj) {
     TODO();
 }
@@ -82,10 +35,6 @@ void EnsureNeverFrozen(ObjHeader* obj) {
     TODO();
 }
 
-RUNTIME_NOTHROW void PerformFullGC(MemoryState* memory) {
-    TODO();
-}
-
 bool TryAddHeapRef(const ObjHeader* object) {
     TODO();
 }
@@ -11,6 +11,7 @@
 
 #include "ObjectFactory.hpp"
 #include "GlobalsRegistry.hpp"
+#include "Nursery.hpp"
 #include "ShadowStack.hpp"
 #include "StableRefRegistry.hpp"
 #include "ThreadLocalStorage.hpp"
@@ -49,6 +50,8 @@ public:
 
     ShadowStack& shadowStack() noexcept { return shadowStack_; }
 
+    Nursery& nursery() noexcept { return nursery_; }
+
 private:
     const pthread_t threadId_;
     GlobalsRegistry::ThreadQueue globalsThreadQueue_;
@@ -57,6 +60,7 @@ private:
     std::atomic<ThreadState> state_;
     ObjectFactory::ThreadQueue objectFactoryThreadQueue_;
     ShadowStack shadowStack_;
+    Nursery nursery_;
 };
 
 } // namespace mm
@@ -5,11 +5,34 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include "Common.h"
+
 extern "C" {
+typedef struct mi_heap_s mi_heap_t;
+
 void* mi_calloc(size_t, size_t);
+void* mi_malloc(size_t);
 void mi_free(void*);
 void* mi_calloc_aligned(size_t count, size_t size, size_t alignment);
+mi_heap_t* mi_heap_new(void);
+void mi_heap_delete(mi_heap_t* heap);
+void mi_heap_collect(mi_heap_t* heap, bool force);
+void* mi_heap_calloc(mi_heap_t* heap, size_t count, size_t size);
+void* mi_heap_malloc(mi_heap_t* heap, size_t size);
+void* mi_heap_calloc_aligned(mi_heap_t* heap, size_t count, size_t size, size_t alignment);
+bool mi_heap_contains_block(mi_heap_t* heap, const void* p);
+}
+
+namespace {
+
+// Heap for Kotlin objects of the current thread, between `konan_init_object_heap_impl` and
+// `konan_deinit_object_heap_impl`. mimalloc heaps can only be allocated from by the owning thread,
+// but blocks can be freed from any thread with `mi_free`.
+THREAD_LOCAL_VARIABLE mi_heap_t* objectHeap = nullptr;
 
+}  // namespace
+
+extern "C" {
 void* konan_calloc_impl(size_t n_elements, size_t elem_size) {
  return mi_calloc(n_elements, elem_size);
 }
@@ -21,4 +44,36 @@ void* konan_calloc_aligned_impl(size_t count, size_t size, size_t alignment) {
 void konan_free_impl (void* mem) {
   mi_free(mem);
 }
+
+void konan_init_object_heap_impl() {
+  if (objectHeap == nullptr) objectHeap = mi_heap_new();
+}
+
+void konan_deinit_object_heap_impl() {
+  if (objectHeap == nullptr) return;
+  // Pages with no live objects are released at once, the ones with objects that are still alive
+  // (e.g. shared frozen ones) migrate to the default heap of the thread.
+  mi_heap_collect(objectHeap, true);
+  mi_heap_delete(objectHeap);
+  objectHeap = nullptr;
+}
+
+void* konan_calloc_object_impl(size_t count, size_t size) {
+  if (objectHeap == nullptr) return mi_calloc(count, size);
+  return mi_heap_calloc(objectHeap, count, size);
+}
+
+void* konan_malloc_object_impl(size_t size) {
+  if (objectHeap == nullptr) return mi_malloc(size);
+  return mi_heap_malloc(objectHeap, size);
+}
+
+void* konan_calloc_object_aligned_impl(size_t count, size_t size, size_t alignment) {
+  if (objectHeap == nullptr) return mi_calloc_aligned(count, size, alignment);
+  return mi_heap_calloc_aligned(objectHeap, count, size, alignment);
+}
+
+bool konan_is_local_object_impl(void* mem) {
+  return objectHeap != nullptr && mi_heap_contains_block(objectHeap, mem);
+}
 }  // extern "C"
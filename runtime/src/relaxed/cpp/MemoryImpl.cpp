@@ -19,6 +19,10 @@ OBJ_GETTER(AllocArrayInstance, const TypeInfo* typeInfo, int32_t elements) {
   RETURN_RESULT_OF(AllocArrayInstanceRelaxed, typeInfo, elements);
 }
 
+OBJ_GETTER(AllocUninitializedArrayInstance, const TypeInfo* typeInfo, int32_t elements) {
+  RETURN_RESULT_OF(AllocUninitializedArrayInstanceRelaxed, typeInfo, elements);
+}
+
 OBJ_GETTER(InitThreadLocalSingleton, ObjHeader** location, const TypeInfo* typeInfo, void (*ctor)(ObjHeader*)) {
     RETURN_RESULT_OF(InitThreadLocalSingletonRelaxed, location, typeInfo, ctor);
 }
@@ -51,6 +55,14 @@ RUNTIME_NOTHROW void UpdateHeapRef(ObjHeader** location, const ObjHeader* object
   UpdateHeapRefRelaxed(location, object);
 }
 
+RUNTIME_NOTHROW void CopyHeapRefs(ObjHeader** destination, ObjHeader* const* source, uint32_t count) {
+  CopyHeapRefsRelaxed(destination, source, count);
+}
+
+RUNTIME_NOTHROW void FillHeapRefs(ObjHeader** location, const ObjHeader* object, uint32_t count) {
+  FillHeapRefsRelaxed(location, object, count);
+}
+
 RUNTIME_NOTHROW void UpdateReturnRef(ObjHeader** returnSlot, const ObjHeader* object) {
   UpdateReturnRefRelaxed(returnSlot, object);
 }
@@ -19,5 +19,25 @@ void* konan_calloc_aligned_impl(size_t count, size_t size, size_t alignment) {
 void konan_free_impl (void* mem) {
   free(mem);
 }
+
+// std alloc has no separate heaps: Kotlin objects share the heap with everything else.
+void konan_init_object_heap_impl() {}
+
+void konan_deinit_object_heap_impl() {}
+
+void* konan_calloc_object_impl(size_t count, size_t size) {
+  return calloc(count, size);
+}
+
+void* konan_malloc_object_impl(size_t size) {
+  return malloc(size);
 }
 
+void* konan_calloc_object_aligned_impl(size_t count, size_t size, size_t alignment) {
+  return calloc(count, size);
+}
+
+bool konan_is_local_object_impl(void* mem) {
+  return true;
+}
+}
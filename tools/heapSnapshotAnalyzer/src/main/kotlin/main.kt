@@ -0,0 +1,62 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+import kotlinx.cli.*
+import org.jetbrains.heapsnapshot.*
+import java.io.File
+
+private fun formatSize(size: Long): String = when {
+    size >= 1024 * 1024 -> "%.1f MiB".format(size / (1024.0 * 1024.0))
+    size >= 1024 -> "%.1f KiB".format(size / 1024.0)
+    else -> "$size B"
+}
+
+private fun printSummary(tree: DominatorTree) {
+    val snapshot = tree.snapshot
+    val totalSize = (0 until snapshot.objectCount).fold(0L) { sum, obj -> sum + snapshot.size(obj) }
+    println("Objects: ${snapshot.objectCount} (${formatSize(totalSize)})")
+    println("Reachable: ${tree.reachableCount} (${formatSize(tree.reachableSize)})")
+    println("Roots: " + RootKind.values().joinToString { kind ->
+        "${snapshot.roots.count { it.kind == kind }} ${kind.name.toLowerCase()}"
+    })
+}
+
+private fun printTypes(tree: DominatorTree, count: Int) {
+    println()
+    println("Types by retained size:")
+    println("%12s %12s %10s  %s".format("retained", "shallow", "count", "type"))
+    typeStatistics(tree).take(count).forEach {
+        println("%12s %12s %10d  %s".format(formatSize(it.retainedSize), formatSize(it.shallowSize), it.count, it.type.name))
+    }
+}
+
+private fun printObjects(tree: DominatorTree, count: Int) {
+    val snapshot = tree.snapshot
+    println()
+    println("Objects by retained size:")
+    println("%12s %12s  %s".format("retained", "shallow", "dominator path"))
+    biggestObjects(tree, count).forEach { obj ->
+        val path = dominatorPath(tree, obj).joinToString(" -> ") { snapshot.type(it).name }
+        println("%12s %12s  %s".format(formatSize(tree.retainedSize(obj)), formatSize(snapshot.size(obj).toLong()), path))
+    }
+}
+
+fun main(args: Array<String>) {
+    val argParser = ArgParser("heapSnapshotAnalyzer")
+
+    val snapshotFile by argParser.argument(ArgType.String, description = "Heap snapshot written by HeapSnapshot.dump")
+    val typeCount by argParser.option(ArgType.Int, "types", "t",
+            "Number of types to show").default(20)
+    val objectCount by argParser.option(ArgType.Int, "objects", "o",
+            "Number of objects to show").default(20)
+
+    argParser.parse(args)
+
+    val snapshot = HeapSnapshot.read(File(snapshotFile))
+    val tree = DominatorTree(snapshot)
+    printSummary(tree)
+    printTypes(tree, typeCount)
+    printObjects(tree, objectCount)
+}
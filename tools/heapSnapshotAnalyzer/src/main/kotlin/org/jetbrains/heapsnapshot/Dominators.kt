@@ -0,0 +1,187 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.heapsnapshot
+
+/**
+ * Dominator tree of the objects reachable from the roots of [snapshot], and the retained sizes of the objects.
+ *
+ * An object A dominates B if every path from the roots to B goes through A, so B is collected once A is.
+ * The retained size of A is the total size of the objects it dominates including itself: how much memory
+ * would be freed if A became unreachable.
+ *
+ * Computed with the iterative algorithm from "A Simple, Fast Dominance Algorithm" by Cooper, Harvey and Kennedy
+ * on the graph with a virtual node referencing all the roots.
+ */
+class DominatorTree(val snapshot: HeapSnapshot) {
+    // The virtual root is the node 0, object i is the node i + 1.
+    private val nodeCount = snapshot.objectCount + 1
+
+    private val successorsStart = IntArray(nodeCount + 1)
+    private val successors: IntArray
+
+    // Nodes in the depth-first postorder, reachable ones only; the virtual root is the last one.
+    private val postorder: IntArray
+    // Position of each node in `postorder`, -1 for unreachable ones.
+    private val postorderNumber = IntArray(nodeCount) { -1 }
+
+    private val dominators = IntArray(nodeCount) { UNDEFINED }
+    private val retainedSizes = LongArray(nodeCount)
+
+    init {
+        successors = buildSuccessors()
+        postorder = buildPostorder()
+        computeDominators()
+        computeRetainedSizes()
+    }
+
+    val reachableCount: Int
+        get() = postorder.size - 1
+
+    fun isReachable(obj: Int): Boolean = postorderNumber[obj + 1] >= 0
+
+    /** Returns the immediate dominator of [obj], -1 if it's dominated only by the roots or unreachable. */
+    fun immediateDominator(obj: Int): Int {
+        val dominator = dominators[obj + 1]
+        return if (dominator == UNDEFINED || dominator == VIRTUAL_ROOT) -1 else dominator - 1
+    }
+
+    /** Returns the retained size of [obj], 0 for unreachable objects. */
+    fun retainedSize(obj: Int): Long = retainedSizes[obj + 1]
+
+    /** Returns the total size of the reachable objects. */
+    val reachableSize: Long
+        get() = retainedSizes[VIRTUAL_ROOT]
+
+    /** Returns the objects [obj] immediately dominates. */
+    fun dominatedBy(obj: Int): List<Int> = children[obj + 1].map { it - 1 }
+
+    /** Returns the objects dominated only by the roots. */
+    val topLevel: List<Int>
+        get() = children[VIRTUAL_ROOT].map { it - 1 }
+
+    private val children: Array<MutableList<Int>> by lazy {
+        val result = Array(nodeCount) { mutableListOf<Int>() }
+        for (node in postorder) {
+            if (node != VIRTUAL_ROOT) result[dominators[node]].add(node)
+        }
+        result
+    }
+
+    private fun buildSuccessors(): IntArray {
+        val result = IntArrayBuilder()
+        successorsStart[VIRTUAL_ROOT] = 0
+        for (root in snapshot.roots) {
+            val obj = snapshot.indexOf(root.target)
+            if (obj >= 0) result.add(obj + 1)
+        }
+        for (obj in 0 until snapshot.objectCount) {
+            successorsStart[obj + 1] = result.size
+            for (reference in snapshot.references(obj)) {
+                val target = snapshot.referenceTarget(reference)
+                // References to objects missing from the snapshot are dropped.
+                if (target >= 0) result.add(target + 1)
+            }
+        }
+        successorsStart[nodeCount] = result.size
+        return result.toArray()
+    }
+
+    // Iterative, since the heap graph can be too deep for the recursive one.
+    private fun buildPostorder(): IntArray {
+        val result = IntArrayBuilder()
+        val visited = BooleanArray(nodeCount)
+        // Each node is pushed at most once.
+        val stack = IntArray(nodeCount)
+        var stackSize = 0
+        // Position of the next successor to visit for each node on the stack.
+        val nextSuccessor = successorsStart.copyOf(nodeCount)
+        stack[stackSize++] = VIRTUAL_ROOT
+        visited[VIRTUAL_ROOT] = true
+        while (stackSize > 0) {
+            val node = stack[stackSize - 1]
+            if (nextSuccessor[node] < successorsStart[node + 1]) {
+                val successor = successors[nextSuccessor[node]++]
+                if (!visited[successor]) {
+                    visited[successor] = true
+                    stack[stackSize++] = successor
+                }
+            } else {
+                stackSize--
+                postorderNumber[node] = result.size
+                result.add(node)
+            }
+        }
+        return result.toArray()
+    }
+
+    private fun computeDominators() {
+        val (predecessorsStart, predecessors) = buildPredecessors()
+        dominators[VIRTUAL_ROOT] = VIRTUAL_ROOT
+        var changed = true
+        while (changed) {
+            changed = false
+            // Reverse postorder, skipping the virtual root.
+            for (i in postorder.size - 2 downTo 0) {
+                val node = postorder[i]
+                var newDominator = UNDEFINED
+                for (j in predecessorsStart[node] until predecessorsStart[node + 1]) {
+                    val predecessor = predecessors[j]
+                    if (dominators[predecessor] == UNDEFINED) continue
+                    newDominator = if (newDominator == UNDEFINED) predecessor else intersect(predecessor, newDominator)
+                }
+                if (dominators[node] != newDominator) {
+                    dominators[node] = newDominator
+                    changed = true
+                }
+            }
+        }
+    }
+
+    // Predecessors from the reachable nodes only, in the same layout as successors.
+    private fun buildPredecessors(): Pair<IntArray, IntArray> {
+        val start = IntArray(nodeCount + 1)
+        for (node in postorder) {
+            for (i in successorsStart[node] until successorsStart[node + 1]) {
+                start[successors[i] + 1]++
+            }
+        }
+        for (node in 0 until nodeCount) {
+            start[node + 1] += start[node]
+        }
+        val result = IntArray(start[nodeCount])
+        val next = start.copyOf(nodeCount)
+        for (node in postorder) {
+            for (i in successorsStart[node] until successorsStart[node + 1]) {
+                result[next[successors[i]]++] = node
+            }
+        }
+        return start to result
+    }
+
+    private fun intersect(node1: Int, node2: Int): Int {
+        var finger1 = node1
+        var finger2 = node2
+        while (finger1 != finger2) {
+            while (postorderNumber[finger1] < postorderNumber[finger2]) finger1 = dominators[finger1]
+            while (postorderNumber[finger2] < postorderNumber[finger1]) finger2 = dominators[finger2]
+        }
+        return finger1
+    }
+
+    // A dominator always comes after the nodes it dominates in the postorder.
+    private fun computeRetainedSizes() {
+        for (node in postorder) {
+            if (node == VIRTUAL_ROOT) continue
+            retainedSizes[node] += snapshot.size(node - 1).toLong()
+            retainedSizes[dominators[node]] += retainedSizes[node]
+        }
+    }
+
+    private companion object {
+        const val VIRTUAL_ROOT = 0
+        const val UNDEFINED = -1
+    }
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.heapsnapshot
+
+import java.io.BufferedInputStream
+import java.io.EOFException
+import java.io.File
+import java.io.IOException
+import java.io.InputStream
+
+class HeapType(val id: Long, val name: String, val instanceSize: Int, val fieldNames: List<String>) {
+    val isArray: Boolean
+        get() = instanceSize < 0
+}
+
+enum class RootKind(val code: Int) {
+    STACK(1),
+    GLOBAL(2),
+    STABLE_REF(3),
+    THREAD_LOCAL(4);
+
+    companion object {
+        fun of(code: Int) = values().firstOrNull { it.code == code }
+                ?: throw IOException("Unknown root kind $code")
+    }
+}
+
+class Root(val kind: RootKind, val target: Long)
+
+/**
+ * Heap snapshot written by `kotlin.native.internal.HeapSnapshot.dump`, see `runtime/src/main/cpp/HeapSnapshot.hpp`
+ * for the format.
+ *
+ * Objects are addressed by their index in the snapshot, `0 until objectCount`. References are stored flat:
+ * the references of an object are `references(object)`, positions in the reference arrays.
+ */
+class HeapSnapshot private constructor(
+        val types: Map<Long, HeapType>,
+        val roots: List<Root>,
+        private val ids: LongArray,
+        private val typeIds: LongArray,
+        private val sizes: IntArray,
+        private val firstReference: IntArray,
+        private val referenceIndices: IntArray,
+        private val referenceTargets: LongArray
+) {
+    private val indices = HashMap<Long, Int>(ids.size * 2).apply {
+        ids.forEachIndexed { index, id -> put(id, index) }
+    }
+
+    val objectCount: Int
+        get() = ids.size
+
+    fun id(obj: Int): Long = ids[obj]
+
+    fun type(obj: Int): HeapType = types.getValue(typeIds[obj])
+
+    fun size(obj: Int): Int = sizes[obj]
+
+    /** Returns the index of the object with [id] or -1 if it's not in the snapshot. */
+    fun indexOf(id: Long): Int = indices[id] ?: -1
+
+    fun references(obj: Int): IntRange = firstReference[obj] until firstReference[obj + 1]
+
+    /** Returns the index of the referenced object or -1 if it's not in the snapshot. */
+    fun referenceTarget(reference: Int): Int = indexOf(referenceTargets[reference])
+
+    /** Returns the field name or the element index of [reference] of [obj]. */
+    fun referenceName(obj: Int, reference: Int): String {
+        val index = referenceIndices[reference]
+        val type = type(obj)
+        if (type.isArray) return "[$index]"
+        return type.fieldNames.getOrNull(index)?.takeIf { it.isNotEmpty() } ?: "<field $index>"
+    }
+
+    companion object {
+        const val VERSION = 1
+
+        private const val RECORD_END = 0
+        private const val RECORD_TYPE = 1
+        private const val RECORD_OBJECT = 2
+        private const val RECORD_ROOT = 3
+
+        fun read(file: File): HeapSnapshot = file.inputStream().use { read(it) }
+
+        fun read(input: InputStream): HeapSnapshot {
+            val reader = LittleEndianReader(BufferedInputStream(input))
+            val magic = String(ByteArray(4) { reader.readByte().toByte() }, Charsets.US_ASCII)
+            if (magic != "KNHS") throw IOException("Not a heap snapshot")
+            val version = reader.readInt()
+            if (version != VERSION) throw IOException("Unsupported heap snapshot version $version")
+
+            val types = mutableMapOf<Long, HeapType>()
+            val roots = mutableListOf<Root>()
+            val ids = LongArrayBuilder()
+            val typeIds = LongArrayBuilder()
+            val sizes = IntArrayBuilder()
+            val firstReference = IntArrayBuilder()
+            val referenceIndices = IntArrayBuilder()
+            val referenceTargets = LongArrayBuilder()
+            while (true) {
+                when (val record = reader.readByte()) {
+                    RECORD_END -> break
+                    RECORD_TYPE -> {
+                        val id = reader.readLong()
+                        val name = reader.readString()
+                        val instanceSize = reader.readInt()
+                        val fieldNames = List(reader.readInt()) { reader.readString() }
+                        types[id] = HeapType(id, name, instanceSize, fieldNames)
+                    }
+                    RECORD_OBJECT -> {
+                        ids.add(reader.readLong())
+                        val typeId = reader.readLong()
+                        if (typeId !in types) throw IOException("Object of unknown type ${typeId.toString(16)}")
+                        typeIds.add(typeId)
+                        sizes.add(reader.readInt())
+                        firstReference.add(referenceIndices.size)
+                        repeat(reader.readInt()) {
+                            referenceIndices.add(reader.readInt())
+                            referenceTargets.add(reader.readLong())
+                        }
+                    }
+                    RECORD_ROOT -> {
+                        val kind = RootKind.of(reader.readByte())
+                        roots.add(Root(kind, reader.readLong()))
+                    }
+                    else -> throw IOException("Unknown record $record")
+                }
+            }
+            firstReference.add(referenceIndices.size)
+            return HeapSnapshot(types, roots, ids.toArray(), typeIds.toArray(), sizes.toArray(),
+                    firstReference.toArray(), referenceIndices.toArray(), referenceTargets.toArray())
+        }
+    }
+}
+
+private class LittleEndianReader(private val input: InputStream) {
+    fun readByte(): Int {
+        val result = input.read()
+        if (result < 0) throw EOFException("Truncated heap snapshot")
+        return result
+    }
+
+    fun readInt(): Int {
+        var result = 0
+        for (i in 0 until 4) result = result or (readByte() shl (8 * i))
+        return result
+    }
+
+    fun readLong(): Long {
+        var result = 0L
+        for (i in 0 until 8) result = result or (readByte().toLong() shl (8 * i))
+        return result
+    }
+
+    fun readString(): String {
+        val bytes = ByteArray(readInt())
+        var offset = 0
+        while (offset < bytes.size) {
+            val read = input.read(bytes, offset, bytes.size - offset)
+            if (read < 0) throw EOFException("Truncated heap snapshot")
+            offset += read
+        }
+        return String(bytes, Charsets.UTF_8)
+    }
+}
+
+// Snapshots easily have millions of objects, so keep them in primitive arrays.
+internal class IntArrayBuilder {
+    private var data = IntArray(16)
+    var size = 0
+        private set
+
+    fun add(value: Int) {
+        if (size == data.size) data = data.copyOf(size * 2)
+        data[size++] = value
+    }
+
+    fun toArray(): IntArray = data.copyOf(size)
+}
+
+internal class LongArrayBuilder {
+    private var data = LongArray(16)
+    var size = 0
+        private set
+
+    fun add(value: Long) {
+        if (size == data.size) data = data.copyOf(size * 2)
+        data[size++] = value
+    }
+
+    fun toArray(): LongArray = data.copyOf(size)
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.heapsnapshot
+
+import java.util.PriorityQueue
+
+class TypeStatistics(val type: HeapType) {
+    var count = 0
+        internal set
+    var shallowSize = 0L
+        internal set
+    // Retained by the objects of the type, counting objects retained by several of them once.
+    var retainedSize = 0L
+        internal set
+}
+
+/** Returns statistics of the reachable objects by type, the biggest retained size first. */
+fun typeStatistics(tree: DominatorTree): List<TypeStatistics> {
+    val snapshot = tree.snapshot
+    val statistics = mutableMapOf<Long, TypeStatistics>()
+    // How many objects of the type are on the path from the root of the dominator tree.
+    val onPath = mutableMapOf<Long, Int>()
+    // Depth-first over the dominator tree: an object is pushed as `obj` when entered and as `-obj - 1` to exit it.
+    val stack = ArrayList<Int>()
+    tree.topLevel.forEach { stack.add(it) }
+    while (stack.isNotEmpty()) {
+        val entry = stack.removeAt(stack.size - 1)
+        if (entry < 0) {
+            val typeId = snapshot.type(-entry - 1).id
+            onPath[typeId] = onPath.getValue(typeId) - 1
+            continue
+        }
+        val type = snapshot.type(entry)
+        val typeStatistics = statistics.getOrPut(type.id) { TypeStatistics(type) }
+        typeStatistics.count++
+        typeStatistics.shallowSize += snapshot.size(entry)
+        val outer = onPath[type.id] ?: 0
+        if (outer == 0) typeStatistics.retainedSize += tree.retainedSize(entry)
+        onPath[type.id] = outer + 1
+        stack.add(-entry - 1)
+        tree.dominatedBy(entry).forEach { stack.add(it) }
+    }
+    return statistics.values.sortedByDescending { it.retainedSize }
+}
+
+/** Returns [count] reachable objects with the biggest retained sizes, the biggest first. */
+fun biggestObjects(tree: DominatorTree, count: Int): List<Int> {
+    if (count <= 0) return emptyList()
+    val biggest = PriorityQueue<Int>(count + 1, compareBy { tree.retainedSize(it) })
+    for (obj in 0 until tree.snapshot.objectCount) {
+        if (!tree.isReachable(obj)) continue
+        biggest.add(obj)
+        if (biggest.size > count) biggest.poll()
+    }
+    return biggest.sortedByDescending { tree.retainedSize(it) }
+}
+
+/** Returns the dominators of [obj] from the one dominated only by the roots down to [obj] itself. */
+fun dominatorPath(tree: DominatorTree, obj: Int): List<Int> {
+    val result = mutableListOf<Int>()
+    var current = obj
+    while (current >= 0) {
+        result.add(current)
+        current = tree.immediateDominator(current)
+    }
+    return result.asReversed()
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+package org.jetbrains.heapsnapshot
+
+import java.io.ByteArrayInputStream
+import java.io.ByteArrayOutputStream
+import java.io.IOException
+import kotlin.test.*
+
+// Writes snapshots in the format of runtime/src/main/cpp/HeapSnapshot.hpp.
+private class SnapshotBuilder {
+    private val output = ByteArrayOutputStream()
+
+    init {
+        output.write("KNHS".toByteArray())
+        int(HeapSnapshot.VERSION)
+    }
+
+    fun type(id: Long, name: String, instanceSize: Int, vararg fields: String) = apply {
+        output.write(1)
+        long(id)
+        string(name)
+        int(instanceSize)
+        int(fields.size)
+        fields.forEach { string(it) }
+    }
+
+    // References are (index, target) pairs.
+    fun obj(id: Long, typeId: Long, size: Int, vararg references: Pair<Int, Long>) = apply {
+        output.write(2)
+        long(id)
+        long(typeId)
+        int(size)
+        int(references.size)
+        references.forEach { (index, target) ->
+            int(index)
+            long(target)
+        }
+    }
+
+    fun root(kind: RootKind, target: Long) = apply {
+        output.write(3)
+        output.write(kind.code)
+        long(target)
+    }
+
+    fun bytes(): ByteArray {
+        output.write(0)
+        return output.toByteArray()
+    }
+
+    fun build(): HeapSnapshot = HeapSnapshot.read(ByteArrayInputStream(bytes()))
+
+    private fun int(value: Int) {
+        for (i in 0 until 4) output.write((value ushr (8 * i)) and 0xff)
+    }
+
+    private fun long(value: Long) {
+        for (i in 0 until 8) output.write(((value ushr (8 * i)) and 0xff).toInt())
+    }
+
+    private fun string(value: String) {
+        val bytes = value.toByteArray(Charsets.UTF_8)
+        int(bytes.size)
+        output.write(bytes)
+    }
+}
+
+private const val NODE = 0x10L
+private const val ARRAY = 0x20L
+
+private fun builder() = SnapshotBuilder()
+        .type(NODE, "test.Node", 16, "left", "right")
+        .type(ARRAY, "kotlin.Array", -8)
+
+private fun DominatorTree.dominatorOf(snapshot: HeapSnapshot, id: Long): Long? =
+        immediateDominator(snapshot.indexOf(id)).takeIf { it >= 0 }?.let { snapshot.id(it) }
+
+private fun DominatorTree.retainedSizeOf(snapshot: HeapSnapshot, id: Long) = retainedSize(snapshot.indexOf(id))
+
+class HeapSnapshotTests {
+    @Test
+    fun testRead() {
+        val snapshot = builder()
+                .obj(1, NODE, 16, 0 to 2L, 1 to 3L)
+                .obj(2, NODE, 16)
+                .obj(3, ARRAY, 40, 2 to 2L)
+                .root(RootKind.GLOBAL, 1)
+                .root(RootKind.STACK, 3)
+                .build()
+
+        assertEquals(3, snapshot.objectCount)
+        assertEquals(listOf(RootKind.GLOBAL, RootKind.STACK), snapshot.roots.map { it.kind })
+        val first = snapshot.indexOf(1)
+        assertEquals("test.Node", snapshot.type(first).name)
+        assertEquals(16, snapshot.size(first))
+        assertEquals(listOf("left", "right"), snapshot.references(first).map { snapshot.referenceName(first, it) })
+        assertEquals(listOf(2L, 3L), snapshot.references(first).map { snapshot.id(snapshot.referenceTarget(it)) })
+        val array = snapshot.indexOf(3)
+        assertTrue(snapshot.type(array).isArray)
+        assertEquals(listOf("[2]"), snapshot.references(array).map { snapshot.referenceName(array, it) })
+        assertEquals(-1, snapshot.indexOf(4))
+    }
+
+    @Test
+    fun testInvalid() {
+        assertFailsWith<IOException> {
+            HeapSnapshot.read(ByteArrayInputStream("JUNK".toByteArray()))
+        }
+        val truncated = builder().obj(1, NODE, 16).bytes().let { it.copyOf(it.size - 3) }
+        assertFailsWith<IOException> {
+            HeapSnapshot.read(ByteArrayInputStream(truncated))
+        }
+        assertFailsWith<IOException> {
+            SnapshotBuilder().obj(1, NODE, 16).build()
+        }
+    }
+
+    @Test
+    fun testDominators() {
+        //   root -> 1 -> 2 -> 4
+        //           |         ^
+        //           +--> 3 ---+--> 5
+        //   root -> 6 -> 5
+        val snapshot = builder()
+                .obj(1, NODE, 10, 0 to 2L, 1 to 3L)
+                .obj(2, NODE, 20, 0 to 4L)
+                .obj(3, NODE, 30, 0 to 4L, 1 to 5L)
+                .obj(4, NODE, 40)
+                .obj(5, NODE, 50)
+                .obj(6, NODE, 60, 0 to 5L)
+                .obj(7, NODE, 70, 0 to 1L)
+                .root(RootKind.STACK, 1)
+                .root(RootKind.GLOBAL, 6)
+                .build()
+        val tree = DominatorTree(snapshot)
+
+        assertNull(tree.dominatorOf(snapshot, 1))
+        assertEquals(1L, tree.dominatorOf(snapshot, 2))
+        assertEquals(1L, tree.dominatorOf(snapshot, 3))
+        assertEquals(1L, tree.dominatorOf(snapshot, 4))
+        assertNull(tree.dominatorOf(snapshot, 5))
+        assertNull(tree.dominatorOf(snapshot, 6))
+
+        assertEquals(100L, tree.retainedSizeOf(snapshot, 1))
+        assertEquals(20L, tree.retainedSizeOf(snapshot, 2))
+        assertEquals(30L, tree.retainedSizeOf(snapshot, 3))
+        assertEquals(50L, tree.retainedSizeOf(snapshot, 5))
+        assertEquals(60L, tree.retainedSizeOf(snapshot, 6))
+
+        assertFalse(tree.isReachable(snapshot.indexOf(7)))
+        assertEquals(0L, tree.retainedSizeOf(snapshot, 7))
+        assertEquals(6, tree.reachableCount)
+        assertEquals(210L, tree.reachableSize)
+    }
+
+    @Test
+    fun testCycles() {
+        // root -> 1 <-> 2 -> 3 -> 1
+        val snapshot = builder()
+                .obj(1, NODE, 1, 0 to 2L)
+                .obj(2, NODE, 2, 0 to 1L, 1 to 3L)
+                .obj(3, NODE, 4, 0 to 1L, 1 to 3L)
+                .root(RootKind.STABLE_REF, 1)
+                .root(RootKind.THREAD_LOCAL, 1)
+                .build()
+        val tree = DominatorTree(snapshot)
+
+        assertEquals(1L, tree.dominatorOf(snapshot, 2))
+        assertEquals(2L, tree.dominatorOf(snapshot, 3))
+        assertEquals(7L, tree.retainedSizeOf(snapshot, 1))
+        assertEquals(listOf(1L, 2L, 3L), dominatorPath(tree, snapshot.indexOf(3)).map { snapshot.id(it) })
+    }
+
+    @Test
+    fun testDeepChain() {
+        // Deep enough to overflow the stack if traversed recursively.
+        val count = 1_000_000
+        val builder = builder()
+        for (id in 1L..count) {
+            if (id < count) builder.obj(id, NODE, 1, 0 to id + 1) else builder.obj(id, NODE, 1)
+        }
+        val snapshot = builder.root(RootKind.STACK, 1).build()
+        val tree = DominatorTree(snapshot)
+
+        assertEquals(count.toLong(), tree.retainedSizeOf(snapshot, 1))
+        assertEquals(count - 1L, tree.dominatorOf(snapshot, count.toLong()))
+    }
+
+    @Test
+    fun testStatistics() {
+        // Nodes 2 and 3 are retained by 1 of the same type, so they're counted only once in its retained size.
+        val snapshot = builder()
+                .obj(1, NODE, 16, 0 to 2L, 1 to 4L)
+                .obj(2, NODE, 16, 0 to 3L)
+                .obj(3, NODE, 16)
+                .obj(4, ARRAY, 100)
+                .obj(5, ARRAY, 1000)
+                .root(RootKind.STACK, 1)
+                .build()
+        val tree = DominatorTree(snapshot)
+
+        val statistics = typeStatistics(tree)
+        assertEquals(listOf("test.Node", "kotlin.Array"), statistics.map { it.type.name })
+        assertEquals(listOf(3, 1), statistics.map { it.count })
+        assertEquals(listOf(48L, 100L), statistics.map { it.shallowSize })
+        assertEquals(listOf(148L, 100L), statistics.map { it.retainedSize })
+
+        assertEquals(listOf(1L, 4L), biggestObjects(tree, 2).map { snapshot.id(it) })
+    }
+}
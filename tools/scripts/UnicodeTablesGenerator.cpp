@@ -0,0 +1,94 @@
+/*
+ * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license
+ * that can be found in the LICENSE file.
+ */
+
+// Prints `runtime/src/main/cpp/UnicodeTables.cpp`, the two-stage tables of `UnicodeTables.hpp` built from the ranges
+// of `UnicodeRanges.hpp`. Run via `update_unicode_tables.sh`.
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "UnicodeRanges.hpp"
+#include "UnicodeTables.hpp"
+
+using namespace kotlin;
+
+namespace {
+
+constexpr int kValuesPerLine = 16;
+
+template <typename T>
+void PrintValues(const std::vector<T>& values, size_t begin, size_t end, bool hex) {
+    for (size_t i = begin; i < end; ++i) {
+        const char* separator = (i + 1 - begin) % kValuesPerLine == 0 || i + 1 == end ? ",\n" : ", ";
+        std::printf(hex ? "%s0x%" PRIx32 "%s" : "%s%" PRIu32 "%s", (i - begin) % kValuesPerLine == 0 ? "    " : "",
+                    static_cast<uint32_t>(values[i]), separator);
+    }
+}
+
+// Splits the values of all chars into blocks of `kUnicodeBlockSize`, stores each distinct block once in the order of
+// their first use, and prints the index of the blocks and the blocks.
+template <typename T, typename F>
+void PrintTable(const char* name, const char* type, bool hex, F valueOf) {
+    std::map<std::vector<T>, uint32_t> blockIds;
+    std::vector<uint32_t> index;
+    std::vector<T> blocks;
+    for (uint32_t start = 0; start <= 0xFFFF; start += kotlin::internal::kUnicodeBlockSize) {
+        std::vector<T> block;
+        for (uint32_t ch = start; ch < start + kotlin::internal::kUnicodeBlockSize; ++ch) {
+            block.push_back(valueOf(static_cast<KChar>(ch)));
+        }
+        auto inserted = blockIds.emplace(block, static_cast<uint32_t>(blockIds.size()));
+        if (inserted.second) blocks.insert(blocks.end(), block.begin(), block.end());
+        index.push_back(inserted.first->second);
+    }
+    if (blockIds.size() > 256) {
+        std::fprintf(stderr, "k%sIndex doesn't fit into uint8_t: %zu blocks\n", name, blockIds.size());
+        std::exit(1);
+    }
+
+    std::printf("const uint8_t k%sIndex[] = {\n", name);
+    PrintValues(index, 0, index.size(), false);
+    std::printf("};\n\nconst %s k%sBlocks[] = {\n", type, name);
+    for (size_t block = 0; block < blockIds.size(); ++block) {
+        std::printf("    // %zu\n", block);
+        PrintValues(blocks, block * kotlin::internal::kUnicodeBlockSize, (block + 1) * kotlin::internal::kUnicodeBlockSize, hex);
+    }
+    std::printf("};\n");
+}
+
+} // namespace
+
+int main() {
+    std::printf(
+            "/*\n"
+            " * Copyright 2010-2020 JetBrains s.r.o. Use of this source code is governed by the Apache 2.0 license\n"
+            " * that can be found in the LICENSE file.\n"
+            " */\n"
+            "\n"
+            "#include \"UnicodeTables.hpp\"\n"
+            "\n"
+            "// Generated by `tools/scripts/update_unicode_tables.sh` from the ranges of `UnicodeRanges.hpp`, don't edit by hand.\n"
+            "\n"
+            "namespace kotlin {\n"
+            "namespace internal {\n"
+            "\n");
+    PrintTable<uint8_t>("CharType", "uint8_t", false, unicode::GetCharTypeInRanges);
+    std::printf("\n");
+    PrintTable<uint16_t>("UpperCaseDelta", "uint16_t", true, [](KChar ch) { return unicode::GetUpperCaseInRanges(ch) - ch; });
+    std::printf("\n");
+    PrintTable<uint16_t>("LowerCaseDelta", "uint16_t", true, [](KChar ch) { return unicode::GetLowerCaseInRanges(ch) - ch; });
+    std::printf("\n");
+    PrintTable<uint8_t>("CanonicalClass", "uint8_t", false, unicode::GetCanonicalClassInRanges);
+    std::printf("\n");
+    PrintTable<uint16_t>("Decomposition", "uint16_t", false, [](KChar ch) { return unicode::GetDecompositionIndexInRanges(ch) + 1; });
+    std::printf(
+            "\n"
+            "} // namespace internal\n"
+            "} // namespace kotlin\n");
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env bash
+
+# Regenerates runtime/src/main/cpp/UnicodeTables.cpp from the ranges of runtime/src/main/cpp/UnicodeRanges.hpp.
+# Run it after changing the ranges, then run UnicodeTablesTest, which checks every BMP char against the ranges.
+# Usage: tools/scripts/update_unicode_tables.sh [C++ compiler, c++ by default]
+
+set -e
+
+CXX=${1:-c++}
+ROOT=$(cd "$(dirname "$0")/../.." && pwd)
+RUNTIME=$ROOT/runtime/src
+GENERATOR=$(mktemp)
+trap 'rm -f "$GENERATOR"' EXIT
+
+"$CXX" -std=c++17 -w -DKONAN_LINUX=1 -DKONAN_X64=1 \
+    -I"$RUNTIME/main/cpp" -I"$RUNTIME/mm/cpp" -I"$ROOT/common/src/hash/headers" \
+    "$ROOT/tools/scripts/UnicodeTablesGenerator.cpp" -o "$GENERATOR"
+"$GENERATOR" > "$RUNTIME/main/cpp/UnicodeTables.cpp"
+echo "Updated $RUNTIME/main/cpp/UnicodeTables.cpp"